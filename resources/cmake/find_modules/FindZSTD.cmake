@@ -0,0 +1,53 @@
+# - Try to find libzstd
+# Once done this will define
+#  ZSTD_FOUND - System has zstd
+#  ZSTD_INCLUDE_DIR - The zstd include directory
+#  ZSTD_LIBRARIES - The libraries needed to use zstd
+#  ZSTD_VERSION_STRING - The version of zstd ("major.minor.release")
+
+# use pkg-config to get the directories and then use these values
+# in the find_path() and find_library() calls
+find_package(PkgConfig QUIET)
+PKG_CHECK_MODULES(PC_ZSTD QUIET libzstd)
+
+find_path(ZSTD_INCLUDE_DIR NAMES zstd.h
+   HINTS
+   ${PC_ZSTD_INCLUDEDIR}
+   ${PC_ZSTD_INCLUDE_DIRS}
+   )
+
+find_library(ZSTD_LIBRARIES NAMES zstd
+   HINTS
+   ${PC_ZSTD_LIBDIR}
+   ${PC_ZSTD_LIBRARY_DIRS}
+   )
+
+if(PC_ZSTD_VERSION)
+    set(ZSTD_VERSION_STRING ${PC_ZSTD_VERSION})
+elseif(ZSTD_INCLUDE_DIR AND EXISTS "${ZSTD_INCLUDE_DIR}/zstd.h")
+    file(STRINGS "${ZSTD_INCLUDE_DIR}/zstd.h" zstd_major_version
+         REGEX "^#define[\t ]+ZSTD_VERSION_MAJOR[\t ]+.+")
+    file(STRINGS "${ZSTD_INCLUDE_DIR}/zstd.h" zstd_minor_version
+         REGEX "^#define[\t ]+ZSTD_VERSION_MINOR[\t ]+.+")
+    file(STRINGS "${ZSTD_INCLUDE_DIR}/zstd.h" zstd_release_version
+         REGEX "^#define[\t ]+ZSTD_VERSION_RELEASE[\t ]+.+")
+    string(REGEX REPLACE "^#define[\t ]+ZSTD_VERSION_MAJOR[\t ]+(.+)" "\\1"
+           zstd_major_version "${zstd_major_version}")
+    string(REGEX REPLACE "^#define[\t ]+ZSTD_VERSION_MINOR[\t ]+(.+)" "\\1"
+           zstd_minor_version "${zstd_minor_version}")
+    string(REGEX REPLACE "^#define[\t ]+ZSTD_VERSION_RELEASE[\t ]+(.+)" "\\1"
+           zstd_release_version "${zstd_release_version}")
+    set(ZSTD_VERSION_STRING "${zstd_major_version}.${zstd_minor_version}.${zstd_release_version}")
+    unset(zstd_major_version)
+    unset(zstd_minor_version)
+    unset(zstd_release_version)
+endif()
+
+# handle the QUIETLY and REQUIRED arguments and set ZSTD_FOUND to TRUE if
+# all listed variables are TRUE
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(ZSTD
+                                  REQUIRED_VARS ZSTD_LIBRARIES ZSTD_INCLUDE_DIR
+                                  VERSION_VAR ZSTD_VERSION_STRING)
+
+mark_as_advanced(ZSTD_INCLUDE_DIR ZSTD_LIBRARIES)
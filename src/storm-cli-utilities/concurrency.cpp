@@ -0,0 +1,18 @@
+#include "storm-cli-utilities/concurrency.h"
+
+#include "storm/logic/FormulaInformation.h"
+
+namespace storm {
+namespace cli {
+
+std::unique_lock<std::mutex> lockIfLtlTranslationRequired(storm::logic::Formula const& formula) {
+    static std::mutex ltlMutex;
+    std::unique_lock<std::mutex> lock(ltlMutex, std::defer_lock);
+    if (formula.info().containsComplexPathFormula()) {
+        lock.lock();
+    }
+    return lock;
+}
+
+}  // namespace cli
+}  // namespace storm
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <mutex>
+
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace cli {
+
+/*!
+ * Acquires the process-wide lock that has to be held while checking the given formula concurrently to other formulas, if checking the formula
+ * involves the translation of an LTL formula into an automaton. As this translation is not thread-safe, such formulas are checked one after another.
+ * For all other formulas, the returned lock does not own the mutex.
+ */
+std::unique_lock<std::mutex> lockIfLtlTranslationRequired(storm::logic::Formula const& formula);
+
+/*!
+ * Computes the data of the given model that is otherwise computed lazily upon first access. Afterwards, the model can be accessed concurrently.
+ */
+template<typename ValueType>
+void prepareForConcurrentAccess(storm::models::sparse::Model<ValueType> const& model) {
+    model.getTransitionMatrix().getRowGroupIndices();
+    if (model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        static_cast<storm::models::sparse::MarkovAutomaton<ValueType> const&>(model).containsZenoCycle();
+    }
+}
+
+}  // namespace cli
+}  // namespace storm
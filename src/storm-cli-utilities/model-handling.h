@@ -2,6 +2,7 @@
 
 #include "storm/api/storm.h"
 
+#include "storm-cli-utilities/concurrency.h"
 #include "storm-counterexamples/api/counterexamples.h"
 #include "storm-gamebased-ar/api/verification.h"
 #include "storm-parsers/api/storm-parsers.h"
@@ -17,6 +18,11 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -30,6 +36,7 @@
 
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/hints/SparseAnalysisCache.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -1027,6 +1034,88 @@ void verifyProperties(SymbolicInput const& input, VerificationCallbackType const
     }
 }
 
+/*!
+ * Verifies all (potentially preprocessed) properties given in `input` concurrently, using one thread per given verification callback.
+ * The results are postprocessed and printed by the calling thread in the order of the properties.
+ * LTL properties are checked one after another since the translation of LTL formulas to automata is not thread-safe.
+ * @param input Where the properties are read from
+ * @param verificationCallbacks Functions to perform the actual verification tasks. Each function is only invoked by a single thread.
+ * @param postprocessingCallback Function that processes the verification result, such as e.g. output to a file
+ */
+template<typename ValueType>
+void verifyPropertiesConcurrently(SymbolicInput const& input, std::vector<VerificationCallbackType> const& verificationCallbacks,
+                                  PostprocessingCallbackType const& postprocessingCallback = PostprocessingIdentity()) {
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    struct PropertyResult {
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        storm::utility::Stopwatch watch;
+        std::exception_ptr exception;
+        bool done = false;
+    };
+    std::vector<PropertyResult> propertyResults(properties.size());
+    std::mutex mutex;
+    std::condition_variable propertyDone;
+    std::atomic<uint64_t> nextProperty(0);
+
+    auto checkProperties = [&](VerificationCallbackType const& verificationCallback) {
+        for (uint64_t index = nextProperty++; index < properties.size(); index = nextProperty++) {
+            auto const& property = properties[index];
+            PropertyResult& propertyResult = propertyResults[index];
+            std::unique_lock<std::mutex> ltlLock = lockIfLtlTranslationRequired(*property.getRawFormula());
+            propertyResult.watch.start();
+            try {
+                propertyResult.result = verifyProperty<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula(), verificationCallback);
+            } catch (...) {
+                propertyResult.exception = std::current_exception();
+            }
+            propertyResult.watch.stop();
+            if (ltlLock.owns_lock()) {
+                ltlLock.unlock();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                propertyResult.done = true;
+            }
+            propertyDone.notify_all();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (auto const& verificationCallback : verificationCallbacks) {
+        threads.emplace_back(checkProperties, std::cref(verificationCallback));
+    }
+    auto joinThreads = [&threads]() {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+
+    try {
+        for (uint64_t index = 0; index < properties.size(); ++index) {
+            PropertyResult& propertyResult = propertyResults[index];
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                propertyDone.wait(lock, [&propertyResult]() { return propertyResult.done; });
+            }
+            if (propertyResult.exception) {
+                std::rethrow_exception(propertyResult.exception);
+            }
+            printModelCheckingProperty(properties[index]);
+            if (propertyResult.result) {
+                postprocessingCallback(propertyResult.result);
+            }
+            printResult<ValueType>(propertyResult.result, properties[index], &propertyResult.watch);
+            // The result is not needed anymore.
+            propertyResult.result.reset();
+        }
+    } catch (...) {
+        // Let the threads finish their current properties before passing on the exception.
+        nextProperty = properties.size();
+        joinThreads();
+        throw;
+    }
+    joinThreads();
+}
+
 /*!
  * Computes values for each state (such as the steady-state probability distribution).
  * If one or more formulas are given, they serve as filter to identify which states are relevant.
@@ -1195,26 +1284,73 @@ template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
-        bool filterForInitialStates = states->isInitialFormula();
-        auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-        if (ioSettings.isExportSchedulerSet()) {
-            task.setProduceSchedulers(true);
-        }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
 
-        std::unique_ptr<storm::modelchecker::CheckResult> filter;
-        if (filterForInitialStates) {
-            filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
-        } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
-            filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+    // If requested, the properties are checked on a model with renumbered states. The results are translated back to the original state indices
+    // before they are filtered, printed or exported.
+    auto checkedModel = sparseModel;
+    std::vector<uint64_t> newToOldStateIndexMapping;
+    auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+    if (transformationSettings.isReorderStatesSet()) {
+        STORM_LOG_INFO("Renumbering states in " << storm::transformer::toString(transformationSettings.getStateOrder()) << " order...");
+        auto permuted = storm::transformer::permuteStates(*sparseModel, transformationSettings.getStateOrder());
+        checkedModel = permuted.model;
+        newToOldStateIndexMapping = std::move(permuted.newToOldStateIndexMapping);
+    }
+    auto translateToOriginalStates = [&newToOldStateIndexMapping](std::unique_ptr<storm::modelchecker::CheckResult>&& result) {
+        if (result && !newToOldStateIndexMapping.empty()) {
+            return storm::transformer::translateToOriginalStates<ValueType>(newToOldStateIndexMapping, *result);
         }
-        if (result && filter) {
-            result->filter(filter->asQualitativeCheckResult());
+        return std::move(result);
+    };
+
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+    uint64_t numberOfThreads = 1;
+    if (modelCheckerSettings.isParallelPropertiesSet()) {
+        numberOfThreads = std::min<uint64_t>(modelCheckerSettings.getNumberOfParallelProperties(), properties.size());
+        // The arithmetic of rational functions is not thread-safe.
+        if (std::is_same<ValueType, storm::RationalFunction>::value && numberOfThreads > 1) {
+            STORM_LOG_WARN("Properties of parametric models can not be checked concurrently. Checking them sequentially.");
+            numberOfThreads = 1;
         }
-        return result;
+    }
+
+    // If several properties are checked sequentially, they share the results of analyses of the model. With concurrent checks, the cache is not used
+    // as the solutions that are used for warm starts would depend on the order in which the threads finish their properties.
+    // Solutions are only stored on request since warm starts may change the results of solution methods that are not sound.
+    std::shared_ptr<storm::modelchecker::SparseAnalysisCache<ValueType>> analysisCache;
+    if (properties.size() > 1 && numberOfThreads == 1) {
+        uint64_t maximalNumberOfStoredSolutions =
+            modelCheckerSettings.isWarmStartSet() ? modelCheckerSettings.getMaximalNumberOfWarmStartSolutions() : 0;
+        analysisCache =
+            std::make_shared<storm::modelchecker::SparseAnalysisCache<ValueType>>(checkedModel->getTransitionMatrix(), maximalNumberOfStoredSolutions);
+    }
+    auto createVerificationCallback = [&sparseModel, &checkedModel, &translateToOriginalStates, &ioSettings,
+                                       &analysisCache](storm::Environment const& env) -> VerificationCallbackType {
+        return [&sparseModel, &checkedModel, &translateToOriginalStates, &ioSettings, &analysisCache, &env](
+                   std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            bool filterForInitialStates = states->isInitialFormula();
+            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+            if (ioSettings.isExportSchedulerSet()) {
+                task.setProduceSchedulers(true);
+            }
+            task.setAnalysisCache(analysisCache);
+            auto result = translateToOriginalStates(storm::api::verifyWithSparseEngine<ValueType>(env, checkedModel, task));
+
+            std::unique_ptr<storm::modelchecker::CheckResult> filter;
+            if (filterForInitialStates) {
+                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+            } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
+                filter = translateToOriginalStates(
+                    storm::api::verifyWithSparseEngine<ValueType>(env, checkedModel, storm::api::createTask<ValueType>(states, false)));
+            }
+            if (result && filter) {
+                result->filter(filter->asQualitativeCheckResult());
+            }
+            return result;
+        };
     };
+    auto verificationCallback = createVerificationCallback(mpi.env);
     uint64_t exportCount = 0;  // this number will be prepended to the export file name of schedulers and/or check results in case of multiple properties.
     auto postprocessingCallback = [&sparseModel, &ioSettings, &input, &exportCount](std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
         if (ioSettings.isExportSchedulerSet()) {
@@ -1256,20 +1392,40 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
         ++exportCount;
     };
     if (!(ioSettings.isComputeSteadyStateDistributionSet() || ioSettings.isComputeExpectedVisitingTimesSet())) {
-        verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+        if (numberOfThreads > 1) {
+            std::vector<storm::Environment> environments = mpi.env.copyPerWorker(numberOfThreads);
+            std::vector<VerificationCallbackType> verificationCallbacks;
+            for (auto const& env : environments) {
+                verificationCallbacks.push_back(createVerificationCallback(env));
+            }
+            prepareForConcurrentAccess(*checkedModel);
+            verifyPropertiesConcurrently<ValueType>(input, verificationCallbacks, postprocessingCallback);
+        } else {
+            verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+        }
     }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
         computeStateValues<ValueType>(
             "steady-state probabilities",
-            [&mpi, &sparseModel]() { return storm::api::computeSteadyStateDistributionWithSparseEngine<ValueType>(mpi.env, sparseModel); }, input,
+            [&mpi, &checkedModel, &translateToOriginalStates]() {
+                return translateToOriginalStates(storm::api::computeSteadyStateDistributionWithSparseEngine<ValueType>(mpi.env, checkedModel));
+            },
+            input,
             verificationCallback, postprocessingCallback);
     }
     if (ioSettings.isComputeExpectedVisitingTimesSet()) {
         computeStateValues<ValueType>(
             "expected visiting times",
-            [&mpi, &sparseModel]() { return storm::api::computeExpectedVisitingTimesWithSparseEngine<ValueType>(mpi.env, sparseModel); }, input,
+            [&mpi, &checkedModel, &translateToOriginalStates]() {
+                return translateToOriginalStates(storm::api::computeExpectedVisitingTimesWithSparseEngine<ValueType>(mpi.env, checkedModel));
+            },
+            input,
             verificationCallback, postprocessingCallback);
     }
+    if (analysisCache && storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        STORM_PRINT("\n");
+        analysisCache->printStatistics(std::cout);
+    }
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -7,6 +7,8 @@
 #include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
 #include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/Environment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -21,6 +23,7 @@
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 #include "storm/utility/cli.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -1274,6 +1277,45 @@ class SMTMinimalLabelSetGenerator {
         return getUsedLabelSet(*solver.getModel(), variableInformation);
     }
 
+    /*!
+     * Finds up to the given number of distinct smallest sets of labels such that the constraint system of the solver is still satisfiable. All returned
+     * sets respect the same bound. The further sets are enumerated in a temporary scope of the solver, so the constraint system is unchanged afterwards.
+     *
+     * @param solver The solver to use for the satisfiability evaluation.
+     * @param variableInformation A structure with information about the variables of the solver.
+     * @param relevancyInformation A structure with relevancy information about the model.
+     * @param currentBound The currently known lower bound for the number of labels that need to be enabled
+     * in order to satisfy the constraint system.
+     * @param maximalNumberOfSets The maximal number of label sets to return.
+     * @return The label sets. The result is empty iff the constraint system is unsatisfiable for all bounds.
+     */
+    static std::vector<storm::storage::FlatSet<uint_fast64_t>> findSmallestCommandSets(storm::solver::SmtSolver& solver,
+                                                                                       VariableInformation& variableInformation,
+                                                                                       RelevancyInformation const& relevancyInformation,
+                                                                                       uint_fast64_t& currentBound, uint64_t maximalNumberOfSets) {
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> result;
+        boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(solver, variableInformation, currentBound);
+        if (smallest == boost::none) {
+            return result;
+        }
+        result.push_back(std::move(smallest.get()));
+
+        if (maximalNumberOfSets > 1) {
+            solver.push();
+            storm::expressions::Expression assumption = !variableInformation.auxiliaryVariables.back();
+            while (result.size() < maximalNumberOfSets) {
+                ruleOutSingleSolution(solver, result.back(), variableInformation, relevancyInformation);
+                if (solver.checkWithAssumptions({assumption}) != storm::solver::SmtSolver::CheckResult::Sat) {
+                    break;
+                }
+                result.push_back(getUsedLabelSet(*solver.getModel(), variableInformation));
+            }
+            solver.pop();
+            STORM_LOG_DEBUG("Enumerated " << result.size() << " label sets with bound " << currentBound << ".");
+        }
+        return result;
+    }
+
     static void ruleOutSingleSolution(storm::solver::SmtSolver& solver, storm::storage::FlatSet<uint_fast64_t> const& labelSet,
                                       VariableInformation& variableInformation, RelevancyInformation const& relevancyInformation) {
         std::vector<storm::expressions::Expression> formulae;
@@ -1692,6 +1734,51 @@ class SMTMinimalLabelSetGenerator {
         return results;
     }
 
+    // A candidate label set together with the result of checking the sub-model it induces.
+    struct CandidateInformation {
+        // The candidate label set, including the known and the don't-care labels.
+        storm::storage::FlatSet<uint_fast64_t> commandSet;
+
+        // The sub-model induced by the candidate and its label sets.
+        std::shared_ptr<storm::models::sparse::Model<T>> subModel;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> subLabelSets;
+
+        // Whether a psi state is reachable from an initial state of the sub-model.
+        bool targetReachable = false;
+
+        // The maximal property values in the sub-model.
+        std::vector<T> maximalPropertyValue;
+    };
+
+    /*!
+     * Restricts the model to the label set of the given candidate and computes the maximal property values in the resulting sub-model.
+     *
+     * @param candidate The candidate whose sub-model is to be checked. The results are stored in the candidate.
+     * @param phiStates A bit vector characterizing all phi states in the model.
+     * @param relevantPhiStates The phi states that need to be considered when searching for a reachable psi state. As the sub-model (for probabilities) only
+     * contains choices of the original model, this may exclude the phi states that can not reach a psi state in the original model.
+     * @param psiStates A bit vector characterizing all psi states in the model.
+     */
+    static void checkCandidate(Environment const& env, CandidateInformation& candidate, storm::models::sparse::Model<T> const& model,
+                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& relevantPhiStates,
+                               storm::storage::BitVector const& psiStates, boost::optional<std::vector<std::string>> const& rewardName) {
+        auto subChoiceOrigins =
+            restrictModelToLabelSet(model, candidate.commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+        candidate.subModel = std::move(subChoiceOrigins.first);
+        candidate.subLabelSets = std::move(subChoiceOrigins.second);
+
+        storm::storage::BitVector reachableStates = storm::utility::graph::getReachableStates(
+            candidate.subModel->getTransitionMatrix(), candidate.subModel->getInitialStates(), relevantPhiStates, psiStates);
+        candidate.targetReachable = !reachableStates.isDisjointFrom(psiStates);
+
+        if (!rewardName && !candidate.targetReachable) {
+            // There is no need to invoke the model checker as no psi state is reachable.
+            candidate.maximalPropertyValue = {storm::utility::zero<T>()};
+        } else {
+            candidate.maximalPropertyValue = computeMaximalReachabilityProbability(env, *candidate.subModel, phiStates, psiStates, rewardName);
+        }
+    }
+
    public:
     struct Options {
         Options(bool checkThresholdFeasible = false) : checkThresholdFeasible(checkThresholdFeasible) {
@@ -1699,11 +1786,17 @@ class SMTMinimalLabelSetGenerator {
 
             encodeReachability = settings.isEncodeReachabilitySet();
             useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+            candidateBatchSize = settings.getCandidateBatchSize();
+            checkCandidatesInParallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
         }
 
         bool checkThresholdFeasible;
         bool encodeReachability;
         bool useDynamicConstraints;
+        // The number of candidate label sets of the same size that are enumerated and checked at once.
+        uint64_t candidateBatchSize;
+        // Whether the candidates of a batch are checked concurrently (requires Intel TBB).
+        bool checkCandidatesInParallel;
         bool silent = false;
         bool addBackwardImplicationCuts = true;
         uint64_t continueAfterFirstCounterexampleUntil = 0;
@@ -1848,15 +1941,31 @@ class SMTMinimalLabelSetGenerator {
         uint_fast64_t iterations = 0;
         uint_fast64_t currentBound = 0;
         uint64_t firstCounterexampleFound = 0;  // The value is not queried before being set.
-        std::vector<double> maximalPropertyValue;
         uint_fast64_t zeroProbabilityCount = 0;
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
-        do {
-            ++iterations;
 
-            if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
-                break;
+        // The sub-models only contain choices of the original model, so states that can not reach a psi state in the original model can not reach one in
+        // any of the sub-models either. This does not hold for reward properties, as the sub-models then redirect states without a valid choice to a psi
+        // state.
+        storm::storage::BitVector relevantPhiStates =
+            rewardName ? phiStates : (phiStates & storm::utility::graph::performProbGreater0E(model.getBackwardTransitions(), phiStates, psiStates));
+
+        bool checkCandidatesInParallel = options.candidateBatchSize > 1 && options.checkCandidatesInParallel;
+#ifndef STORM_HAVE_INTELTBB
+        if (checkCandidatesInParallel) {
+            STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+            checkCandidatesInParallel = false;
+        }
+#endif
+
+        do {
+            uint64_t batchSize = options.candidateBatchSize;
+            if (result.size() > 0) {
+                if (iterations >= firstCounterexampleFound + options.maximumExtraIterations) {
+                    break;
+                }
+                batchSize = std::min<uint64_t>(batchSize, firstCounterexampleFound + options.maximumExtraIterations - iterations);
             }
             if (result.size() == 0) {
                 STORM_LOG_DEBUG("Sanity check to see whether constraint system is still satisfiable.");
@@ -1864,107 +1973,144 @@ class SMTMinimalLabelSetGenerator {
             }
             STORM_LOG_DEBUG("Computing minimal command set.");
             solverClock = std::chrono::high_resolution_clock::now();
-            boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
+            std::vector<storm::storage::FlatSet<uint_fast64_t>> smallest =
+                findSmallestCommandSets(*solver, variableInformation, relevancyInformation, currentBound, batchSize);
             totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
-            if (smallest == boost::none) {
+            if (smallest.empty()) {
                 STORM_LOG_DEBUG("No further counterexamples.");
                 break;
-            } else {
-                commandSet = smallest.get();
             }
-            STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound << " and set of size "
-                                                                   << commandSet.size() + relevancyInformation.knownLabels.size() << " (" << commandSet.size()
-                                                                   << " + " << relevancyInformation.knownLabels.size() << ") ");
 
-            // Restrict the given model to the current set of labels and compute the reachability probability.
-            modelCheckingClock = std::chrono::high_resolution_clock::now();
-            commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
-            commandSet.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
-            if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
-                (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
-                STORM_LOG_DEBUG("No further counterexamples of similar size.");
-                break;
+            // Complete the candidates by the known and the don't-care labels. Only the candidates before the first one that would end the search need to
+            // be checked.
+            std::vector<CandidateInformation> candidates(smallest.size());
+            uint64_t numberOfCandidatesToCheck = candidates.size();
+            for (uint64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+                storm::storage::FlatSet<uint_fast64_t>& candidateSet = candidates[candidateIndex].commandSet;
+                candidateSet = std::move(smallest[candidateIndex]);
+                STORM_LOG_DEBUG("Computed minimal command with bound "
+                                << currentBound << " and set of size " << candidateSet.size() + relevancyInformation.knownLabels.size() << " ("
+                                << candidateSet.size() << " + " << relevancyInformation.knownLabels.size() << ") ");
+                candidateSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
+                candidateSet.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
+                if (numberOfCandidatesToCheck == candidates.size() &&
+                    (candidateSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
+                     (result.size() > 1 && candidateSet.size() > options.multipleCounterexampleSizeCap) || candidateSet.size() == nrCommands(symbolicModel))) {
+                    numberOfCandidatesToCheck = candidateIndex;
+                }
             }
 
-            if (commandSet.size() == nrCommands(symbolicModel)) {
-                result.push_back(commandSet);
-                break;
+            // Restrict the given model to the candidate label sets and compute the reachability probabilities.
+            modelCheckingClock = std::chrono::high_resolution_clock::now();
+            if (checkCandidatesInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfCandidatesToCheck, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    Environment taskEnv(env);
+                    for (uint64_t candidateIndex = range.begin(); candidateIndex < range.end(); ++candidateIndex) {
+                        checkCandidate(taskEnv, candidates[candidateIndex], model, phiStates, relevantPhiStates, psiStates, rewardName);
+                    }
+                });
+#endif
+            } else {
+                for (uint64_t candidateIndex = 0; candidateIndex < numberOfCandidatesToCheck; ++candidateIndex) {
+                    checkCandidate(env, candidates[candidateIndex], model, phiStates, relevantPhiStates, psiStates, rewardName);
+                }
             }
-
-            auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
-            std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
-            std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
-
-            // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
             totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
 
-            // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
-            // process.
-            analysisClock = std::chrono::high_resolution_clock::now();
-            bool violation = false;
-            for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
-                violation |=
-                    (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
-            }
+            // Process the candidates in the order in which they were found and add all learned constraints to the solver.
+            for (auto const& candidate : candidates) {
+                ++iterations;
+                storm::storage::FlatSet<uint_fast64_t> const& candidateSet = candidate.commandSet;
 
-            if (violation) {
-                if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
-                    ++zeroProbabilityCount;
+                if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
+                    done = true;
+                    break;
                 }
 
-                if (options.useDynamicConstraints) {
-                    // Determine which of the two analysis techniques to call by performing a reachability analysis.
-                    storm::storage::BitVector reachableStates =
-                        storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+                if (candidateSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
+                    (result.size() > 1 && candidateSet.size() > options.multipleCounterexampleSizeCap)) {
+                    STORM_LOG_DEBUG("No further counterexamples of similar size.");
+                    done = true;
+                    break;
+                }
 
-                    if (reachableStates.isDisjointFrom(psiStates)) {
-                        // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
-                        analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                       variableInformation, relevancyInformation);
-                    } else {
-                        // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient
-                        // to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
-                        analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                               variableInformation, relevancyInformation);
+                if (candidateSet.size() == nrCommands(symbolicModel)) {
+                    result.push_back(candidateSet);
+                    done = true;
+                    break;
+                }
+                STORM_LOG_ASSERT(candidate.subModel, "Expected the candidate to be checked.");
+                std::vector<T> const& maximalPropertyValue = candidate.maximalPropertyValue;
+
+                // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the
+                // iteration process.
+                analysisClock = std::chrono::high_resolution_clock::now();
+                bool violation = false;
+                for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
+                    violation |=
+                        (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
+                }
+
+                if (violation) {
+                    if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
+                        ++zeroProbabilityCount;
                     }
 
-                    if (relevancyInformation.dontCareLabels.size() > 0) {
-                        ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                    if (options.useDynamicConstraints) {
+                        // Determine which of the two analysis techniques to call based on the reachability analysis of the candidate.
+                        if (!candidate.targetReachable) {
+                            // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
+                            analyzeZeroProbabilitySolution(*solver, *candidate.subModel, candidate.subLabelSets, model, labelSets, phiStates, psiStates,
+                                                           candidateSet, variableInformation, relevancyInformation);
+                        } else {
+                            // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was
+                            // insufficient to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
+                            analyzeInsufficientProbabilitySolution(*solver, *candidate.subModel, candidate.subLabelSets, model, labelSets, phiStates,
+                                                                   psiStates, candidateSet, variableInformation, relevancyInformation);
+                        }
+
+                        if (relevancyInformation.dontCareLabels.size() > 0) {
+                            ruleOutSingleSolution(*solver, candidateSet, variableInformation, relevancyInformation);
+                        }
+                    } else {
+                        // Do not guide solver, just rule out current solution.
+                        ruleOutSingleSolution(*solver, candidateSet, variableInformation, relevancyInformation);
                     }
                 } else {
-                    // Do not guide solver, just rule out current solution.
-                    ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
-                }
-            } else {
-                STORM_LOG_DEBUG("Found a counterexample.");
-                if (result.empty()) {
-                    // If this is the first counterexample we find, we store when we found it.
-                    firstCounterexampleFound = iterations;
+                    STORM_LOG_DEBUG("Found a counterexample.");
+                    if (result.empty()) {
+                        // If this is the first counterexample we find, we store when we found it.
+                        firstCounterexampleFound = iterations;
+                    }
+                    result.push_back(candidateSet);
+                    if (options.maximumCounterexamples > result.size()) {
+                        STORM_LOG_DEBUG("Exclude counterexample for future.");
+                        ruleOutBiggerSolutions(*solver, candidateSet, variableInformation, relevancyInformation);
+                    } else {
+                        STORM_LOG_DEBUG("Stop searching for further counterexamples.");
+                        done = true;
+                    }
+                    smallestCounterexampleSize = std::min(smallestCounterexampleSize, candidateSet.size());
                 }
-                result.push_back(commandSet);
-                if (options.maximumCounterexamples > result.size()) {
-                    STORM_LOG_DEBUG("Exclude counterexample for future.");
-                    ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
-                } else {
-                    STORM_LOG_DEBUG("Stop searching for further counterexamples.");
-                    done = true;
+                totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
+
+                auto now = std::chrono::high_resolution_clock::now();
+                auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                if (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < candidateSet.size()) {
+                    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - totalClock).count();
+                    if (lastSize < candidateSet.size()) {
+                        STORM_LOG_DEBUG("Improved lower bound to " << currentBound << " after " << milliseconds << "ms.");
+                        lastSize = candidateSet.size();
+                    } else {
+                        STORM_LOG_DEBUG("Lower bound on label set size is " << currentBound << " after " << milliseconds << "ms (checked " << iterations
+                                                                            << " models, " << zeroProbabilityCount << " could not reach the target set).");
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                    }
                 }
-                smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
-            }
-            totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
-
-            auto now = std::chrono::high_resolution_clock::now();
-            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
-            if (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < commandSet.size()) {
-                auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - totalClock).count();
-                if (lastSize < commandSet.size()) {
-                    STORM_LOG_DEBUG("Improved lower bound to " << currentBound << " after " << milliseconds << "ms.");
-                    lastSize = commandSet.size();
-                } else {
-                    STORM_LOG_DEBUG("Lower bound on label set size is " << currentBound << " after " << milliseconds << "ms (checked " << iterations
-                                                                        << " models, " << zeroProbabilityCount << " could not reach the target set).");
-                    timeOfLastMessage = std::chrono::high_resolution_clock::now();
+
+                if (done) {
+                    break;
                 }
             }
         } while (!done);
@@ -21,6 +21,7 @@ const std::string CounterexampleGeneratorSettings::minimalCommandMethodOptionNam
 const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
 const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
 const std::string CounterexampleGeneratorSettings::noDynamicConstraintsOptionName = "nodyn";
+const std::string CounterexampleGeneratorSettings::candidateBatchSizeOptionName = "candidatebatch";
 
 CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false,
@@ -64,6 +65,14 @@ CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSetti
                                                    "Disables the generation of dynamic constraints in the MAXSAT-based counterexample generation.")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, candidateBatchSizeOptionName, true,
+                                                   "Sets how many candidate label sets the MAXSAT-based technique enumerates and checks at once.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of candidates per batch.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool CounterexampleGeneratorSettings::isCounterexampleSet() const {
@@ -106,6 +115,10 @@ bool CounterexampleGeneratorSettings::isUseDynamicConstraintsSet() const {
     return !this->getOption(noDynamicConstraintsOptionName).getHasOptionBeenSet();
 }
 
+uint64_t CounterexampleGeneratorSettings::getCandidateBatchSize() const {
+    return this->getOption(candidateBatchSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
 bool CounterexampleGeneratorSettings::check() const {
     STORM_LOG_THROW(isCounterexampleSet() || !isCounterexampleTypeSet(), storm::exceptions::InvalidSettingsException,
                     "Counterexample type was set but counterexample flag '-cex' is missing.");
@@ -120,6 +133,8 @@ bool CounterexampleGeneratorSettings::check() const {
                             "Encoding reachability is only available for the MaxSat-based minimal command set generation, so selecting it has no effect.");
         STORM_LOG_WARN_COND(isUseMilpBasedMinimalCommandSetGenerationSet() || !isUseSchedulerCutsSet(),
                             "Using scheduler cuts is only available for the MaxSat-based minimal command set generation, so selecting it has no effect.");
+        STORM_LOG_WARN_COND(isUseMaxSatBasedMinimalCommandSetGenerationSet() || getCandidateBatchSize() == 1,
+                            "Checking batches of candidates is only available for the MaxSat-based minimal command set generation, so it has no effect.");
     }
 
     return true;
@@ -3,6 +3,7 @@
 #include "storm-conv/api/storm-conv.h"
 #include "storm-conv/settings/modules/JaniExportSettings.h"
 #include "storm-dft/settings/modules/DftGspnSettings.h"
+#include "storm-dft/settings/modules/DftIOSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
 
 #include <memory>
@@ -54,6 +55,9 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
                 std::cout << "Property \"" << properties.at(i)->toString() << "\" has result " << probabilities.at(i) << '\n';
             }
         }
+        if (storm::settings::getModule<storm::dft::settings::modules::DftIOSettings>().isShowDftStatisticsSet()) {
+            checker.printModuleStatistics();
+        }
         return;
     } else {
         STORM_LOG_THROW(dft->nrDynamicElements() == 0, storm::exceptions::NotSupportedException,
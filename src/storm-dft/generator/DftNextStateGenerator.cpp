@@ -108,6 +108,7 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             newState = createSuccessorState(this->state, dependency, true);
 
             auto [newStateId, shouldStop] = getNewStateId(newState, stateToIdCallback);
+            recycleState(newState);
             if (shouldStop) {
                 continue;
             }
@@ -124,6 +125,7 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
                 DFTStatePointer unsuccessfulState = createSuccessorState(this->state, dependency, false);
                 // Add state
                 StateType unsuccessfulStateId = stateToIdCallback(unsuccessfulState);
+                recycleState(unsuccessfulState);
                 ValueType remainingProbability = storm::utility::one<ValueType>() - probability;
                 choice.addProbability(unsuccessfulStateId, remainingProbability);
                 STORM_LOG_TRACE("Added transition to " << unsuccessfulStateId << " with remaining probability " << remainingProbability);
@@ -150,6 +152,7 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             newState = createSuccessorState(this->state, nextBE);
 
             auto [newStateId, shouldStop] = getNewStateId(newState, stateToIdCallback);
+            recycleState(newState);
             if (shouldStop) {
                 continue;
             }
@@ -204,12 +207,32 @@ std::pair<StateType, bool> DftNextStateGenerator<ValueType, StateType>::getNewSt
     }
 }
 
+template<typename ValueType, typename StateType>
+typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::copyState(
+    DFTStatePointer const& state) const {
+    if (mStatePool.empty()) {
+        return state->copy();
+    }
+    DFTStatePointer newState = std::move(mStatePool.back());
+    mStatePool.pop_back();
+    newState->copyFrom(*state);
+    return newState;
+}
+
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::recycleState(DFTStatePointer& state) const {
+    if (state && state.use_count() == 1) {
+        mStatePool.push_back(std::move(state));
+    }
+    state.reset();
+}
+
 template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
     DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency,
     bool dependencySuccessful) const {
     // Construct new state as copy from original one
-    DFTStatePointer newState = origState->copy();
+    DFTStatePointer newState = copyState(origState);
 
     if (dependencySuccessful) {
         // Dependency was successful -> dependent BE fails
@@ -220,7 +243,10 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
         STORM_LOG_ASSERT(dependency->dependentEvents().front()->isBasicElement(),
                          "Trigger event " << dependency->dependentEvents().front()->name() << " is not a BE.");
         auto trigger = std::static_pointer_cast<storm::dft::storage::elements::DFTBE<ValueType> const>(dependency->dependentEvents().front());
-        return createSuccessorState(newState, trigger);
+        DFTStatePointer successorState = createSuccessorState(newState, trigger);
+        // The intermediate state is not needed anymore
+        recycleState(newState);
+        return successorState;
     } else {
         // Dependency was unsuccessful -> no BE fails
         STORM_LOG_TRACE("With the unsuccessful triggering of PDEP " << dependency->name() << " [" << dependency->id() << "]"
@@ -234,14 +260,15 @@ template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
     DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
     // Construct new state as copy from original one
-    DFTStatePointer newState = origState->copy();
+    DFTStatePointer newState = copyState(origState);
 
     STORM_LOG_TRACE("With the failure of " << be->name() << " [" << be->id() << "]"
                                            << " in " << mDft.getStateString(origState));
     newState->letBEFail(be);
 
     // Propagate
-    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType> queues;
+    auto& queues = mQueues;
+    queues.clear();
     propagateFailure(newState, be, queues);
 
     // Check whether transient failure lead to TLE failure
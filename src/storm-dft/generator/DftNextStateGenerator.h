@@ -120,6 +120,23 @@ class DftNextStateGenerator {
      */
     std::pair<StateType, bool> getNewStateId(DFTStatePointer state, StateToIdCallback const& stateToIdCallback) const;
 
+    /*!
+     * Create a copy of the given state.
+     * The copy reuses a previously recycled state if available to avoid allocations.
+     *
+     * @param state State to copy.
+     * @return Copy of the state.
+     */
+    DFTStatePointer copyState(DFTStatePointer const& state) const;
+
+    /*!
+     * Recycle the given state for later copies if it is not referenced anywhere else, e.g., in the state storage of the builder.
+     * The given pointer is reset afterwards.
+     *
+     * @param state State which is no longer needed by the generator.
+     */
+    void recycleState(DFTStatePointer& state) const;
+
     // The dft used for the generation of next states.
     storm::dft::storage::DFT<ValueType> const& mDft;
 
@@ -137,6 +154,13 @@ class DftNextStateGenerator {
 
     // Flag indicating whether only the first dependency (instead of all) should be explored.
     bool mTakeFirstDependency = false;
+
+    // States which are not referenced anymore and can be overwritten by the next successor state.
+    // As each recycled state replaces a new allocation, the pool only contains the few states released during one expansion.
+    mutable std::vector<DFTStatePointer> mStatePool;
+
+    // Queues for the propagation of failures, which are reused for all successor states.
+    mutable storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType> mQueues;
 };
 
 }  // namespace generator
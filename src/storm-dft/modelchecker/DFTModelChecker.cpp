@@ -505,6 +505,20 @@ void DFTModelChecker<ValueType>::printTimings(std::ostream& os) {
     os << "Total:\t\t" << totalTimer << '\n';
 }
 
+template<typename ValueType>
+storm::utility::Stopwatch DFTModelChecker<ValueType>::getBuildingTime() const {
+    storm::utility::Stopwatch result = explorationTimer;
+    result.add(buildingTimer);
+    return result;
+}
+
+template<typename ValueType>
+storm::utility::Stopwatch DFTModelChecker<ValueType>::getModelCheckingTime() const {
+    storm::utility::Stopwatch result = modelCheckingTimer;
+    result.add(bisimulationTimer);
+    return result;
+}
+
 template<typename ValueType>
 void DFTModelChecker<ValueType>::printResults(dft_results const& results, std::ostream& os) {
     bool first = true;
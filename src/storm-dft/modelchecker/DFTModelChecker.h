@@ -66,6 +66,20 @@ class DFTModelChecker {
      */
     void printTimings(std::ostream& os = std::cout);
 
+    /*!
+     * Get the accumulated time for exploring and building the models.
+     *
+     * @return Stopwatch containing the exploration and building time.
+     */
+    storm::utility::Stopwatch getBuildingTime() const;
+
+    /*!
+     * Get the accumulated time for model checking the models (including bisimulation).
+     *
+     * @return Stopwatch containing the model checking time.
+     */
+    storm::utility::Stopwatch getModelCheckingTime() const;
+
     /*!
      * Print result to stream.
      *
@@ -10,15 +10,18 @@
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
 template<typename ValueType>
 DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+    : dft{dft}, sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -26,6 +29,11 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    for (auto const& mod : dynamicModules) {
+        ModuleStatistics statistics;
+        statistics.name = dft->getElement(mod.getRepresentative())->name();
+        moduleStatistics.push_back(std::move(statistics));
+    }
 }
 
 template<typename ValueType>
@@ -69,10 +77,37 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    // First analyse all dynamic modules.
+    // The modules are independent of each other and can thus be analysed concurrently.
+    bool analyseConcurrently = dynamicModules.size() > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifndef STORM_HAVE_INTELTBB
+    if (analyseConcurrently) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        analyseConcurrently = false;
+    }
+#endif
+    std::vector<typename DFTModelChecker<ValueType>::dft_results> moduleResults(dynamicModules.size());
+    auto analyseModule = [&](size_t index) {
+        STORM_LOG_DEBUG("Analyse dynamic module " << dynamicModules[index].toString(*dft));
+        // Model information is only printed if it cannot interleave with the output of other modules.
+        moduleResults[index] = analyseDynamicModule(dynamicModules[index], timepoints, moduleStatistics[index], !analyseConcurrently);
+    };
+    if (analyseConcurrently) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, dynamicModules.size(), 1), [&](tbb::blocked_range<size_t> const& range) {
+            for (size_t index = range.begin(); index < range.end(); ++index) {
+                analyseModule(index);
+            }
+        });
+#endif
+    } else {
+        for (size_t index = 0; index < dynamicModules.size(); ++index) {
+            analyseModule(index);
+        }
+    }
+
+    for (size_t index = 0; index < dynamicModules.size(); ++index) {
+        auto const& result = moduleResults[index];
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
         for (size_t i{0}; i < timepoints.size(); ++i) {
@@ -80,7 +115,7 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
             auto const timebound{timepoints[i]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[index].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,7 +158,7 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints, ModuleStatistics& statistics, bool printInfo) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
@@ -136,7 +171,25 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftMo
     }
     auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
 
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    // Use a separate model checker (with its own builder and environment) for each module
+    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker(printInfo);
+    auto results = modelchecker.check(subDft, props, false, false, {});
+    statistics.buildingTime.add(modelchecker.getBuildingTime());
+    statistics.modelCheckingTime.add(modelchecker.getModelCheckingTime());
+    return results;
+}
+
+template<typename ValueType>
+std::vector<typename DftModularizationChecker<ValueType>::ModuleStatistics> const& DftModularizationChecker<ValueType>::getModuleStatistics() const {
+    return moduleStatistics;
+}
+
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::printModuleStatistics(std::ostream& os) const {
+    os << "Dynamic modules: " << moduleStatistics.size() << '\n';
+    for (auto const& statistics : moduleStatistics) {
+        os << "Module " << statistics.name << ":\tBuilding: " << statistics.buildingTime << "\tModelchecking: " << statistics.modelCheckingTime << '\n';
+    }
 }
 
 // Explicitly instantiate the class.
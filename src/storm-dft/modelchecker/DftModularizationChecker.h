@@ -1,6 +1,8 @@
 #pragma once
 
+#include <iostream>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "storm-dft/modelchecker/DFTModelChecker.h"
@@ -8,6 +10,7 @@
 #include "storm-dft/storage/DftModule.h"
 #include "storm-dft/storage/SylvanBddManager.h"
 #include "storm/logic/Formula.h"
+#include "storm/utility/Stopwatch.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -16,6 +19,8 @@ namespace modelchecker {
  * DFT analysis via modularization.
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
  * The resulting (static) fault tree is then analyzed via BDDs.
+ * Independent dynamic modules are analyzed concurrently if Intel TBB is enabled.
+ * The BDD manager is only used by the thread calling the public functions.
  *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
  */
@@ -25,6 +30,18 @@ class DftModularizationChecker {
     using DFTElementCPointer = std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const>;
     using FormulaVector = typename DFTModelChecker<ValueType>::property_vector;
 
+    /*!
+     * Statistics for the analysis of a single dynamic module.
+     */
+    struct ModuleStatistics {
+        // Name of the top element of the module.
+        std::string name;
+        // Time for exploring and building the Markov model of the module.
+        storm::utility::Stopwatch buildingTime;
+        // Time for model checking the Markov model of the module.
+        storm::utility::Stopwatch modelCheckingTime;
+    };
+
     /*!
      * Initializes and computes all modules.
      * @param dft DFT.
@@ -58,6 +75,18 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * Get the statistics of all dynamic modules, accumulated over all analyses so far.
+     * @return Statistics for each dynamic module.
+     */
+    std::vector<ModuleStatistics> const &getModuleStatistics() const;
+
+    /*!
+     * Print the statistics of all dynamic modules.
+     * @param os Output stream to write to.
+     */
+    void printModuleStatistics(std::ostream &os = std::cout) const;
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -74,21 +103,25 @@ class DftModularizationChecker {
 
     /*!
      * Analyse the given dynamic module.
+     * Only accesses the given statistics and the (unmodified) DFT. Thus, different modules can be analysed concurrently.
      * @param module Module.
      * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param statistics Statistics of the module which are updated.
+     * @param printInfo Whether the model checker should print information about the model.
      */
     typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+                                                                                                    std::vector<ValueType> const &timepoints,
+                                                                                                    ModuleStatistics &statistics, bool printInfo) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
-    // DFT modelchecker
-    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker;
     // don't reinitialize Sylvan BDD
     // temporary
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Statistics for each dynamic module
+    std::vector<ModuleStatistics> moduleStatistics;
 };
 
 }  // namespace modelchecker
@@ -1,11 +1,18 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/eigen.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -113,127 +120,126 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
     return birnbaumFactor;
 }
 
+/**
+ * A read-only copy of a bdd that stores the nodes in an array.
+ * It can be traversed concurrently without accessing sylvan
+ * and allows to use arrays instead of hash maps as memoization tables.
+ */
+struct FlatBdd {
+    // Index 0 is the zero terminal and index 1 is the one terminal.
+    // The children of a node always have a smaller index than the node itself.
+    std::vector<uint32_t> variables{0, 0};
+    std::vector<size_t> thenIndices{0, 1};
+    std::vector<size_t> elseIndices{0, 1};
+    size_t rootIndex{0};
+
+    size_t size() const {
+        return variables.size();
+    }
+};
+
 /**
  * \returns
- * The probabilities that the bdd is true
- * given the probabilities that the variables are true.
- *
- * \param chunksize
- * The width of the Eigen Arrays
- *
- * \param bdd
- * The bdd for which to calculate the probabilities
- *
- * \param indexToProbabilities
- * A reference to a mapping
- * that must map every variable in the bdd to probabilities
- *
- * \param bddToProbabilities
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \note
- * Great care was made that all pointers
- * are valid elements in bddToProbabilities.
- *
+ * The index of the given bdd in the flat bdd.
+ * Adds the bdd and its sub bdds if they are not yet contained.
  */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToProbabilities.find(bddId)};
-    if (it != bddToProbabilities.end() && it->second.first) {
-        return &it->second.second;
+size_t recursiveFlatten(Bdd const bdd, FlatBdd &flatBdd, std::unordered_map<uint64_t, size_t> &bddToIndex) {
+    if (bdd.isZero()) {
+        return 0;
+    } else if (bdd.isOne()) {
+        return 1;
     }
 
-    auto &bddToProbabilitiesElement{bddToProbabilities[bddId]};
-    if (bdd.isOne()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 1);
-        return &bddToProbabilitiesElement.second;
-    } else if (bdd.isZero()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToProbabilitiesElement.second;
+    auto const it{bddToIndex.find(bdd.GetBDD())};
+    if (it != bddToIndex.end()) {
+        return it->second;
     }
 
-    auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-    auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
+    auto const thenIndex{recursiveFlatten(bdd.Then(), flatBdd, bddToIndex)};
+    auto const elseIndex{recursiveFlatten(bdd.Else(), flatBdd, bddToIndex)};
 
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+    auto const index{flatBdd.size()};
+    flatBdd.variables.push_back(bdd.TopVar());
+    flatBdd.thenIndices.push_back(thenIndex);
+    flatBdd.elseIndices.push_back(elseIndex);
+    bddToIndex[bdd.GetBDD()] = index;
+    return index;
+}
 
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    bddToProbabilitiesElement.first = true;
-    bddToProbabilitiesElement.second = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
-    return &bddToProbabilitiesElement.second;
+FlatBdd flatten(Bdd const &bdd) {
+    FlatBdd flatBdd{};
+    std::unordered_map<uint64_t, size_t> bddToIndex{};
+    flatBdd.rootIndex = recursiveFlatten(bdd, flatBdd, bddToIndex);
+    return flatBdd;
 }
 
 /**
- * \returns
- * The birnbaum importance factors of the given variable
+ * Computes the probabilities that the nodes of the flat bdd are true
+ * given the probabilities that the variables are true.
  *
  * \param chunksize
  * The width of the Eigen Arrays
  *
- * \param bdd
- * The bdd for which to calculate the factors
+ * \param variableToProbabilities
+ * Must map every variable in the bdd to probabilities
  *
- * \param variableIndex
- * The index of the variable the birnbaum factors should be calculated
+ * \param probabilities
+ * Memoization table that is filled with the probabilities of all nodes
+ */
+void computeProbabilities(size_t const chunksize, FlatBdd const &flatBdd, std::vector<Eigen::ArrayXd> const &variableToProbabilities,
+                          std::vector<Eigen::ArrayXd> &probabilities) {
+    probabilities.resize(flatBdd.size());
+    probabilities[0] = Eigen::ArrayXd::Constant(chunksize, 0);
+    probabilities[1] = Eigen::ArrayXd::Constant(chunksize, 1);
+    for (size_t node{2}; node < flatBdd.size(); ++node) {
+        auto const &currentProbabilities{variableToProbabilities[flatBdd.variables[node]]};
+        // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+        probabilities[node] =
+            currentProbabilities * probabilities[flatBdd.thenIndices[node]] + (1 - currentProbabilities) * probabilities[flatBdd.elseIndices[node]];
+    }
+}
+
+/**
+ * Computes the birnbaum importance factors of all variables in a single pass.
  *
- * \param indexToProbability
- * A reference to a mapping
- * that must map every variable in the bdd to a probabilities
+ * The birnbaum factor of x is the derivative of P(bdd) w.r.t. P(x).
+ * As every path contains x at most once, it is the sum of
+ * P(reach n) * (P(Then(n)) - P(Else(n))) over all nodes n labeled with x.
+ * The reachability probabilities are propagated from the root downwards.
  *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param probabilities
+ * The probabilities of all nodes as computed by computeProbabilities
  *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param reachabilityProbabilities
+ * Memoization table for the probabilities of reaching the nodes from the root
+ *
+ * \param variableToBirnbaumFactors
+ * Is filled with the birnbaum factors of all variables.
+ * Variables that do not occur in the bdd have factor 0.
  */
-Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToBirnbaumFactors.find(bddId)};
-    if (it != bddToBirnbaumFactors.end() && it->second.first) {
-        return &it->second.second;
+void computeBirnbaumFactors(size_t const chunksize, FlatBdd const &flatBdd, std::vector<Eigen::ArrayXd> const &variableToProbabilities,
+                            std::vector<Eigen::ArrayXd> const &probabilities, std::vector<Eigen::ArrayXd> &reachabilityProbabilities,
+                            std::vector<Eigen::ArrayXd> &variableToBirnbaumFactors) {
+    variableToBirnbaumFactors.assign(variableToProbabilities.size(), Eigen::ArrayXd::Constant(chunksize, 0));
+    if (flatBdd.rootIndex < 2) {
+        return;
     }
-
-    auto &bddToBirnbaumFactorsElement{bddToBirnbaumFactors[bddId]};
-    if (bdd.isTerminal() || bdd.TopVar() > variableIndex) {
-        // return vector 0;
-        bddToBirnbaumFactorsElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToBirnbaumFactorsElement.second;
+    STORM_LOG_ASSERT(flatBdd.rootIndex + 1 == flatBdd.size(), "Expected the root to be the last node.");
+    reachabilityProbabilities.assign(flatBdd.size(), Eigen::ArrayXd::Constant(chunksize, 0));
+    reachabilityProbabilities[flatBdd.rootIndex] = Eigen::ArrayXd::Constant(chunksize, 1);
+
+    // Parents have larger indices than their children
+    for (size_t node{flatBdd.rootIndex}; node >= 2; --node) {
+        auto const currentVar{flatBdd.variables[node]};
+        auto const &currentProbabilities{variableToProbabilities[currentVar]};
+        auto const &reachabilityProbability{reachabilityProbabilities[node]};
+        auto const thenIndex{flatBdd.thenIndices[node]};
+        auto const elseIndex{flatBdd.elseIndices[node]};
+
+        variableToBirnbaumFactors[currentVar] += reachabilityProbability * (probabilities[thenIndex] - probabilities[elseIndex]);
+        reachabilityProbabilities[thenIndex] += reachabilityProbability * currentProbabilities;
+        reachabilityProbabilities[elseIndex] += reachabilityProbability * (1 - currentProbabilities);
     }
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-        bddToBirnbaumFactorsElement.first = true;
-        bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
-        return &bddToBirnbaumFactorsElement.second;
-    }
-
-    // currentVar < variableIndex
-    auto const &thenBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Then(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-    auto const &elseBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Else(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-    bddToBirnbaumFactorsElement.first = true;
-    bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
-    return &bddToBirnbaumFactorsElement.second;
 }
 }  // namespace
 
@@ -287,51 +293,117 @@ std::vector<std::vector<uint32_t>> SFTBDDChecker::getMinimalCutSetsAsIndices() {
 
 template<typename FuncType>
 void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const {
+    bool calculateConcurrently{storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()};
+#ifndef STORM_HAVE_INTELTBB
+    if (calculateConcurrently) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        calculateConcurrently = false;
+    }
+#endif
+
+    if (timepoints.empty()) {
+        return;
+    }
     if (chunksize == 0) {
         chunksize = timepoints.size();
+#ifdef STORM_HAVE_INTELTBB
+        if (calculateConcurrently) {
+            // Give each thread a chunk
+            auto const numberOfThreads{static_cast<size_t>(storm::utility::getNumberOfThreads())};
+            chunksize = (timepoints.size() + numberOfThreads - 1) / numberOfThreads;
+        }
+#endif
     }
-
-    // caches
-    auto const basicElements{getDFT()->getBasicElements()};
-    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
-
-    // The current timepoints we calculate with
-    Eigen::ArrayXd timepointsArray{chunksize};
-
-    for (size_t currentIndex{0}; currentIndex < timepoints.size(); currentIndex += chunksize) {
-        auto const sizeLeft{timepoints.size() - currentIndex};
-        if (sizeLeft < chunksize) {
-            chunksize = sizeLeft;
-            timepointsArray = Eigen::ArrayXd{chunksize};
+    size_t const numberOfChunks{(timepoints.size() + chunksize - 1) / chunksize};
+
+    // Gather the information about the basic elements on the calling thread
+    struct BasicElementInformation {
+        std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be;
+        uint32_t index;
+        bool isExponential;
+        ValueType failureRate;
+    };
+    std::vector<BasicElementInformation> basicElements{};
+    uint32_t numberOfVariables{0};
+    for (auto const &be : getDFT()->getBasicElements()) {
+        BasicElementInformation info{be, getSylvanBddManager()->getIndex(be->name()), false, 0};
+        if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
+            info.isExponential = true;
+            info.failureRate = std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType> const>(be)->activeFailureRate();
         }
+        numberOfVariables = std::max(numberOfVariables, info.index + 1);
+        basicElements.push_back(std::move(info));
+    }
 
-        // Update current timepoints
-        for (size_t i{currentIndex}; i < currentIndex + chunksize; ++i) {
-            timepointsArray(i - currentIndex) = timepoints[i];
+    auto calculateChunk = [&](size_t const chunk) {
+        auto const chunkBegin{chunk * chunksize};
+        auto const currentChunksize{std::min(chunksize, timepoints.size() - chunkBegin)};
+
+        // The current timepoints we calculate with
+        Eigen::ArrayXd timepointsArray{currentChunksize};
+        for (size_t i{0}; i < currentChunksize; ++i) {
+            timepointsArray(i) = timepoints[chunkBegin + i];
         }
 
-        // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
+        // The probabilities of the basic elements
+        std::vector<Eigen::ArrayXd> variableToProbabilities(numberOfVariables);
+        for (auto const &info : basicElements) {
             // Vectorize known BETypes
             // fallback to getUnreliability() otherwise
-            if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
-                auto const failureRate{std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType>>(be)->activeFailureRate()};
-
+            if (info.isExponential) {
                 // exponential distribution
                 // p(T <= t) = 1 - exp(-lambda*t)
-                indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
+                variableToProbabilities[info.index] = 1 - (-info.failureRate * timepointsArray).exp();
             } else {
-                auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
-                    probabilities(i) = be->getUnreliability(timepointsArray(i));
+                Eigen::ArrayXd probabilities{currentChunksize};
+                for (size_t i{0}; i < currentChunksize; ++i) {
+                    probabilities(i) = info.be->getUnreliability(timepointsArray(i));
                 }
-                indexToProbabilities[beIndex] = probabilities;
+                variableToProbabilities[info.index] = std::move(probabilities);
             }
         }
 
-        func(chunksize, timepointsArray, indexToProbabilities);
+        func(chunkBegin, currentChunksize, variableToProbabilities);
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (calculateConcurrently && numberOfChunks > 1) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numberOfChunks, 1), [&](tbb::blocked_range<size_t> const &range) {
+            for (size_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                calculateChunk(chunk);
+            }
+        });
+        return;
+    }
+#endif
+    for (size_t chunk{0}; chunk < numberOfChunks; ++chunk) {
+        calculateChunk(chunk);
+    }
+}
+
+template<typename FuncType>
+void SFTBDDChecker::importanceMeasuresCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) {
+    auto const flatBdd{flatten(getTopLevelElementBdd())};
+    std::vector<uint32_t> basicElementIndices{};
+    for (auto const &be : getDFT()->getBasicElements()) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
     }
+
+    chunkCalculationTemplate(timepoints, chunksize, [&](size_t const chunkBegin, size_t const currentChunksize, auto const &variableToProbabilities) {
+        // Memoization tables of this chunk
+        std::vector<Eigen::ArrayXd> probabilities{};
+        std::vector<Eigen::ArrayXd> reachabilityProbabilities{};
+        std::vector<Eigen::ArrayXd> variableToBirnbaumFactors{};
+
+        computeProbabilities(currentChunksize, flatBdd, variableToProbabilities, probabilities);
+        computeBirnbaumFactors(currentChunksize, flatBdd, variableToProbabilities, probabilities, reachabilityProbabilities, variableToBirnbaumFactors);
+
+        auto const &probabilitiesArray{probabilities[flatBdd.rootIndex]};
+        for (size_t basicElementIndex{0}; basicElementIndex < basicElementIndices.size(); ++basicElementIndex) {
+            auto const index{basicElementIndices[basicElementIndex]};
+            func(basicElementIndex, chunkBegin, variableToProbabilities[index], probabilitiesArray, variableToBirnbaumFactors[index]);
+        }
+    });
 }
 
 ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound) const {
@@ -347,23 +419,18 @@ ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound)
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::vector<ValueType> resultProbabilities{};
-    resultProbabilities.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    auto const flatBdd{flatten(bdd)};
+    std::vector<ValueType> resultProbabilities(timepoints.size());
 
-        // Great care was made so that the pointer returned is always valid
-        // and points to an element in bddToProbabilities
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](size_t const chunkBegin, size_t const currentChunksize, auto const &variableToProbabilities) {
+        // Memoization table of this chunk
+        std::vector<Eigen::ArrayXd> probabilities{};
+        computeProbabilities(currentChunksize, flatBdd, variableToProbabilities, probabilities);
 
         // Update result Probabilities
+        auto const &probabilitiesArray{probabilities[flatBdd.rootIndex]};
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultProbabilities.push_back(probabilitiesArray(i));
+            resultProbabilities[chunkBegin + i] = probabilitiesArray(i);
         }
     });
 
@@ -391,26 +458,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const values{getAllImportanceMeasuresAtTimepoints({timebound}, 1, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(values.size());
+    for (auto const &beValues : values) {
+        resultVector.push_back(beValues[0]);
     }
     return resultVector;
 }
@@ -418,35 +471,23 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<ValueType> resultVector{};
-    resultVector.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
-        }
-
-        // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-        auto const &birnbaumFactorsArray{
-            *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-        auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-        auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
-
-        // Update result Probabilities
-        for (size_t i{0}; i < currentChunksize; ++i) {
-            resultVector.push_back(ImportanceMeasureArray(i));
-        }
-    });
+    auto const basicElements{getDFT()->getBasicElements()};
+    auto const beIt{std::find_if(basicElements.begin(), basicElements.end(), [&beName](auto const &be) { return be->name() == beName; })};
+    STORM_LOG_THROW(beIt != basicElements.end(), storm::exceptions::InvalidArgumentException, "No basic event with name '" << beName << "' exists.");
+    auto const beIndex{static_cast<size_t>(std::distance(basicElements.begin(), beIt))};
+    std::vector<ValueType> resultVector(timepoints.size());
+
+    importanceMeasuresCalculationTemplate(timepoints, chunksize,
+                                          [&](size_t const basicElementIndex, size_t const chunkBegin, auto const &beProbabilitiesArray,
+                                              auto const &probabilitiesArray, auto const &birnbaumFactorsArray) {
+                                              if (basicElementIndex != beIndex) {
+                                                  return;
+                                              }
+                                              Eigen::ArrayXd const importanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+                                              for (Eigen::Index i{0}; i < importanceMeasureArray.size(); ++i) {
+                                                  resultVector[chunkBegin + i] = importanceMeasureArray(i);
+                                              }
+                                          });
 
     return resultVector;
 }
@@ -454,48 +495,16 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    auto const basicElements{getDFT()->getBasicElements()};
+    std::vector<std::vector<ValueType>> resultVector(getDFT()->getBasicElements().size(), std::vector<ValueType>(timepoints.size()));
 
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
-    }
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-
-        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-            auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-
-            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
-
-            // Update result Probabilities
-            for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
-            }
-        }
-    });
+    importanceMeasuresCalculationTemplate(timepoints, chunksize,
+                                          [&](size_t const basicElementIndex, size_t const chunkBegin, auto const &beProbabilitiesArray,
+                                              auto const &probabilitiesArray, auto const &birnbaumFactorsArray) {
+                                              Eigen::ArrayXd const importanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+                                              for (Eigen::Index i{0}; i < importanceMeasureArray.size(); ++i) {
+                                                  resultVector[basicElementIndex][chunkBegin + i] = importanceMeasureArray(i);
+                                              }
+                                          });
 
     return resultVector;
 }
@@ -539,6 +548,29 @@ struct RRWFunctor {
 
 }  // namespace
 
+SFTBDDChecker::ImportanceMeasures SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize) {
+    std::vector<std::vector<ValueType>> const initialValues(getDFT()->getBasicElements().size(), std::vector<ValueType>(timepoints.size()));
+    ImportanceMeasures result{initialValues, initialValues, initialValues, initialValues, initialValues};
+
+    importanceMeasuresCalculationTemplate(
+        timepoints, chunksize,
+        [&](size_t const basicElementIndex, size_t const chunkBegin, auto const &beProbabilitiesArray, auto const &probabilitiesArray,
+            auto const &birnbaumFactorsArray) {
+            auto storeValues = [&](std::vector<std::vector<ValueType>> &values, Eigen::ArrayXd const &importanceMeasureArray) {
+                for (Eigen::Index i{0}; i < importanceMeasureArray.size(); ++i) {
+                    values[basicElementIndex][chunkBegin + i] = importanceMeasureArray(i);
+                }
+            };
+            storeValues(result.birnbaumFactors, BirnbaumFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+            storeValues(result.CIFs, CIFFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+            storeValues(result.DIFs, DIFFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+            storeValues(result.RAWs, RAWFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+            storeValues(result.RRWs, RRWFunctor{}(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray));
+        });
+
+    return result;
+}
+
 ValueType SFTBDDChecker::getBirnbaumFactorAtTimebound(std::string const &beName, ValueType timebound) {
     return getImportanceMeasureAtTimebound(beName, timebound, BirnbaumFunctor{});
 }
@@ -24,6 +24,19 @@ class SFTBDDChecker {
     using ValueType = double;
     using Bdd = sylvan::Bdd;
 
+    /**
+     * The importance measures of all basic events.
+     * The outer vectors are sorted after the order of dft->getBasicElements,
+     * the inner vectors after the order of the timepoints.
+     */
+    struct ImportanceMeasures {
+        std::vector<std::vector<ValueType>> birnbaumFactors;
+        std::vector<std::vector<ValueType>> CIFs;
+        std::vector<std::vector<ValueType>> DIFs;
+        std::vector<std::vector<ValueType>> RAWs;
+        std::vector<std::vector<ValueType>> RRWs;
+    };
+
     SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft,
                   std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager = std::make_shared<storm::dft::storage::SylvanBddManager>());
 
@@ -117,6 +130,10 @@ class SFTBDDChecker {
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
      * A value of 0 represents to calculate the whole array at once.
+     *
+     * \note
+     * If Intel TBB is enabled, the chunks are calculated concurrently
+     * and a value of 0 gives one chunk to each thread.
      */
     std::vector<ValueType> getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize = 0) const;
 
@@ -340,6 +357,20 @@ class SFTBDDChecker {
      */
     std::vector<std::vector<ValueType>> getAllRRWsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
+    /**
+     * \return
+     * The birnbaum factor, CIF, DIF, RAW and RRW of all basic events.
+     * All measures are calculated in a single pass over the bdd.
+     *
+     * \param timepoints
+     * Array of timebounds to calculate the measures for.
+     *
+     * \param chunksize
+     * Splits the timepoints array into chunksize chunks.
+     * A value of 0 represents to calculate the whole array at once.
+     */
+    ImportanceMeasures getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
+
    private:
     /**
      * Recursively traverses the given BDD and returns the minimalCutSets.
@@ -357,9 +388,23 @@ class SFTBDDChecker {
      */
     void recursiveMCS(Bdd const bdd, std::vector<uint32_t> &buffer, std::vector<std::vector<uint32_t>> &minimalCutSets) const;
 
+    /**
+     * Splits the timepoints into chunks, calculates the failure probabilities
+     * of the basic events for each chunk and calls
+     * func(chunkBegin, currentChunksize, variableToProbabilities).
+     * If Intel TBB is enabled, func is called concurrently for different chunks.
+     */
     template<typename FuncType>
     void chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const;
 
+    /**
+     * Calculates the probabilities and birnbaum factors of all basic events in chunks and calls
+     * func(basicElementIndex, chunkBegin, beProbabilities, probabilities, birnbaumFactors)
+     * for each basic event and chunk.
+     */
+    template<typename FuncType>
+    void importanceMeasuresCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func);
+
     template<typename FuncType>
     ValueType getImportanceMeasureAtTimebound(std::string const &beName, ValueType timebound, FuncType func);
 
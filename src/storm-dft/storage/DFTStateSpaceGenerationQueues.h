@@ -98,6 +98,19 @@ class DFTStateSpaceGenerationQueues {
         dontcarePropagation.pop_back();
         return next;
     }
+
+    /*!
+     * Remove all pending elements from the queues while keeping the allocated memory for reuse.
+     */
+    void clear() {
+        while (!failurePropagation.empty()) {
+            failurePropagation.pop();
+        }
+        failsafePropagation.clear();
+        dontcarePropagation.clear();
+        activatePropagation.clear();
+        restrictionChecks.clear();
+    }
 };
 
 }  // namespace storage
@@ -25,15 +25,29 @@
 #include <boost/algorithm/string.hpp>
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/utility/Stopwatch.h"
 
 #include "storm-conv/settings/modules/JaniExportSettings.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
 #include "storm-gspn/settings/modules/GSPNSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/DebugSettings.h"
+#include "storm/settings/modules/EigenEquationSolverSettings.h"
+#include "storm/settings/modules/GameSolverSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/GmmxxEquationSolverSettings.h"
 #include "storm/settings/modules/IOSettings.h"
+#include "storm/settings/modules/LongRunAverageSolverSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/settings/modules/MultiplierSettings.h"
+#include "storm/settings/modules/NativeEquationSolverSettings.h"
+#include "storm/settings/modules/OviSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/TimeBoundedSolverSettings.h"
+#include "storm/settings/modules/TopologicalEquationSolverSettings.h"
 
 /*!
  * Initialize the settings manager.
@@ -50,6 +64,54 @@ void initializeSettings(std::string const& name, std::string const& executableNa
     storm::settings::addModule<storm::settings::modules::DebugSettings>();
     storm::settings::addModule<storm::settings::modules::JaniExportSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
+
+    // Modules needed for building and checking the model.
+    storm::settings::addModule<storm::settings::modules::BuildSettings>();
+    storm::settings::addModule<storm::settings::modules::ModelCheckerSettings>();
+    storm::settings::addModule<storm::settings::modules::GmmxxEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::EigenEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::NativeEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::TopologicalEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::MinMaxEquationSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::MultiplierSettings>();
+    storm::settings::addModule<storm::settings::modules::OviSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::TimeBoundedSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::LongRunAverageSolverSettings>();
+    storm::settings::addModule<storm::settings::modules::GameSolverSettings>(false);
+}
+
+/*!
+ * Builds the model of the GSPN with the selected builder and checks the properties on it.
+ */
+void buildAndCheckModel(storm::gspn::GSPN const& gspn, std::vector<storm::jani::Property> const& properties) {
+    auto formulas = storm::api::extractFormulasFromProperties(properties);
+    bool explicitBuilder = storm::settings::getModule<storm::settings::modules::GSPNSettings>().isExplicitBuilderSet();
+
+    storm::utility::Stopwatch buildingWatch(true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+    if (explicitBuilder) {
+        model = storm::api::buildExplicitModel(gspn, formulas);
+    } else {
+        std::unique_ptr<storm::jani::Model> janiModel(storm::api::buildJani(gspn));
+        model = storm::api::buildSparseModel<double>(*janiModel, formulas);
+    }
+    buildingWatch.stop();
+    model->printModelInformationToStream(std::cout);
+    STORM_PRINT("Time for model construction (" << (explicitBuilder ? "explicit" : "JANI") << " builder): " << buildingWatch << ".\n");
+
+    for (auto const& property : properties) {
+        STORM_PRINT("\nModel checking property \"" << property.getName() << "\": " << *property.getRawFormula() << " ...\n");
+        storm::utility::Stopwatch checkingWatch(true);
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(property.getRawFormula(), true));
+        checkingWatch.stop();
+        if (result) {
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+            STORM_PRINT("Result (for initial states): " << *result << "\n");
+            STORM_PRINT("Time for model checking: " << checkingWatch << ".\n");
+        } else {
+            STORM_LOG_ERROR("Property is unsupported by selected engine/settings.");
+        }
+    }
 }
 
 void processOptions() {
@@ -96,10 +158,9 @@ void processOptions() {
 
     storm::api::handleGSPNExportSettings(*gspn, [&](storm::builder::JaniGSPNBuilder const&) { return properties; });
 
-    //        // construct ma
-    //        auto builder = storm::builder::ExplicitGspnModelBuilder<>();
-    //        auto ma = builder.translateGspn(gspn, formula);
-    //
+    if (gspnSettings.isBuilderSet()) {
+        buildAndCheckModel(*gspn, properties);
+    }
 
     delete gspn;
 }
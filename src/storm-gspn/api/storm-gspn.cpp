@@ -3,11 +3,13 @@
 #include <boost/algorithm/string.hpp>
 #include "storm-conv/api/storm-conv.h"
 #include "storm-conv/settings/modules/JaniExportSettings.h"
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
 #include "storm-parsers/parser/ExpressionParser.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/io/file.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 namespace storm {
 namespace api {
@@ -17,6 +19,16 @@ storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn) {
     return builder.build();
 }
 
+std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitModel(storm::gspn::GSPN const& gspn,
+                                                                         std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::builder::ExplicitGspnModelBuilder<double> builder(gspn);
+    builder.addExpressionLabels(formulas);
+    if (storm::settings::hasModule<storm::settings::modules::BuildSettings>()) {
+        builder.setFixDeadlocks(!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet());
+    }
+    return builder.build();
+}
+
 void handleGSPNExportSettings(storm::gspn::GSPN const& gspn,
                               std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter) {
     storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
@@ -4,6 +4,8 @@
 
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
 #include "storm/storage/jani/Model.h"
 
 namespace storm {
@@ -14,6 +16,13 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds the explicit model of the GSPN directly from its markings, i.e., without translating it to JANI.
+ *    The atomic expressions of the given formulas are added as labels.
+ */
+std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitModel(storm::gspn::GSPN const& gspn,
+                                                                         std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
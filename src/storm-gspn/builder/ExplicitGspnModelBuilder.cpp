@@ -1,332 +1,365 @@
-// #include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-// #include "storm/models/sparse/StandardRewardModel.h"
-//
-// #include "storm/utility/macros.h"
-// #include "storm/exceptions/NotImplementedException.h"
-// #include "storm/storage/expressions/ExpressionManager.h"
-// #include "storm-parsers/parser/FormulaParser.h"
-// #include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         template<typename ValueType>
-//         storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string
-//         const& formula) {
-//             // set the given gspn and compute the limits of the net
-//             this->gspn = gspn;
-//             computeCapacities(gspn);
-//
-//             // markings maps markings to their corresponding rowgroups (indices)
-//             markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//             builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//             // add initial marking to todo list
-//             auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//             findOrAddBitvectorToMarkings(*bitvector);
-//             currentRowIndex = 0;
-//
-//             // vector marking markovian states (vector contains an 1 if the state is markovian)
-//             storm::storage::BitVector markovianStates(0);
-//
-//             // vector containing the exit rates for the markovian states
-//             std::vector<ValueType> exitRates;
-//
-//
-//             while (!todo.empty()) {
-//                 // take next element from the todo list
-//                 auto currentBitvector = todo.front();
-//                 todo.pop_front();
-//                 auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                 // increment list of states by one
-//                 markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                 // create new row group for the current marking
-//                 builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                 std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                 auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                 if (!enabledImmediateTransitions.empty()) {
-//                     markovianStates.set(currentRowIndex, 0);
-//                     exitRates.push_back(0);
-//
-//                     auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                     addRowForPartitions(partitions, currentMarking);
-//                 } else {
-//
-//                     auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                     if (!enabledTimedTransitions.empty()) {
-//                         markovianStates.set(currentRowIndex, 1);
-//
-//                         auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                         std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                         exitRates.push_back(accRate);
-//
-//                         addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                     } else {
-//                         markovianStates.set(currentRowIndex, 1);
-//                     }
-//                 }
-//                 ++currentRowIndex;
-//             }
-//
-//             auto matrix = builder.build();
-//
-//             // create expression manager and add variables from the gspn
-//             auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//             for (auto& place : gspn.getPlaces()) {
-//                 expressionManager->declareIntegerVariable(place.getName());
-//             }
-//
-//             // parse formula
-//             storm::parser::FormulaParser formulaParser(expressionManager);
-//             auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//             auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//             // create empty state labeling
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//             storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//             std::cout << '\n';
-//             std::cout << "build labeling:\n";
-//             for (auto& atomicFormula : atomicFormulas) {
-//                 std::cout << atomicFormula;
-//                 auto label = atomicFormula->toString();
-//                 labeling.addLabel(label);
-//
-//                 for (auto statePair : markings) {
-//                     auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                     for (auto& place : gspn.getPlaces()) {
-//                         auto variable = expressionManager->getVariable(place.getName());
-//                         expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                     }
-//                     bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                     if (hold) {
-//                         labeling.addLabelToState(label, statePair.second);
-//                     }
-//                 }
-//
-//             }
-//
-//             //auto labeling = getStateLabeling();
-//
-//             return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         const& partitions, storm::gspn::Marking const& currentMarking) {
-//             for (auto& partition : partitions) {
-//                 std::cout << "\tnew partition:\n";
-//                 auto accWeight = getAccumulatedWeight(partition);
-//                 std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                 std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                 for (auto& trans : partition) {
-//                     std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                     auto newMarking = trans.fire(currentMarking);
-//                     std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                     findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                     auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                     double currentWeight = 0;
-//                     if (it != weights.end()) {
-//                         currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                     }
-//                     currentWeight += trans.getWeight() / accWeight;
-//                     weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                 }
-//
-//                 addValuesToBuilder(weights);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//         enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//             std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//             for (auto& trans : enabledTimedTransitions) {
-//                 std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                 auto newMarking = trans.fire(currentMarking);
-//                 std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                 findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                 auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                 double currentWeightRate = 0;
-//                 if (it != rates.end()) {
-//                     currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                 }
-//                 currentWeightRate += trans.getRate() / accRate;
-//                 rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//             }
-//
-//             addValuesToBuilder(rates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//         storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//             for (auto& it : values) {
-//                 std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                 builder.addNextValue(currentRowIndex, it.first, it.second);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                 storm::gspn::Marking const& marking,
-//                 std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//             decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//             for (auto& trans : enabledImmediateTransitions) {
-//                 if (trans.noWeightAttached()) {
-//                     decltype(weightedTransitions) singleton;
-//                     singleton.push_back(trans);
-//                     result.push_back(singleton);
-//                 } else {
-//                     weightedTransitions.push_back(trans);
-//                 }
-//             }
-//
-//             if (weightedTransitions.size() != 0) {
-//                 result.push_back(weightedTransitions);
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const&
-//         vector) const {
-//             double result = 0;
-//
-//             for (auto &trans : vector) {
-//                 result += trans.getWeight();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//             uint_fast64_t sum = 0;
-//             for (auto& place : gspn.getPlaces()) {//TODO
-//                 numberOfBits[place.getID()] = 1;
-//                 sum += numberOfBits[place.getID()];
-//             }
-//
-//             // compute next multiple of 64
-//             uint_fast64_t rem = sum % 64;
-//             numberOfTotalBits = sum + 64 - rem;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getTimedTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getImmediateTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//             double result = 0;
-//             for (auto trans : vector) {
-//                 result += trans.getRate();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//             for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                 if (std::get<1>(*it) == index) {
-//                     return std::get<0>(*it);
-//                 }
-//             }
-//             return storm::storage::BitVector();
-//         }
-//
-//         template<typename ValueType>
-//         uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//             auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//             if (index == nextRowGroupIndex) {
-//                 // bitvector was not already in the map
-//                 ++nextRowGroupIndex;
-//                 // bitvector was also never in the todo list
-//                 todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//             }
-//             return index;
-//         }
-//
-//         template<typename ValueType>
-//         storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//             std::map<uint_fast64_t , std::string> idToName;
-//             for (auto& place : gspn.getPlaces()) {
-//                 idToName[place.getID()] = place.getName();
-//                 labeling.addLabel(place.getName());
-//             }
-//
-//             auto it = markings.begin();
-//             for ( ; it != markings.end() ; ++it) {
-//                 auto bitvector = std::get<0>(*it);
-//                 storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                 for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                     if (marking.getNumberOfTokensAt(i) > 0) {
-//                         std::cout << i << '\n';
-//                         labeling.addLabelToState(idToName.at(i), i);
-//                     }
-//                 }
-//             }
-//
-//             return labeling;
-//         }
-//
-//         template class ExplicitGspnModelBuilder<double>;
-//     }
-// }
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+#include "storm/logic/AtomicExpressionFormula.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace builder {
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn) : gspn(gspn), numberOfBits(0), fixDeadlocks(true) {
+    // Compute the encoding of the markings.
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_ASSERT(place.getID() == placeBitOffsets.size(), "Unexpected place id.");
+        uint64_t width = bitsForUnboundedPlaces;
+        uint64_t maxTokens = (1ull << bitsForUnboundedPlaces) - 1;
+        if (place.hasRestrictedCapacity()) {
+            maxTokens = place.getCapacity();
+            width = 1;
+            while ((maxTokens >> width) > 0) {
+                ++width;
+            }
+        }
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= maxTokens, storm::exceptions::WrongFormatException,
+                        "The initial number of tokens of place '" << place.getName() << "' exceeds its capacity.");
+        placeBitOffsets.push_back(numberOfBits);
+        placeBitWidths.push_back(width);
+        maximalNumberOfTokens.push_back(maxTokens);
+        numberOfBits += width;
+    }
+
+    // Precompute the immediate transitions, ordered by the priorities of their partitions.
+    std::vector<storm::gspn::TransitionPartition> partitions = gspn.getPartitions();
+    std::stable_sort(partitions.begin(), partitions.end(),
+                     [](storm::gspn::TransitionPartition const& lhs, storm::gspn::TransitionPartition const& rhs) { return lhs.priority > rhs.priority; });
+    for (auto const& partition : partitions) {
+        std::vector<TransitionInformation> partitionTransitions;
+        for (auto const& transitionId : partition.transitions) {
+            auto const& transition = gspn.getImmediateTransitions()[transitionId];
+            if (transition.noWeightAttached()) {
+                STORM_LOG_WARN("Immediate transition '" << transition.getName() << "' has no weight attached. Skipping this transition.");
+                continue;
+            }
+            partitionTransitions.push_back(createTransitionInformation(transition, storm::utility::convertNumber<ValueType>(transition.getWeight()), 1));
+        }
+        if (!partitionTransitions.empty()) {
+            immediatePartitions.push_back(std::move(partitionTransitions));
+            immediatePartitionPriorities.push_back(partition.priority);
+        }
+    }
+
+    // Precompute the timed transitions.
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        if (storm::utility::isZero(transition.getRate())) {
+            STORM_LOG_WARN("Timed transition '" << transition.getName() << "' has rate zero. Skipping this transition.");
+            continue;
+        }
+        uint64_t numberOfServers = 1;
+        if (transition.hasInfiniteServerSemantics() || (transition.hasKServerSemantics() && !transition.hasSingleServerSemantics())) {
+            STORM_LOG_THROW(transition.hasKServerSemantics() || !transition.getInputPlaces().empty(), storm::exceptions::InvalidModelException,
+                            "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+            numberOfServers = transition.hasKServerSemantics() ? transition.getNumberOfServers() : 0;
+        }
+        timedTransitions.push_back(createTransitionInformation(transition, storm::utility::convertNumber<ValueType>(transition.getRate()), numberOfServers));
+    }
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::addExpressionLabel(storm::expressions::Expression const& expression) {
+    expressionLabels.push_back(expression);
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::addExpressionLabels(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    for (auto const& formula : formulas) {
+        for (auto const& atomicExpressionFormula : formula->getAtomicExpressionFormulas()) {
+            addExpressionLabel(atomicExpressionFormula->getExpression());
+        }
+    }
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::setFixDeadlocks(bool value) {
+    fixDeadlocks = value;
+}
+
+template<typename ValueType>
+typename ExplicitGspnModelBuilder<ValueType>::TransitionInformation ExplicitGspnModelBuilder<ValueType>::createTransitionInformation(
+    storm::gspn::Transition const& transition, ValueType const& value, uint64_t numberOfServers) const {
+    TransitionInformation result;
+    result.name = transition.getName();
+    result.value = value;
+    result.numberOfServers = numberOfServers;
+
+    std::map<uint64_t, int64_t> tokenChanges;
+    for (auto const& placeMultiplicity : transition.getInputPlaces()) {
+        result.inputArcs.push_back(placeMultiplicity);
+        tokenChanges[placeMultiplicity.first] -= placeMultiplicity.second;
+    }
+    for (auto const& placeMultiplicity : transition.getOutputPlaces()) {
+        tokenChanges[placeMultiplicity.first] += placeMultiplicity.second;
+    }
+    for (auto const& placeMultiplicity : transition.getInhibitionPlaces()) {
+        result.inhibitionArcs.push_back(placeMultiplicity);
+    }
+    // Sort the arcs to obtain a deterministic order, independent of the hashing.
+    std::sort(result.inputArcs.begin(), result.inputArcs.end());
+    std::sort(result.inhibitionArcs.begin(), result.inhibitionArcs.end());
+    for (auto const& placeChange : tokenChanges) {
+        if (placeChange.second != 0) {
+            result.tokenChanges.push_back(placeChange);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isEnabled(TransitionInformation const& transition) const {
+    for (auto const& arc : transition.inputArcs) {
+        if (currentTokens[arc.first] < arc.second) {
+            return false;
+        }
+    }
+    for (auto const& arc : transition.inhibitionArcs) {
+        if (currentTokens[arc.first] >= arc.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+ValueType ExplicitGspnModelBuilder<ValueType>::getEffectiveRate(TransitionInformation const& transition) const {
+    if (transition.numberOfServers == 1) {
+        return transition.value;
+    }
+    // The enabling degree is the number of times the transition could fire concurrently, bounded by the number of servers (if finite).
+    uint64_t enablingDegree = transition.numberOfServers;
+    for (auto const& arc : transition.inputArcs) {
+        uint64_t degreeOfPlace = currentTokens[arc.first] / arc.second;
+        if (enablingDegree == 0 || degreeOfPlace < enablingDegree) {
+            enablingDegree = degreeOfPlace;
+        }
+    }
+    return transition.value * storm::utility::convertNumber<ValueType>(enablingDegree);
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::fire(TransitionInformation const& transition) {
+    successorMarking = currentMarking;
+    for (auto const& placeChange : transition.tokenChanges) {
+        uint64_t const& place = placeChange.first;
+        // Enabledness guarantees that the number of tokens does not become negative.
+        uint64_t newTokens = static_cast<uint64_t>(static_cast<int64_t>(currentTokens[place]) + placeChange.second);
+        STORM_LOG_THROW(newTokens <= maximalNumberOfTokens[place], storm::exceptions::WrongFormatException,
+                        "Firing transition '" << transition.name << "' in marking " << currentMarkingToString() << " exceeds the capacity of place '"
+                                              << gspn.getPlace(place)->getName() << "'.");
+        successorMarking.setFromInt(placeBitOffsets[place], placeBitWidths[place], newTokens);
+    }
+    return findOrAddMarking(successorMarking);
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::findOrAddMarking(storm::storage::BitVector const& marking) {
+    uint64_t newIndex = markings.size();
+    uint64_t index = markings.findOrAdd(marking, newIndex);
+    if (index == newIndex) {
+        todo.push_back(marking);
+    }
+    return index;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::loadMarking(storm::storage::BitVector const& marking) {
+    currentMarking = marking;
+    for (uint64_t place = 0; place < currentTokens.size(); ++place) {
+        currentTokens[place] = currentMarking.getAsInt(placeBitOffsets[place], placeBitWidths[place]);
+    }
+}
+
+template<typename ValueType>
+std::string ExplicitGspnModelBuilder<ValueType>::currentMarkingToString() const {
+    std::stringstream stream;
+    stream << "[";
+    for (uint64_t place = 0; place < currentTokens.size(); ++place) {
+        if (place > 0) {
+            stream << ", ";
+        }
+        stream << gspn.getPlace(place)->getName() << "=" << currentTokens[place];
+    }
+    stream << "]";
+    return stream.str();
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitGspnModelBuilder<ValueType>::build() {
+    storm::models::ModelType modelType = storm::models::ModelType::MarkovAutomaton;
+    if (gspn.getNumberOfTimedTransitions() == 0) {
+        modelType = storm::models::ModelType::Mdp;
+    } else if (gspn.getNumberOfImmediateTransitions() == 0) {
+        modelType = storm::models::ModelType::Ctmc;
+    }
+    bool const deterministic = modelType == storm::models::ModelType::Ctmc;
+
+    markings = storm::storage::BitVectorHashMap<uint64_t>(numberOfBits, 100000);
+    todo.clear();
+    currentMarking = storm::storage::BitVector(numberOfBits);
+    currentTokens.assign(gspn.getNumberOfPlaces(), 0);
+    successorMarking = storm::storage::BitVector(numberOfBits);
+
+    // Add the initial marking.
+    storm::storage::BitVector initialMarking(numberOfBits);
+    for (auto const& place : gspn.getPlaces()) {
+        initialMarking.setFromInt(placeBitOffsets[place.getID()], placeBitWidths[place.getID()], place.getNumberOfInitialTokens());
+    }
+    findOrAddMarking(initialMarking);
+
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, !deterministic, 0);
+    std::vector<uint64_t> markovianStates;
+    std::vector<uint64_t> deadlockStates;
+    // Collects the entries of the current row. Distinct transitions may lead to the same successor.
+    std::map<uint64_t, ValueType> rowEntries;
+    std::vector<TransitionInformation const*> enabledTransitions;
+    uint64_t currentRow = 0;
+    uint64_t currentState = 0;
+
+    auto finishRow = [&]() {
+        for (auto const& entry : rowEntries) {
+            matrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+        }
+        rowEntries.clear();
+        ++currentRow;
+    };
+
+    while (!todo.empty()) {
+        loadMarking(todo.front());
+        todo.pop_front();
+        if (!deterministic) {
+            matrixBuilder.newRowGroup(currentRow);
+        }
+        bool hasChoice = false;
+
+        // Each enabled partition of immediate transitions with the highest priority yields a probabilistic choice.
+        for (uint64_t partition = 0; partition < immediatePartitions.size(); ++partition) {
+            if (hasChoice && immediatePartitionPriorities[partition] < immediatePartitionPriorities[partition - 1]) {
+                // Partitions with lower priority are disabled by the enabled ones.
+                break;
+            }
+            enabledTransitions.clear();
+            ValueType totalWeight = storm::utility::zero<ValueType>();
+            for (auto const& transition : immediatePartitions[partition]) {
+                if (isEnabled(transition)) {
+                    enabledTransitions.push_back(&transition);
+                    totalWeight += transition.value;
+                }
+            }
+            if (enabledTransitions.empty()) {
+                continue;
+            }
+            STORM_LOG_THROW(!storm::utility::isZero(totalWeight), storm::exceptions::InvalidModelException,
+                            "All enabled immediate transitions of a partition have weight zero in marking " << currentMarkingToString() << ".");
+            for (auto const& transition : enabledTransitions) {
+                if (!storm::utility::isZero(transition->value)) {
+                    rowEntries[fire(*transition)] += transition->value / totalWeight;
+                }
+            }
+            finishRow();
+            hasChoice = true;
+        }
+
+        // If the marking is tangible, all enabled timed transitions race in a single Markovian choice.
+        if (!hasChoice) {
+            for (auto const& transition : timedTransitions) {
+                if (isEnabled(transition)) {
+                    rowEntries[fire(transition)] += getEffectiveRate(transition);
+                }
+            }
+            if (!rowEntries.empty()) {
+                finishRow();
+                markovianStates.push_back(currentState);
+                hasChoice = true;
+            }
+        }
+
+        if (!hasChoice) {
+            STORM_LOG_THROW(fixDeadlocks, storm::exceptions::WrongFormatException,
+                            "Found deadlock marking " << currentMarkingToString() << ". For fixing these, please provide the appropriate option.");
+            deadlockStates.push_back(currentState);
+            rowEntries[currentState] = storm::utility::one<ValueType>();
+            finishRow();
+            // The self-loop is Markovian to not introduce Zeno behavior.
+            markovianStates.push_back(currentState);
+        }
+        ++currentState;
+    }
+    uint64_t numberOfStates = markings.size();
+    STORM_LOG_ASSERT(currentState == numberOfStates, "Not all markings have been explored.");
+
+    storm::storage::sparse::ModelComponents<ValueType> components(matrixBuilder.build(currentRow, numberOfStates, deterministic ? 0 : numberOfStates),
+                                                                  buildStateLabeling(numberOfStates, deadlockStates));
+    components.rateTransitions = modelType != storm::models::ModelType::Mdp;
+    if (modelType == storm::models::ModelType::MarkovAutomaton) {
+        components.markovianStates = storm::storage::BitVector(numberOfStates, markovianStates);
+    }
+
+    // Release the memory of the exploration.
+    markings = storm::storage::BitVectorHashMap<uint64_t>(numberOfBits, 1);
+    return storm::utility::builder::buildModelFromComponents(modelType, std::move(components));
+}
+
+template<typename ValueType>
+storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::buildStateLabeling(uint64_t numberOfStates,
+                                                                                             std::vector<uint64_t> const& deadlockStates) const {
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("deadlock", storm::storage::BitVector(numberOfStates, deadlockStates));
+
+    if (!expressionLabels.empty()) {
+        std::vector<std::string> labelNames;
+        for (auto const& expression : expressionLabels) {
+            std::stringstream stream;
+            stream << expression;
+            labelNames.push_back(stream.str());
+            if (!labeling.containsLabel(labelNames.back())) {
+                labeling.addLabel(labelNames.back());
+            }
+        }
+
+        std::vector<storm::expressions::Variable> placeVariables;
+        for (auto const& place : gspn.getPlaces()) {
+            placeVariables.push_back(gspn.getExpressionManager()->getVariable(place.getName()));
+        }
+        storm::expressions::ExpressionEvaluator<double> evaluator(*gspn.getExpressionManager());
+        for (auto const& markingAndState : markings) {
+            for (uint64_t place = 0; place < placeVariables.size(); ++place) {
+                evaluator.setIntegerValue(placeVariables[place], markingAndState.first.getAsInt(placeBitOffsets[place], placeBitWidths[place]));
+            }
+            for (uint64_t label = 0; label < expressionLabels.size(); ++label) {
+                if (evaluator.asBool(expressionLabels[label])) {
+                    labeling.addLabelToState(labelNames[label], markingAndState.second);
+                }
+            }
+        }
+    }
+    return labeling;
+}
+
+template class ExplicitGspnModelBuilder<double>;
+
+}  // namespace builder
+}  // namespace storm
@@ -1,175 +1,132 @@
-// #ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-// #define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-// #include <string>
-//
-// #include "storm/models/sparse/MarkovAutomaton.h"
-// #include "storm/models/sparse/StandardRewardModel.h"
-// #include "storm/storage/BitVector.h"
-// #include "storm/storage/BitVectorHashMap.h"
-// #include "storm/storage/gspn/GSPN.h"
-// #include "storm/storage/gspn/ImmediateTransition.h"
-// #include "storm/storage/gspn/TimedTransition.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         /*!
-//          * This class provides the facilities for building an markov automaton.
-//          */
-//         template<typename ValueType=double>
-//         class ExplicitGspnModelBuilder {
-//         public:
-//
-//             /*!
-//              * Builds an MarkovAutomaton from the given GSPN.
-//              *
-//              * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//              * @return The resulting MarkovAutomaton
-//              */
-//             storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//         private:
-//
-//             /*!
-//              * Add for each partition a new row in the probability matrix.
-//              *
-//              * @param partitions The partitioned immediate transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              */
-//             void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//             storm::gspn::Marking const& currentMarking);
-//
-//
-//             /*!
-//              * Add row for a markovian state.
-//              *
-//              * @param enabledTimedTransitions List of enabled timed transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              * @param accRate The sum of all rates of the enabled timed transisitons
-//              */
-//             void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//             storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//             /*!
-//              * Struct for comparing unsigned integer for maps
-//              */
-//             struct cmpByIndex {
-//                 bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                     return a < b;
-//                 }
-//             };
-//
-//             /*!
-//              * This method insert the values from a map into the matrix
-//              *
-//              * @param values The values which are inserted
-//              */
-//             void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//             /*!
-//              * This method partitions all enabled immediate transitions w.r.t. a marking.
-//              * All enabled weighted immediate transitions are in one vector. Between these transitions
-//              * is chosen probabilistically by the weights.
-//              *
-//              * All other enabled non-weighted immediate transitions are in an singleton vector.
-//              * Between different vectors is chosen non-deterministically.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//              * @return The vector of vectors which is described above.
-//              */
-//             std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//             const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//             /*!
-//              * Computes the accumulated weight of immediate transisions which are stored in a list.
-//              *
-//              * @param vector List of immediate transisitions.
-//              */
-//             double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//             /*!
-//              * Compute the upper bound for the number of tokens in each place.
-//              * Also computes the number of bits which are used to store a marking.
-//              *
-//              * @param gspn The corresponding gspn.
-//              */
-//             void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//             /*!
-//              * Returns the vector of enabled timed transition with the highest priority.
-//              *
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled timed transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Returns the vector of active immediate transition with the highest priority.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled immediate transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Computes the accumulated rate of a vector of timed transitions.
-//              *
-//              * @param vector The vector of timed transitions.
-//              * @return The accumulated rate.
-//              */
-//             double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//             // is only needed for debugging purposes
-//             // since markings is injective, we can determine the bitvector
-//             storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//             /*!
-//              * Adds the bitvector to the marking-map.
-//              * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//              *
-//              * @return The rowGroup index for the bitvector.
-//              */
-//             uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//             /*!
-//              * Computes the state labeling and returns it.
-//              * Every state is labeled with its name.
-//              *
-//              * @return The computed state labeling.
-//              */
-//             storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//             // contains the number of bits which are used the store the number of tokens at each place
-//             std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//             // contains the number of bits used to create markings
-//             uint_fast64_t numberOfTotalBits;
-//
-//             // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//             storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//             // a list of markings for which the outgoing edges need to be computed
-//             std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//             //the gspn which is transformed
-//             storm::gspn::GSPN gspn;
-//
-//             // the next index for a new rowgroup
-//             uint_fast64_t nextRowGroupIndex = 0;
-//
-//             // builder object which is used to create the probability matrix
-//             storm::storage::SparseMatrixBuilder<double> builder;
-//
-//             // contains the current row index during the computation
-//             uint_fast64_t currentRowIndex;
-//         };
-//     }
-// }
-//
-// #endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the explicit model of a GSPN by exploring its reachable markings directly, i.e., without translating the GSPN to JANI first.
+ * The resulting model has the same type as the one obtained via the JANI translation: an MDP if there are no timed transitions, a CTMC if there are no
+ * immediate transitions and a Markov automaton otherwise.
+ *
+ * Markings are stored as bit vectors in which each place occupies as many bits as needed to represent its capacity. The enabling conditions and the
+ * effects of the transitions are precomputed from the arcs, and immediate transitions are resolved via their priorities and weights.
+ */
+template<typename ValueType = double>
+class ExplicitGspnModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given GSPN.
+     *
+     * @param gspn The GSPN. Its place capacities determine the encoding of the markings. The GSPN has to outlive the builder.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn);
+
+    /*!
+     * Adds a label for the markings satisfying the given expression over the places of the GSPN. The name of the label is the string representation of
+     * the expression, so that atomic expressions in formulas are resolved by the model checkers.
+     */
+    void addExpressionLabel(storm::expressions::Expression const& expression);
+
+    /*!
+     * Adds labels for all atomic expressions occurring in the given formulas.
+     */
+    void addExpressionLabels(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
+    /*!
+     * Sets whether deadlock markings get a self-loop. If not set, an exception is thrown upon encountering a deadlock marking.
+     */
+    void setFixDeadlocks(bool value);
+
+    /*!
+     * Explores the reachable markings and builds the model.
+     * Markings are labeled with "init", "deadlock" and the expression labels.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build();
+
+   private:
+    // The precomputed enabling condition and effect of a transition.
+    struct TransitionInformation {
+        std::string name;
+        // Pairs of place index and multiplicity. The transition requires at least the multiplicity many tokens in each of these places.
+        std::vector<std::pair<uint64_t, uint64_t>> inputArcs;
+        // Pairs of place index and multiplicity. The transition requires less than the multiplicity many tokens in each of these places.
+        std::vector<std::pair<uint64_t, uint64_t>> inhibitionArcs;
+        // Pairs of place index and the (non-zero) change of the number of tokens upon firing.
+        std::vector<std::pair<uint64_t, int64_t>> tokenChanges;
+        // The weight (for immediate transitions) or rate (for timed transitions).
+        ValueType value;
+        // The number of servers of a timed transition. Zero encodes infinite-server semantics.
+        uint64_t numberOfServers;
+    };
+
+    TransitionInformation createTransitionInformation(storm::gspn::Transition const& transition, ValueType const& value, uint64_t numberOfServers) const;
+
+    bool isEnabled(TransitionInformation const& transition) const;
+
+    /*!
+     * Computes the rate with which the given (enabled) timed transition fires in the current marking.
+     */
+    ValueType getEffectiveRate(TransitionInformation const& transition) const;
+
+    /*!
+     * Fires the given (enabled) transition in the current marking and returns the index of the successor marking.
+     */
+    uint64_t fire(TransitionInformation const& transition);
+
+    uint64_t findOrAddMarking(storm::storage::BitVector const& marking);
+
+    void loadMarking(storm::storage::BitVector const& marking);
+
+    std::string currentMarkingToString() const;
+
+    storm::models::sparse::StateLabeling buildStateLabeling(uint64_t numberOfStates, std::vector<uint64_t> const& deadlockStates) const;
+
+    // The GSPN that is translated.
+    storm::gspn::GSPN const& gspn;
+
+    // For each place, the index of its first bit and the number of its bits in the encoding of a marking.
+    std::vector<uint64_t> placeBitOffsets;
+    std::vector<uint64_t> placeBitWidths;
+    // For each place, the maximal number of tokens it may hold.
+    std::vector<uint64_t> maximalNumberOfTokens;
+    // The number of bits of an encoded marking.
+    uint64_t numberOfBits;
+
+    // The immediate transitions with attached weights, grouped by partitions. The partitions are sorted by descending priority.
+    std::vector<std::vector<TransitionInformation>> immediatePartitions;
+    std::vector<uint64_t> immediatePartitionPriorities;
+    // The timed transitions with a non-zero rate.
+    std::vector<TransitionInformation> timedTransitions;
+
+    std::vector<storm::expressions::Expression> expressionLabels;
+    bool fixDeadlocks;
+
+    // The markings found so far, mapped to their state index.
+    storm::storage::BitVectorHashMap<uint64_t> markings;
+    // The markings that still need to be explored, in the order of their state indices.
+    std::deque<storm::storage::BitVector> todo;
+    // The currently explored marking, both encoded and as number of tokens per place.
+    storm::storage::BitVector currentMarking;
+    std::vector<uint64_t> currentTokens;
+    // Buffer for the successor marking.
+    storm::storage::BitVector successorMarking;
+
+    // The number of bits reserved for places without capacity.
+    static const uint64_t bitsForUnboundedPlaces = 32;
+};
+
+}  // namespace builder
+}  // namespace storm
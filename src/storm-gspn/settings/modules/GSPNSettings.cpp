@@ -21,6 +21,7 @@ const std::string GSPNSettings::capacitiesFileOptionShortName = "capacities";
 const std::string GSPNSettings::capacityOptionName = "capacity";
 const std::string GSPNSettings::constantsOptionName = "constants";
 const std::string GSPNSettings::constantsOptionShortName = "const";
+const std::string GSPNSettings::builderOptionName = "builder";
 
 GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, gspnFileOptionName, false, "Parses the GSPN.")
@@ -47,6 +48,16 @@ GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("")
                                          .build())
                         .build());
+    std::vector<std::string> builders = {"explicit", "jani"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, builderOptionName, false,
+                                                   "Builds the model of the GSPN and checks the given properties on it. The model is either built by exploring "
+                                                   "the markings directly or via the translation to JANI.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the builder.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(builders))
+                                         .setDefaultValueString("explicit")
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 bool GSPNSettings::isGspnFileSet() const {
@@ -81,6 +92,14 @@ std::string GSPNSettings::getConstantDefinitionString() const {
     return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
 }
 
+bool GSPNSettings::isBuilderSet() const {
+    return this->getOption(builderOptionName).getHasOptionBeenSet();
+}
+
+bool GSPNSettings::isExplicitBuilderSet() const {
+    return this->getOption(builderOptionName).getArgumentByName("name").getValueAsString() == "explicit";
+}
+
 void GSPNSettings::finalize() {}
 
 bool GSPNSettings::check() const {
@@ -53,6 +53,16 @@ class GSPNSettings : public ModuleSettings {
      */
     std::string getConstantDefinitionString() const;
 
+    /*!
+     * Retrieves whether the builder option was set, i.e., whether the GSPN is to be built and analyzed.
+     */
+    bool isBuilderSet() const;
+
+    /*!
+     * Retrieves whether the GSPN is to be built by exploring its markings directly (instead of translating it to JANI first).
+     */
+    bool isExplicitBuilderSet() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -66,6 +76,7 @@ class GSPNSettings : public ModuleSettings {
     static const std::string capacityOptionName;
     static const std::string constantsOptionName;
     static const std::string constantsOptionShortName;
+    static const std::string builderOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -21,6 +21,7 @@ const std::string transformContinuousShortOptionName = "tc";
 const std::string useMonotonicityName = "use-monotonicity";
 const std::string timeTravellingEnabledName = "time-travel";
 const std::string linearToSimpleEnabledName = "linear-to-simple";
+const std::string compiledEvaluationName = "compiled-evaluation";
 
 ParametricSettings::ParametricSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> modes = {"feasibility", "verification", "monotonicity", "sampling", "solutionfunction", "partitioning"};
@@ -45,6 +46,10 @@ ParametricSettings::ParametricSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, linearToSimpleEnabledName, false,
                                                    "Converts linear (constant * parameter) transitions to simple (only constant or parameter) transitions.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compiledEvaluationName, false,
+                                                   "If set, functions are evaluated in double precision on their expanded polynomials when instantiating or "
+                                                   "lifting the model. This is faster, but may be inaccurate due to cancellation.")
+                        .build());
 }
 
 bool ParametricSettings::exportResultToFile() const {
@@ -81,6 +86,10 @@ bool ParametricSettings::isLinearToSimpleEnabled() const {
     return this->getOption(linearToSimpleEnabledName).getHasOptionBeenSet();
 }
 
+bool ParametricSettings::isCompiledEvaluationSet() const {
+    return this->getOption(compiledEvaluationName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -55,6 +55,11 @@ class ParametricSettings : public ModuleSettings {
      */
     bool isLinearToSimpleEnabled() const;
 
+    /*!
+     * Retrieves whether functions should be compiled and evaluated in double precision when instantiating or lifting the model.
+     */
+    bool isCompiledEvaluationSet() const;
+
     const static std::string moduleName;
 };
 }  // namespace storm::settings::modules
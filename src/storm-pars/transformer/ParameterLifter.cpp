@@ -1,8 +1,12 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include "storm-pars/settings/modules/ParametricSettings.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -331,6 +335,17 @@ std::vector<storm::utility::parametric::Valuation<ParametricType>> ParameterLift
     return result;
 }
 
+template<typename ParametricType, typename ConstantType>
+ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::FunctionValuationCollector()
+    : useCompiledFunctions(std::is_same<ConstantType, double>::value && storm::settings::hasModule<storm::settings::modules::ParametricSettings>() &&
+                           storm::settings::getModule<storm::settings::modules::ParametricSettings>().isCompiledEvaluationSet()),
+      useConcurrentExactEvaluation(false) {
+#if defined(STORM_HAVE_INTELTBB) && !defined(STORM_USE_CLN_RF)
+    // The reference counts of cln numbers are not thread-safe, so the exact evaluation is only done concurrently if the coefficients are gmp numbers.
+    useConcurrentExactEvaluation = !useCompiledFunctions && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
+}
+
 template<typename ParametricType, typename ConstantType>
 ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::add(ParametricType const& function,
                                                                                              AbstractValuation const& valuation) {
@@ -343,12 +358,115 @@ ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCo
     // Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
     auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(
         FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+    if constexpr (std::is_same<ConstantType, double>::value) {
+        if (useCompiledFunctions && insertionRes.second) {
+            compiledFunctionIds.push_back(functionPool.add(insertionRes.first->first.first));
+            compiledPlaceholders.push_back(&insertionRes.first->second);
+            AbstractValuation const& insertedValuation = insertionRes.first->first.second;
+            for (auto const& par : insertedValuation.getLowerParameters()) {
+                compiledParameters.emplace_back(functionPool.getVariableIndex(par), ParameterBound::Lower);
+            }
+            for (auto const& par : insertedValuation.getUpperParameters()) {
+                compiledParameters.emplace_back(functionPool.getVariableIndex(par), ParameterBound::Upper);
+            }
+            for (auto const& par : insertedValuation.getUnspecifiedParameters()) {
+                compiledParameters.emplace_back(functionPool.getVariableIndex(par), ParameterBound::Unspecified);
+            }
+            compiledParameterIndices.push_back(compiledParameters.size());
+        }
+    }
+    if (useConcurrentExactEvaluation && insertionRes.second) {
+        ParametricType const& insertedFunction = insertionRes.first->first.first;
+        if (insertedFunction.isConstant()) {
+            exactFunctions.emplace_back(storm::RawPolynomial(insertedFunction.constantPart()), storm::RawPolynomial(storm::utility::one<CoefficientType>()));
+        } else {
+            exactFunctions.emplace_back(insertedFunction.nominator().polynomialWithCoefficient(), insertedFunction.denominator().polynomialWithCoefficient());
+        }
+        exactValuations.push_back(&insertionRes.first->first.second);
+        exactPlaceholders.push_back(&insertionRes.first->second);
+    }
     return insertionRes.first->second;
 }
 
 template<typename ParametricType, typename ConstantType>
 void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
     storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+    if constexpr (std::is_same<ConstantType, double>::value) {
+        if (useCompiledFunctions) {
+            // Converting the region to double precision once avoids that the exact boundaries are accessed concurrently.
+            std::vector<double> const lowerBoundaries = functionPool.getVariableValues(region.getLowerBoundaries());
+            std::vector<double> const upperBoundaries = functionPool.getVariableValues(region.getUpperBoundaries());
+            bool const minimize = storm::solver::minimize(dirForUnspecifiedParameters);
+            auto evaluateFunctions = [&](uint64_t begin, uint64_t end) {
+                std::vector<double> variableValues(lowerBoundaries.size());
+                std::vector<uint64_t> unspecifiedVariables;
+                for (uint64_t index = begin; index < end; ++index) {
+                    unspecifiedVariables.clear();
+                    for (uint64_t parIndex = compiledParameterIndices[index]; parIndex < compiledParameterIndices[index + 1]; ++parIndex) {
+                        auto const& par = compiledParameters[parIndex];
+                        if (par.second == ParameterBound::Lower) {
+                            variableValues[par.first] = lowerBoundaries[par.first];
+                        } else if (par.second == ParameterBound::Upper) {
+                            variableValues[par.first] = upperBoundaries[par.first];
+                        } else {
+                            unspecifiedVariables.push_back(par.first);
+                        }
+                    }
+                    // Consider all vertices spanned by the unspecified parameters.
+                    double result = 0.0;
+                    for (uint64_t vertex = 0; vertex < (1ull << unspecifiedVariables.size()); ++vertex) {
+                        for (uint64_t varIndex = 0; varIndex < unspecifiedVariables.size(); ++varIndex) {
+                            uint64_t const variable = unspecifiedVariables[varIndex];
+                            variableValues[variable] = (vertex & (1ull << varIndex)) ? upperBoundaries[variable] : lowerBoundaries[variable];
+                        }
+                        double const currentResult = functionPool.evaluate(compiledFunctionIds[index], variableValues);
+                        if (vertex == 0) {
+                            result = currentResult;
+                        } else if (minimize) {
+                            result = std::min(result, currentResult);
+                        } else {
+                            result = std::max(result, currentResult);
+                        }
+                    }
+                    *compiledPlaceholders[index] = result;
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, compiledFunctionIds.size()),
+                                  [&](tbb::blocked_range<uint64_t> const& range) { evaluateFunctions(range.begin(), range.end()); });
+                return;
+            }
+#endif
+            evaluateFunctions(0, compiledFunctionIds.size());
+            return;
+        }
+    }
+#ifdef STORM_HAVE_INTELTBB
+    if (useConcurrentExactEvaluation) {
+        bool const minimize = storm::solver::minimize(dirForUnspecifiedParameters);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, exactFunctions.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                auto const& function = exactFunctions[index];
+                ConstantType& placeholder = *exactPlaceholders[index];
+                auto concreteValuations = exactValuations[index]->getConcreteValuations(region);
+                auto concreteValuationIt = concreteValuations.begin();
+                placeholder = storm::utility::convertNumber<ConstantType>(function.first.evaluate(*concreteValuationIt) /
+                                                                          function.second.evaluate(*concreteValuationIt));
+                for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
+                    ConstantType currentResult = storm::utility::convertNumber<ConstantType>(function.first.evaluate(*concreteValuationIt) /
+                                                                                             function.second.evaluate(*concreteValuationIt));
+                    if (minimize) {
+                        placeholder = std::min(placeholder, currentResult);
+                    } else {
+                        placeholder = std::max(placeholder, currentResult);
+                    }
+                }
+            }
+        });
+        return;
+    }
+#endif
     for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
         ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
         AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -7,6 +7,7 @@
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/RationalFunctionPool.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
@@ -130,7 +131,7 @@ class ParameterLifter {
      */
     class FunctionValuationCollector {
        public:
-        FunctionValuationCollector() = default;
+        FunctionValuationCollector();
 
         /*!
          * Adds the provided function and valuation.
@@ -157,6 +158,29 @@ class ParameterLifter {
 
         // Stores the collected functions with the valuations together with a placeholder for the result.
         std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+        // When lifting to double precision and --parametric:compiled-evaluation is set, the collected functions are compiled once and evaluated without
+        // exact arithmetic.
+        bool useCompiledFunctions;
+
+        // Since the compiled functions can be evaluated concurrently, the abstract valuations are stored in flat arrays as well:
+        // The i-th collected function and valuation consists of the compiled function compiledFunctionIds[i], the placeholder compiledPlaceholders[i] and
+        // the parameters compiledParameters[compiledParameterIndices[i]] to compiledParameters[compiledParameterIndices[i+1]] (excluded), where each
+        // parameter is given by its index in the function pool.
+        enum class ParameterBound { Lower, Upper, Unspecified };
+        storm::utility::parametric::RationalFunctionPool functionPool;
+        std::vector<uint64_t> compiledFunctionIds;
+        std::vector<ConstantType*> compiledPlaceholders;
+        std::vector<uint64_t> compiledParameterIndices = {0};
+        std::vector<std::pair<uint64_t, ParameterBound>> compiledParameters;
+
+        // Whether the collected functions are evaluated exactly and concurrently. As the caches of carl's factorized polynomials are not thread-safe, the
+        // numerator and denominator of the i-th collected function are expanded once into exactFunctions[i]. It is evaluated w.r.t. the abstract
+        // valuation exactValuations[i] and the result is written into exactPlaceholders[i].
+        bool useConcurrentExactEvaluation;
+        std::vector<std::pair<storm::RawPolynomial, storm::RawPolynomial>> exactFunctions;
+        std::vector<AbstractValuation const*> exactValuations;
+        std::vector<ConstantType*> exactPlaceholders;
     };
 
     FunctionValuationCollector functionValuationCollector;
@@ -1,5 +1,8 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm-pars/settings/modules/ParametricSettings.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/macros.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -7,30 +10,42 @@ namespace storm {
 namespace utility {
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
-ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel) {
+ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel)
+    : useCompiledFunctions(std::is_same<ConstantType, double>::value && storm::settings::hasModule<storm::settings::modules::ParametricSettings>() &&
+                           storm::settings::getModule<storm::settings::modules::ParametricSettings>().isCompiledEvaluationSet()),
+      numberOfInstantiations(0),
+      numberOfFunctionEvaluations(0) {
     // Now pre-compute the information for the equation system.
     initializeModelSpecificData(parametricModel);
-    initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
+    initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->matrixMapping, parametricModel.getTransitionMatrix());
 
     for (auto& rewModel : this->instantiatedModel->getRewardModels()) {
         if (rewModel.second.hasStateRewards()) {
-            initializeVectorMapping(rewModel.second.getStateRewardVector(), this->functions, this->vectorMapping,
+            initializeVectorMapping(rewModel.second.getStateRewardVector(), this->vectorMapping,
                                     parametricModel.getRewardModel(rewModel.first).getStateRewardVector());
         }
         if (rewModel.second.hasStateActionRewards()) {
-            initializeVectorMapping(rewModel.second.getStateActionRewardVector(), this->functions, this->vectorMapping,
+            initializeVectorMapping(rewModel.second.getStateActionRewardVector(), this->vectorMapping,
                                     parametricModel.getRewardModel(rewModel.first).getStateActionRewardVector());
         }
         if (rewModel.second.hasTransitionRewards()) {
-            initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping,
+            initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->matrixMapping,
                                     parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
         }
     }
+
+    if (this->useCompiledFunctions) {
+        STORM_LOG_INFO("Compiled " << this->functionPool.size() << " distinct functions for " << this->matrixMapping.size() + this->vectorMapping.size()
+                                   << " parametric entries into " << this->functionPool.getSizeOfCompiledFunctionsInBytes() << " bytes.");
+    }
 }
 
 template<typename ParametricSparseModelType, typename ConstantType>
 ModelInstantiator<ParametricSparseModelType, ConstantType>::~ModelInstantiator() {
-    // Intentionally left empty
+    if (this->numberOfInstantiations > 0) {
+        STORM_LOG_INFO("Instantiated the model " << this->numberOfInstantiations << " times with " << this->numberOfFunctionEvaluations
+                                                 << " function evaluations in total" << (this->useCompiledFunctions ? " (compiled)." : "."));
+    }
 }
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
@@ -89,12 +104,26 @@ ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::buildDumm
     return result;
 }
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+typename ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ConstantType*
+ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getPlaceholder(ParametricType const& function) {
+    if (this->useCompiledFunctions) {
+        uint64_t functionId = this->functionPool.add(function);
+        if (functionId == this->compiledFunctionResults.size()) {
+            // Note that references to elements of a deque remain valid after calling deque::push_back.
+            this->compiledFunctionResults.push_back(storm::utility::one<ConstantType>());
+        }
+        return &this->compiledFunctionResults[functionId];
+    }
+    // Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+    return &(this->functions.insert(std::make_pair(function, storm::utility::one<ConstantType>())).first->second);
+}
+
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeMatrixMapping(
-    storm::storage::SparseMatrix<ConstantType>& constantMatrix, std::unordered_map<ParametricType, ConstantType>& functions,
+    storm::storage::SparseMatrix<ConstantType>& constantMatrix,
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
-    storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const {
-    ConstantType dummyValue = storm::utility::one<ConstantType>();
+    storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) {
     auto constantEntryIt = constantMatrix.begin();
     auto parametricEntryIt = parametricMatrix.begin();
     while (parametricEntryIt != parametricMatrix.end()) {
@@ -105,9 +134,7 @@ void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::init
             constantEntryIt->setValue(storm::utility::convertNumber<ConstantType>(parametricEntryIt->getValue()));
         } else {
             // insert the new function and store that the current constantMatrix entry needs to be set to the value of this function
-            auto functionsIt = functions.insert(std::make_pair(parametricEntryIt->getValue(), dummyValue)).first;
-            mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-            // Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+            mapping.emplace_back(std::make_pair(constantEntryIt, getPlaceholder(parametricEntryIt->getValue())));
         }
         ++constantEntryIt;
         ++parametricEntryIt;
@@ -118,9 +145,8 @@ void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::init
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeVectorMapping(
-    std::vector<ConstantType>& constantVector, std::unordered_map<ParametricType, ConstantType>& functions,
-    std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping, std::vector<ParametricType> const& parametricVector) const {
-    ConstantType dummyValue = storm::utility::one<ConstantType>();
+    std::vector<ConstantType>& constantVector, std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
+    std::vector<ParametricType> const& parametricVector) {
     auto constantEntryIt = constantVector.begin();
     auto parametricEntryIt = parametricVector.begin();
     while (parametricEntryIt != parametricVector.end()) {
@@ -129,9 +155,7 @@ void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::init
             *constantEntryIt = storm::utility::convertNumber<ConstantType>(*parametricEntryIt);
         } else {
             // insert the new function and store that the current constantVector entry needs to be set to the value of this function
-            auto functionsIt = functions.insert(std::make_pair(*parametricEntryIt, dummyValue)).first;
-            mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-            // Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+            mapping.emplace_back(std::make_pair(constantEntryIt, getPlaceholder(*parametricEntryIt)));
         }
         ++constantEntryIt;
         ++parametricEntryIt;
@@ -144,6 +168,7 @@ ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, Cons
     storm::utility::parametric::Valuation<ParametricType> const& valuation) {
     // Write results into the placeholders
     instantiate_helper(valuation);
+    ++this->numberOfInstantiations;
 
     // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMapping) {
@@ -161,6 +186,16 @@ void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::chec
     // TODO write some checks
 }
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+uint64_t ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getNumberOfInstantiations() const {
+    return this->numberOfInstantiations;
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+uint64_t ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getNumberOfFunctionEvaluations() const {
+    return this->numberOfFunctionEvaluations;
+}
+
 #ifdef STORM_HAVE_CARL
 template class ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>>;
 template class ModelInstantiator<storm::models::sparse::Mdp<storm::RationalFunction>, storm::models::sparse::Mdp<double>>;
@@ -1,10 +1,12 @@
 #ifndef STORM_UTILITY_MODELINSTANTIATOR_H
 #define STORM_UTILITY_MODELINSTANTIATOR_H
 
+#include <deque>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
 
+#include "storm-pars/utility/RationalFunctionPool.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -20,6 +22,8 @@ namespace utility {
  * This class allows efficient instantiation of the given parametric model.
  * The key to efficiency is to evaluate every distinct transition- (or reward-) function only once
  * instead of evaluating the same function for each occurrence in the model.
+ * When instantiating to double precision and --parametric:compiled-evaluation is set, the functions are compiled once (see RationalFunctionPool) and
+ * evaluated without exact arithmetic.
  */
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 class ModelInstantiator {
@@ -52,6 +56,16 @@ class ModelInstantiator {
      */
     void checkValid() const;
 
+    /*!
+     * Retrieves how often this instantiator instantiated the model.
+     */
+    uint64_t getNumberOfInstantiations() const;
+
+    /*!
+     * Retrieves how many (distinct) functions were evaluated over all instantiations.
+     */
+    uint64_t getNumberOfFunctionEvaluations() const;
+
    private:
     /*!
      * Initializes the instantiatedModel with dummy data by considering the model-specific ingredients.
@@ -82,7 +96,7 @@ class ModelInstantiator {
         components.choiceLabeling = parametricModel.getOptionalChoiceLabeling();
         this->instantiatedModel = std::make_shared<ConstantSparseModelType>(std::move(components));
 
-        initializeVectorMapping(this->instantiatedModel->getExitRateVector(), this->functions, this->vectorMapping, parametricModel.getExitRateVector());
+        initializeVectorMapping(this->instantiatedModel->getExitRateVector(), this->vectorMapping, parametricModel.getExitRateVector());
     }
 
     template<typename PMT = ParametricSparseModelType>
@@ -97,7 +111,7 @@ class ModelInstantiator {
         components.choiceLabeling = parametricModel.getOptionalChoiceLabeling();
         this->instantiatedModel = std::make_shared<ConstantSparseModelType>(std::move(components));
 
-        initializeVectorMapping(this->instantiatedModel->getExitRates(), this->functions, this->vectorMapping, parametricModel.getExitRates());
+        initializeVectorMapping(this->instantiatedModel->getExitRates(), this->vectorMapping, parametricModel.getExitRates());
     }
 
     template<typename PMT = ParametricSparseModelType>
@@ -119,14 +133,26 @@ class ModelInstantiator {
         for (auto& functionResult : this->functions) {
             functionResult.second = storm::utility::parametric::substitute(functionResult.first, valuation);
         }
+        this->numberOfFunctionEvaluations += this->functions.size();
     }
 
     template<typename PMT = ParametricSparseModelType>
     typename std::enable_if<!std::is_same<PMT, ConstantSparseModelType>::value>::type instantiate_helper(
         storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+        if constexpr (std::is_same<ConstantType, double>::value) {
+            if (this->useCompiledFunctions) {
+                std::vector<double> variableValues = this->functionPool.getVariableValues(valuation);
+                for (uint64_t functionId = 0; functionId < this->functionPool.size(); ++functionId) {
+                    this->compiledFunctionResults[functionId] = this->functionPool.evaluate(functionId, variableValues);
+                }
+                this->numberOfFunctionEvaluations += this->functionPool.size();
+                return;
+            }
+        }
         for (auto& functionResult : this->functions) {
             functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
         }
+        this->numberOfFunctionEvaluations += this->functions.size();
     }
 
     /*!
@@ -142,19 +168,23 @@ class ModelInstantiator {
     std::unordered_map<std::string, typename ConstantSparseModelType::RewardModelType> buildDummyRewardModels(
         std::unordered_map<std::string, typename ParametricSparseModelType::RewardModelType> const& parametricRewardModel) const;
 
+    /*!
+     * Retrieves the placeholder for the evaluation result of the given function. The function is inserted if it did not occur before.
+     */
+    ConstantType* getPlaceholder(ParametricType const& function);
+
     /*!
      * Connects the occurring functions with the corresponding matrix entries
      *
      * @note constantMatrix and parametricMatrix should have entries at the same positions
      *
      * @param constantMatrix The matrix to which the evaluation results are written
-     * @param functions Occurring functions are inserted in this map
      * @param mapping The connections of functions to matrix entries are push_backed  into this
      * @param parametricMatrix the source matrix with the functions to consider.
      */
-    void initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix, std::unordered_map<ParametricType, ConstantType>& functions,
+    void initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix,
                                  std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
-                                 storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const;
+                                 storm::storage::SparseMatrix<ParametricType> const& parametricMatrix);
 
     /*!
      * Connects the occurring functions with the corresponding vector entries
@@ -162,13 +192,12 @@ class ModelInstantiator {
      * @note constantVector and parametricVector should have the same size
      *
      * @param constantVector The vector to which the evaluation results are written
-     * @param functions Occurring functions with their placeholders are inserted in this map
      * @param mapping The connections of functions to vector entries are push_backed  into this
      * @param parametricVector the source vector with the functions to consider.
      */
-    void initializeVectorMapping(std::vector<ConstantType>& constantVector, std::unordered_map<ParametricType, ConstantType>& functions,
+    void initializeVectorMapping(std::vector<ConstantType>& constantVector,
                                  std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
-                                 std::vector<ParametricType> const& parametricVector) const;
+                                 std::vector<ParametricType> const& parametricVector);
 
     /// The resulting model
     std::shared_ptr<ConstantSparseModelType> instantiatedModel;
@@ -178,6 +207,15 @@ class ModelInstantiator {
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping;
     /// Connection of Vector entries with placeholders
     std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping;
+    /// whether the functions are compiled and evaluated in double precision. If so, they are stored in the function pool instead of the map above
+    bool useCompiledFunctions;
+    /// the compiled occurring functions
+    storm::utility::parametric::RationalFunctionPool functionPool;
+    /// the placeholders for the evaluation results of the compiled functions, indexed by their identifier in the function pool
+    std::deque<ConstantType> compiledFunctionResults;
+    /// statistics on the performed instantiations
+    uint64_t numberOfInstantiations;
+    uint64_t numberOfFunctionEvaluations;
 };
 }  // Namespace utility
 }  // namespace storm
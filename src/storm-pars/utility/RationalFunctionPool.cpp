@@ -0,0 +1,125 @@
+#include "storm-pars/utility/RationalFunctionPool.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace utility {
+namespace parametric {
+
+RationalFunctionPool::RationalFunctionPool() : numberOfAddedFunctions(0), functionTermIndices({0}), termVariableIndices({0}) {
+    // Intentionally left empty.
+}
+
+uint64_t RationalFunctionPool::add(storm::RationalFunction const& function) {
+    ++numberOfAddedFunctions;
+    auto insertionRes = functionToIdMap.emplace(function, functions.size());
+    if (insertionRes.second) {
+        functions.push_back(&insertionRes.first->first);
+        if (function.isConstant()) {
+            // A constant function is represented by a single term without variables and the denominator one.
+            termCoefficients.push_back(storm::utility::convertNumber<double>(function.constantPart()));
+            termVariableIndices.push_back(variablesWithExponents.size());
+            functionTermIndices.push_back(termCoefficients.size());
+            termCoefficients.push_back(1.0);
+            termVariableIndices.push_back(variablesWithExponents.size());
+        } else {
+            compilePolynomial(function.nominator().polynomialWithCoefficient());
+            functionTermIndices.push_back(termCoefficients.size());
+            compilePolynomial(function.denominator().polynomialWithCoefficient());
+        }
+        functionTermIndices.push_back(termCoefficients.size());
+    }
+    return insertionRes.first->second;
+}
+
+storm::RationalFunction const& RationalFunctionPool::getFunction(uint64_t id) const {
+    STORM_LOG_ASSERT(id < functions.size(), "Invalid function identifier " << id << ".");
+    return *functions[id];
+}
+
+uint64_t RationalFunctionPool::size() const {
+    return functions.size();
+}
+
+uint64_t RationalFunctionPool::getNumberOfAddedFunctions() const {
+    return numberOfAddedFunctions;
+}
+
+std::vector<storm::RationalFunctionVariable> const& RationalFunctionPool::getVariables() const {
+    return variables;
+}
+
+std::vector<double> RationalFunctionPool::getVariableValues(Valuation<storm::RationalFunction> const& valuation) const {
+    std::vector<double> result;
+    result.reserve(variables.size());
+    for (auto const& variable : variables) {
+        auto valueIt = valuation.find(variable);
+        STORM_LOG_THROW(valueIt != valuation.end(), storm::exceptions::InvalidArgumentException,
+                        "The valuation does not assign a value to the variable " << variable << ".");
+        result.push_back(storm::utility::convertNumber<double>(valueIt->second));
+    }
+    return result;
+}
+
+double RationalFunctionPool::evaluate(uint64_t id, std::vector<double> const& variableValues) const {
+    STORM_LOG_ASSERT(id < functions.size(), "Invalid function identifier " << id << ".");
+    STORM_LOG_ASSERT(variableValues.size() == variables.size(), "Unexpected number of variable values.");
+    double nominator = evaluateTerms(functionTermIndices[2 * id], functionTermIndices[2 * id + 1], variableValues);
+    double denominator = evaluateTerms(functionTermIndices[2 * id + 1], functionTermIndices[2 * id + 2], variableValues);
+    return nominator / denominator;
+}
+
+std::size_t RationalFunctionPool::getSizeOfCompiledFunctionsInBytes() const {
+    return functionTermIndices.size() * sizeof(uint64_t) + termCoefficients.size() * sizeof(double) + termVariableIndices.size() * sizeof(uint64_t) +
+           variablesWithExponents.size() * sizeof(std::pair<uint64_t, uint64_t>);
+}
+
+uint64_t RationalFunctionPool::getVariableIndex(storm::RationalFunctionVariable const& variable) const {
+    auto indexIt = variableToIndexMap.find(variable);
+    STORM_LOG_THROW(indexIt != variableToIndexMap.end(), storm::exceptions::InvalidArgumentException,
+                    "The variable " << variable << " does not occur in the functions of this pool.");
+    return indexIt->second;
+}
+
+uint64_t RationalFunctionPool::getOrAddVariableIndex(storm::RationalFunctionVariable const& variable) {
+    auto insertionRes = variableToIndexMap.emplace(variable, variables.size());
+    if (insertionRes.second) {
+        variables.push_back(variable);
+    }
+    return insertionRes.first->second;
+}
+
+void RationalFunctionPool::compilePolynomial(storm::RawPolynomial const& polynomial) {
+    for (auto const& term : polynomial) {
+        termCoefficients.push_back(storm::utility::convertNumber<double>(term.coeff()));
+        // The monomial of a constant term is not set.
+        if (term.monomial()) {
+            for (auto const& variableWithExponent : *term.monomial()) {
+                variablesWithExponents.emplace_back(getOrAddVariableIndex(variableWithExponent.first), variableWithExponent.second);
+            }
+        }
+        termVariableIndices.push_back(variablesWithExponents.size());
+    }
+}
+
+double RationalFunctionPool::evaluateTerms(uint64_t firstTerm, uint64_t endTerm, std::vector<double> const& variableValues) const {
+    double result = 0.0;
+    for (uint64_t term = firstTerm; term < endTerm; ++term) {
+        double termValue = termCoefficients[term];
+        for (uint64_t index = termVariableIndices[term]; index < termVariableIndices[term + 1]; ++index) {
+            double const& variableValue = variableValues[variablesWithExponents[index].first];
+            for (uint64_t exponent = variablesWithExponents[index].second; exponent > 0; --exponent) {
+                termValue *= variableValue;
+            }
+        }
+        result += termValue;
+    }
+    return result;
+}
+
+}  // namespace parametric
+}  // namespace utility
+}  // namespace storm
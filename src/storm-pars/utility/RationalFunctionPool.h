@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+namespace utility {
+namespace parametric {
+
+/*!
+ * Stores distinct rational functions and assigns a consecutive identifier to each of them, i.e., a function that is added multiple times is only stored
+ * once. Every stored function is compiled into a flat representation of the terms of its numerator and its denominator that can be evaluated in double
+ * precision without any exact arithmetic.
+ *
+ * @note The compiled functions are evaluated on the expanded numerator and denominator. Due to cancellation, the result may differ considerably from
+ * the exact value converted to double, e.g., for functions of high degree or with large coefficients.
+ */
+class RationalFunctionPool {
+   public:
+    RationalFunctionPool();
+    RationalFunctionPool(RationalFunctionPool const& other) = delete;
+    RationalFunctionPool& operator=(RationalFunctionPool const& other) = delete;
+    RationalFunctionPool(RationalFunctionPool&& other) = default;
+    RationalFunctionPool& operator=(RationalFunctionPool&& other) = default;
+
+    /*!
+     * Adds the given function (unless an equal function was already added) and retrieves its identifier.
+     */
+    uint64_t add(storm::RationalFunction const& function);
+
+    /*!
+     * Retrieves the function with the given identifier.
+     */
+    storm::RationalFunction const& getFunction(uint64_t id) const;
+
+    /*!
+     * Retrieves the number of distinct functions in this pool.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves how often a function was added to this pool (including the functions that were already contained).
+     */
+    uint64_t getNumberOfAddedFunctions() const;
+
+    /*!
+     * Retrieves the variables occurring in the functions of this pool. The values of the variables are expected in this order.
+     */
+    std::vector<storm::RationalFunctionVariable> const& getVariables() const;
+
+    /*!
+     * Retrieves the index of the given variable, i.e., its position in getVariables(). The variable has to occur in a function of this pool.
+     */
+    uint64_t getVariableIndex(storm::RationalFunctionVariable const& variable) const;
+
+    /*!
+     * Translates the given valuation into values for the variables of this pool.
+     * @throws InvalidArgumentException if the valuation does not assign a value to a variable of this pool.
+     */
+    std::vector<double> getVariableValues(Valuation<storm::RationalFunction> const& valuation) const;
+
+    /*!
+     * Evaluates the function with the given identifier in double precision.
+     *
+     * @param variableValues the values of the variables as obtained by getVariableValues
+     */
+    double evaluate(uint64_t id, std::vector<double> const& variableValues) const;
+
+    /*!
+     * Returns the size of the compiled functions in memory measured in bytes.
+     */
+    std::size_t getSizeOfCompiledFunctionsInBytes() const;
+
+   private:
+    uint64_t getOrAddVariableIndex(storm::RationalFunctionVariable const& variable);
+
+    void compilePolynomial(storm::RawPolynomial const& polynomial);
+
+    double evaluateTerms(uint64_t firstTerm, uint64_t endTerm, std::vector<double> const& variableValues) const;
+
+    std::unordered_map<storm::RationalFunction, uint64_t> functionToIdMap;
+    // Points to the keys of functionToIdMap, such that every function is only stored once.
+    // Note that references to elements of an unordered map remain valid after calling unordered_map::emplace.
+    std::vector<storm::RationalFunction const*> functions;
+    uint64_t numberOfAddedFunctions;
+
+    std::vector<storm::RationalFunctionVariable> variables;
+    std::map<storm::RationalFunctionVariable, uint64_t> variableToIndexMap;
+
+    // The terms of the numerator of the i-th function are the ones with indices functionTermIndices[2i] to functionTermIndices[2i+1] (excluded), followed
+    // by the terms of its denominator (up to functionTermIndices[2i+2]).
+    std::vector<uint64_t> functionTermIndices;
+    std::vector<double> termCoefficients;
+    // The variables (with exponents) of the i-th term are the ones with indices termVariableIndices[i] to termVariableIndices[i+1] (excluded).
+    std::vector<uint64_t> termVariableIndices;
+    std::vector<std::pair<uint64_t, uint64_t>> variablesWithExponents;
+};
+
+}  // namespace parametric
+}  // namespace utility
+}  // namespace storm
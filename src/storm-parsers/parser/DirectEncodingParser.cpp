@@ -19,6 +19,7 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 
+#include "storm/io/CompressedFileStream.h"
 #include "storm/io/file.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -35,8 +36,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     std::string const& filename, DirectEncodingParserOptions const& options) {
     // Load file
     STORM_LOG_INFO("Reading from file " << filename);
-    std::ifstream file;
-    storm::utility::openFile(filename, file);
+    // Compressed files are detected by their extension (.gz or .zst).
+    storm::io::CompressedInputFileStream file(filename);
     std::string line;
 
     // Initialize
@@ -124,8 +125,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
         }
     }
-    // Done parsing
-    storm::utility::closeFile(file);
+    // Done parsing, the file is closed when the stream goes out of scope.
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
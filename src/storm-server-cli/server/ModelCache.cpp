@@ -0,0 +1,86 @@
+#include "storm-server-cli/server/ModelCache.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace server {
+
+ModelCache::ModelCache(uint64_t maximalNumberOfModels, uint64_t maximalMemoryInBytes)
+    : maximalNumberOfModels(maximalNumberOfModels), maximalMemoryInBytes(maximalMemoryInBytes), memoryInBytes(0) {
+    // Intentionally left empty.
+}
+
+std::shared_ptr<CachedModel> ModelCache::getModel(std::string const& key, std::function<std::shared_ptr<CachedModel>()> const& buildModel, bool& fromCache) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto findRes = entries.find(key);
+    if (findRes != entries.end()) {
+        Entry& entry = findRes->second;
+        recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, entry.recentlyUsedPosition);
+        std::shared_future<std::shared_ptr<CachedModel>> model = entry.model;
+        lock.unlock();
+        fromCache = true;
+        // Waits if the model is still being built.
+        return model.get();
+    }
+
+    // Insert a placeholder such that concurrent requests of the same model wait for this build.
+    std::promise<std::shared_ptr<CachedModel>> promise;
+    recentlyUsed.push_front(key);
+    entries.emplace(key, Entry{promise.get_future().share(), 0, false, recentlyUsed.begin()});
+    lock.unlock();
+    fromCache = false;
+
+    std::shared_ptr<CachedModel> result;
+    try {
+        result = buildModel();
+    } catch (...) {
+        lock.lock();
+        auto entryIt = entries.find(key);
+        recentlyUsed.erase(entryIt->second.recentlyUsedPosition);
+        entries.erase(entryIt);
+        lock.unlock();
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+    promise.set_value(result);
+
+    lock.lock();
+    Entry& entry = entries.at(key);
+    entry.memoryInBytes = estimateMemoryInBytes(*result->model);
+    entry.built = true;
+    memoryInBytes += entry.memoryInBytes;
+    evict();
+    return result;
+}
+
+uint64_t ModelCache::estimateMemoryInBytes(storm::models::sparse::Model<double> const& model) {
+    auto const& matrix = model.getTransitionMatrix();
+    uint64_t result = matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint64_t, double>);
+    result += (matrix.getRowCount() + matrix.getRowGroupCount() + 2) * sizeof(uint64_t);
+    // Each label is stored as a bit vector over the states.
+    result += model.getStateLabeling().getNumberOfLabels() * (model.getNumberOfStates() / 8 + 1);
+    // Each reward model has at most one value per state and per choice.
+    result += model.getNumberOfRewardModels() * (model.getNumberOfStates() + model.getNumberOfChoices()) * sizeof(double);
+    return result;
+}
+
+void ModelCache::evict() {
+    auto position = recentlyUsed.end();
+    while ((entries.size() > maximalNumberOfModels || memoryInBytes > maximalMemoryInBytes) && position != recentlyUsed.begin()) {
+        --position;
+        auto entryIt = entries.find(*position);
+        // Models that are still being built can not be evicted.
+        if (!entryIt->second.built) {
+            continue;
+        }
+        STORM_LOG_INFO("Evicting model from the cache, which frees approximately " << entryIt->second.memoryInBytes / (1024 * 1024) << "MB.");
+        memoryInBytes -= entryIt->second.memoryInBytes;
+        entries.erase(entryIt);
+        position = recentlyUsed.erase(position);
+    }
+}
+
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace server {
+
+/*!
+ * A built model together with the (preprocessed) symbolic description it was built from.
+ */
+struct CachedModel {
+    storm::storage::SymbolicModelDescription modelDescription;
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+
+    // Guards the expression manager of the model description, which is extended when parsing properties.
+    std::mutex parserMutex;
+};
+
+/*!
+ * A cache of built models that evicts the least recently used models if the number of models or their (estimated) memory exceeds the given limits.
+ * All methods are thread-safe.
+ */
+class ModelCache {
+   public:
+    /*!
+     * Creates an empty cache.
+     *
+     * @param maximalNumberOfModels The number of models that are kept at most.
+     * @param maximalMemoryInBytes The (estimated) memory that is occupied by the kept models at most.
+     */
+    ModelCache(uint64_t maximalNumberOfModels, uint64_t maximalMemoryInBytes);
+
+    /*!
+     * Retrieves the model with the given key. If it is not cached, it is built with the given function and inserted into the cache.
+     * If the same model is requested while it is being built, it is not built again but the requests wait for the first build to finish.
+     *
+     * @param key A key that uniquely identifies the model, e.g., the content of the model file together with the constants and build options.
+     * @param buildModel Builds the model if necessary. Exceptions are passed on to all requests that wait for this model.
+     * @param fromCache Is set to true iff the model did not have to be built for this request.
+     */
+    std::shared_ptr<CachedModel> getModel(std::string const& key, std::function<std::shared_ptr<CachedModel>()> const& buildModel, bool& fromCache);
+
+    /*!
+     * Estimates the memory in bytes that is occupied by the given model.
+     */
+    static uint64_t estimateMemoryInBytes(storm::models::sparse::Model<double> const& model);
+
+   private:
+    struct Entry {
+        std::shared_future<std::shared_ptr<CachedModel>> model;
+        // The estimated memory of the model, which is zero as long as the model is being built.
+        uint64_t memoryInBytes;
+        bool built;
+        std::list<std::string>::iterator recentlyUsedPosition;
+    };
+
+    // Removes the least recently used models until the limits are met. Requires that the mutex is locked.
+    void evict();
+
+    uint64_t maximalNumberOfModels;
+    uint64_t maximalMemoryInBytes;
+
+    // Guards all members below.
+    std::mutex mutex;
+
+    // The keys of the cached models, where the most recently used model comes first.
+    std::list<std::string> recentlyUsed;
+    std::unordered_map<std::string, Entry> entries;
+    uint64_t memoryInBytes;
+};
+
+}  // namespace server
+}  // namespace storm
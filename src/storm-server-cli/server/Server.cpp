@@ -0,0 +1,357 @@
+#include "storm-server-cli/server/Server.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "storm-cli-utilities/concurrency.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/file.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/QualitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace server {
+
+namespace {
+// The time in milliseconds after which blocking operations check whether the termination of the process was requested.
+int const pollTimeout = 1000;
+
+// Waits until the given file descriptor is readable. Returns false if the termination of the process was requested before or if the given timeout (in
+// milliseconds) expired. A timeout of zero means that there is no timeout.
+bool waitUntilReadable(int fileDescriptor, uint64_t timeout = 0) {
+    pollfd request{fileDescriptor, POLLIN, 0};
+    auto const start = std::chrono::steady_clock::now();
+    while (!storm::utility::resources::isTerminate()) {
+        int waitTime = pollTimeout;
+        if (timeout > 0) {
+            uint64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            if (elapsed >= timeout) {
+                return false;
+            }
+            waitTime = std::min<uint64_t>(pollTimeout, timeout - elapsed);
+        }
+        int pollRes = poll(&request, 1, waitTime);
+        if (pollRes > 0) {
+            return true;
+        }
+        STORM_LOG_THROW(pollRes == 0 || errno == EINTR, storm::exceptions::FileIoException, "Unable to wait for input: " << std::strerror(errno) << ".");
+    }
+    return false;
+}
+
+// Removes the file at the given path if it is a socket. Returns false if the file exists but is not a socket.
+bool removeSocket(std::string const& path) {
+    struct stat fileStatus;
+    if (lstat(path.c_str(), &fileStatus) != 0) {
+        // There is nothing to remove.
+        return true;
+    }
+    if (!S_ISSOCK(fileStatus.st_mode)) {
+        return false;
+    }
+    unlink(path.c_str());
+    return true;
+}
+
+// Writes the given data to the connection. Returns false if the connection was closed by the client.
+bool writeAll(int connection, std::string const& data) {
+    uint64_t written = 0;
+    while (written < data.size()) {
+        ssize_t writeRes = write(connection, data.data() + written, data.size() - written);
+        if (writeRes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += writeRes;
+    }
+    return true;
+}
+
+std::string readFile(std::string const& filename) {
+    std::ifstream stream;
+    storm::utility::openFile(filename, stream);
+    std::stringstream content;
+    content << stream.rdbuf();
+    storm::utility::closeFile(stream);
+    return content.str();
+}
+
+storm::json<double> resultToJson(storm::modelchecker::CheckResult const& result) {
+    if (result.isQuantitative()) {
+        auto const& quantitativeResult = result.asQuantitativeCheckResult<double>();
+        double min = quantitativeResult.getMin();
+        double max = quantitativeResult.getMax();
+        if (min == max) {
+            return min;
+        }
+        return storm::json<double>{{"min", min}, {"max", max}};
+    } else if (result.isQualitative()) {
+        auto const& qualitativeResult = result.asQualitativeCheckResult();
+        if (qualitativeResult.forallTrue() || !qualitativeResult.existsTrue()) {
+            return qualitativeResult.forallTrue();
+        }
+        return storm::json<double>{{"forall", false}, {"exists", true}};
+    }
+    std::stringstream stream;
+    stream << result;
+    return stream.str();
+}
+}  // namespace
+
+Server::Server(std::string const& socketPath, uint64_t numberOfWorkers, ModelCache& modelCache, uint64_t idleTimeout)
+    : socketPath(socketPath), numberOfWorkers(numberOfWorkers), modelCache(modelCache), idleTimeout(idleTimeout), stopWorkers(false) {
+    // Intentionally left empty.
+}
+
+void Server::run() {
+    // Clients that close their connection early must not terminate the server.
+    std::signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    STORM_LOG_THROW(socketPath.size() < sizeof(address.sun_path), storm::exceptions::InvalidArgumentException,
+                    "The socket path '" << socketPath << "' is too long.");
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    // Remove the socket of a previous server, if any, but never any other file.
+    STORM_LOG_THROW(removeSocket(socketPath), storm::exceptions::FileIoException,
+                    "The path '" << socketPath << "' already exists and is not a socket. Please remove it or choose another socket path.");
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    STORM_LOG_THROW(listener >= 0, storm::exceptions::FileIoException, "Unable to create socket: " << std::strerror(errno) << ".");
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, SOMAXCONN) != 0) {
+        close(listener);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to listen on socket '" << socketPath << "': " << std::strerror(errno) << ".");
+    }
+    STORM_PRINT_AND_LOG("Listening on socket '" << socketPath << "' with " << numberOfWorkers << " workers.\n");
+
+    std::vector<std::thread> workers;
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        workers.emplace_back([this]() {
+            while (true) {
+                int connection;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    pendingConnectionsChanged.wait(lock, [this]() { return stopWorkers || !pendingConnections.empty(); });
+                    if (pendingConnections.empty()) {
+                        return;
+                    }
+                    connection = pendingConnections.front();
+                    pendingConnections.pop_front();
+                }
+                pendingConnectionsChanged.notify_all();
+                try {
+                    serveConnection(connection);
+                } catch (std::exception const& exception) {
+                    STORM_LOG_ERROR("Connection aborted: " << exception.what());
+                }
+                close(connection);
+            }
+        });
+    }
+
+    try {
+        // The time in milliseconds to wait before accepting connections again after an error.
+        uint64_t backoff = 0;
+        while (waitUntilReadable(listener)) {
+            int connection = accept(listener, nullptr, nullptr);
+            if (connection < 0) {
+                if (errno != EINTR && errno != ECONNABORTED) {
+                    // Errors such as too many open files persist for a while, so we do not retry immediately.
+                    backoff = std::clamp<uint64_t>(2 * backoff, 10, pollTimeout);
+                    STORM_LOG_WARN("Unable to accept connection: " << std::strerror(errno) << ". Retrying in " << backoff << "ms.");
+                    std::this_thread::sleep_for(std::chrono::milliseconds(backoff));
+                }
+                continue;
+            }
+            backoff = 0;
+            // Clients that do not receive their responses must not block a worker forever.
+            timeval sendTimeout{static_cast<time_t>(idleTimeout), 0};
+            STORM_LOG_WARN_COND(setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout)) == 0,
+                                "Unable to set the send timeout of a connection: " << std::strerror(errno) << ".");
+            // Do not accept more connections than can be served soon.
+            std::unique_lock<std::mutex> lock(mutex);
+            pendingConnectionsChanged.wait(lock, [this]() { return pendingConnections.size() < numberOfWorkers; });
+            pendingConnections.push_back(connection);
+            lock.unlock();
+            pendingConnectionsChanged.notify_all();
+        }
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("Unable to accept further connections: " << exception.what());
+    }
+
+    STORM_PRINT_AND_LOG("Stopping the server.\n");
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopWorkers = true;
+    }
+    pendingConnectionsChanged.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    close(listener);
+    STORM_LOG_WARN_COND(removeSocket(socketPath), "The socket '" << socketPath << "' has been replaced by another file, which is not removed.");
+}
+
+void Server::serveConnection(int connection) {
+    bool connectionOpen = true;
+    auto respond = [&connection, &connectionOpen](storm::json<double> const& response) {
+        if (connectionOpen) {
+            connectionOpen = writeAll(connection, storm::dumpJson(response, true) + "\n");
+        }
+    };
+
+    std::string buffer;
+    char chunk[4096];
+    while (connectionOpen) {
+        if (!waitUntilReadable(connection, idleTimeout * 1000)) {
+            STORM_LOG_WARN_COND(storm::utility::resources::isTerminate(), "Closing connection as no request was received for " << idleTimeout << " seconds.");
+            break;
+        }
+        ssize_t readRes = read(connection, chunk, sizeof(chunk));
+        if (readRes < 0 && errno == EINTR) {
+            continue;
+        } else if (readRes <= 0) {
+            break;
+        }
+        buffer.append(chunk, readRes);
+
+        // Process all complete lines.
+        std::size_t lineStart = 0;
+        for (std::size_t lineEnd = buffer.find('\n'); lineEnd != std::string::npos; lineEnd = buffer.find('\n', lineStart)) {
+            std::string request = buffer.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+            if (request.find_first_not_of(" \t\r") != std::string::npos) {
+                processRequest(request, respond);
+            }
+        }
+        buffer.erase(0, lineStart);
+    }
+}
+
+void Server::processRequest(std::string const& request, std::function<void(storm::json<double> const&)> const& respond) {
+    storm::json<double> id;
+    try {
+        storm::json<double> parsedRequest = storm::json<double>::parse(request);
+        STORM_LOG_THROW(parsedRequest.is_object(), storm::exceptions::InvalidArgumentException, "Expected a JSON object as request.");
+        if (parsedRequest.count("id") > 0) {
+            id = parsedRequest["id"];
+        }
+        STORM_LOG_THROW(parsedRequest.count("model") > 0 && parsedRequest.count("properties") > 0, storm::exceptions::InvalidArgumentException,
+                        "Expected a model file and properties in the request.");
+        std::string modelFile = parsedRequest["model"].get<std::string>();
+        std::string propertiesString = parsedRequest["properties"].get<std::string>();
+        std::string constants = parsedRequest.value("constants", std::string());
+        std::string engine = parsedRequest.value("engine", std::string("sparse"));
+        STORM_LOG_THROW(engine == "sparse", storm::exceptions::NotSupportedException, "The engine '" << engine << "' is not supported by the server.");
+        storm::json<double> buildOptions = parsedRequest.value("build-options", storm::json<double>::object());
+        bool buildStateValuations = buildOptions.value("state-valuations", false);
+        bool buildChoiceLabels = buildOptions.value("choice-labels", false);
+
+        storm::Environment env;
+        if (parsedRequest.count("precision") > 0) {
+            storm::RationalNumber precision = storm::utility::convertNumber<storm::RationalNumber>(parsedRequest["precision"].get<double>());
+            env.solver().setLinearEquationSolverPrecision(precision);
+            env.solver().minMax().setPrecision(precision);
+        }
+        if (parsedRequest.value("sound", false)) {
+            env.solver().setForceSoundness(true);
+        }
+
+        // The model is identified by the full content of the model file, such that changes of the file are detected.
+        std::string modelContent = readFile(modelFile);
+        bool isJani = modelFile.size() >= 5 && modelFile.compare(modelFile.size() - 5, 5, ".jani") == 0;
+        std::stringstream key;
+        key << (isJani ? "jani" : "prism") << '\n' << constants.size() << '\n' << constants << '\n' << buildStateValuations << buildChoiceLabels << '\n'
+            << modelContent;
+
+        bool fromCache;
+        std::shared_ptr<CachedModel> cachedModel = modelCache.getModel(
+            key.str(),
+            [&]() {
+                auto result = std::make_shared<CachedModel>();
+                storm::storage::SymbolicModelDescription modelDescription;
+                if (isJani) {
+                    modelDescription = storm::api::parseJaniModelFromString(modelContent).first;
+                } else {
+                    storm::prism::Program program = storm::parser::PrismParser::parseFromString(modelContent, modelFile).simplify().simplify();
+                    program.checkValidity();
+                    modelDescription = program;
+                }
+                result->modelDescription = modelDescription.preprocess(constants);
+                // Build all labels and reward models such that the cached model can be used for arbitrary properties.
+                storm::builder::BuilderOptions options(true, true);
+                options.setBuildStateValuations(buildStateValuations).setBuildChoiceLabels(buildChoiceLabels);
+                result->model = storm::api::buildSparseModel<double>(result->modelDescription, options);
+                // Make sure that lazily created data is available before the model is shared between requests.
+                storm::cli::prepareForConcurrentAccess(*result->model);
+                return result;
+            },
+            fromCache);
+
+        std::vector<storm::jani::Property> properties;
+        {
+            std::lock_guard<std::mutex> lock(cachedModel->parserMutex);
+            properties = storm::api::parsePropertiesForSymbolicModelDescription(propertiesString, cachedModel->modelDescription);
+        }
+        storm::modelchecker::ExplicitQualitativeCheckResult initialStatesFilter(cachedModel->model->getInitialStates());
+        for (auto const& property : properties) {
+            std::stringstream formula;
+            formula << *property.getRawFormula();
+            storm::json<double> response{{"id", id}, {"property", property.getName()}, {"formula", formula.str()}};
+            try {
+                // Other workers might check properties concurrently.
+                auto ltlLock = storm::cli::lockIfLtlTranslationRequired(*property.getRawFormula());
+                storm::utility::Stopwatch watch(true);
+                auto result =
+                    storm::api::verifyWithSparseEngine<double>(env, cachedModel->model, storm::api::createTask<double>(property.getRawFormula(), true));
+                watch.stop();
+                STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The property is not supported by the sparse engine.");
+                result->filter(initialStatesFilter);
+                response["result"] = resultToJson(*result);
+                response["time"] = watch.getTimeInMilliseconds() / 1000.0;
+            } catch (std::exception const& exception) {
+                response["error"] = exception.what();
+            }
+            respond(response);
+        }
+        respond(storm::json<double>{{"id", id},
+                                    {"done", true},
+                                    {"model-from-cache", fromCache},
+                                    {"states", cachedModel->model->getNumberOfStates()},
+                                    {"transitions", cachedModel->model->getNumberOfTransitions()}});
+    } catch (std::exception const& exception) {
+        respond(storm::json<double>{{"id", id}, {"done", true}, {"error", exception.what()}});
+    }
+}
+
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "storm-server-cli/server/ModelCache.h"
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace server {
+
+/*!
+ * A model checking server that listens on a UNIX domain socket and keeps built models in a cache.
+ *
+ * Each line that is received on a connection is a request, which is a JSON object with the following fields:
+ *  - "id": An arbitrary value that is copied to all responses of this request (optional).
+ *  - "model": The path of the PRISM or JANI (if the file ends with .jani) model file.
+ *  - "constants": The definitions of undefined constants, e.g., "N=3,K=2" (optional).
+ *  - "properties": The properties to check, separated by semicolons.
+ *  - "build-options": An object with the flags "state-valuations" and "choice-labels" (optional).
+ *  - "engine": The engine to use, where only "sparse" is supported (optional).
+ *  - "precision": The precision of the numerical solvers (optional).
+ *  - "sound": Whether sound solution methods are to be used (optional).
+ * For each property, a line with a JSON object with fields "id", "property", "formula" and either "result" and "time" or "error" is sent once the property
+ * is checked. Afterwards, a line with an object with fields "id", "done", "model-from-cache", "states" and "transitions" is sent. If the request can not be
+ * processed, a line with an object with fields "id", "done" and "error" is sent instead.
+ */
+class Server {
+   public:
+    /*!
+     * Creates a server that listens on the given socket.
+     *
+     * @param socketPath The path of the UNIX domain socket. An existing socket at this path is removed, any other existing file is kept and the server does
+     * not start.
+     * @param numberOfWorkers The number of connections that are served concurrently.
+     * @param modelCache The cache of built models.
+     * @param idleTimeout The time in seconds after which a connection without incoming requests is closed. Sending a response is aborted after the same
+     * time, if the client does not receive it.
+     */
+    Server(std::string const& socketPath, uint64_t numberOfWorkers, ModelCache& modelCache, uint64_t idleTimeout);
+
+    /*!
+     * Serves requests until the termination of the process is requested by a signal.
+     */
+    void run();
+
+   private:
+    // Processes the requests that are received on the given connection until it is closed.
+    void serveConnection(int connection);
+
+    // Processes a single request and sends the responses using the given function.
+    void processRequest(std::string const& request, std::function<void(storm::json<double> const&)> const& respond);
+
+    std::string socketPath;
+    uint64_t numberOfWorkers;
+    ModelCache& modelCache;
+    uint64_t idleTimeout;
+
+    // Connections that have been accepted but are not yet served by a worker.
+    std::deque<int> pendingConnections;
+    bool stopWorkers;
+    std::mutex mutex;
+    std::condition_variable pendingConnectionsChanged;
+};
+
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,75 @@
+#include "storm-server-cli/settings/modules/ServerSettings.h"
+
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string ServerSettings::moduleName = "server";
+const std::string ServerSettings::socketOptionName = "socket";
+const std::string ServerSettings::workersOptionName = "workers";
+const std::string ServerSettings::cacheSizeOptionName = "cachesize";
+const std::string ServerSettings::cacheMemoryOptionName = "cachememory";
+const std::string ServerSettings::idleTimeoutOptionName = "idletimeout";
+
+ServerSettings::ServerSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, socketOptionName, false, "The UNIX domain socket on which the server listens for requests.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The path of the socket.")
+                                         .setDefaultValueString("storm-server.sock")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, workersOptionName, false, "The number of connections that are served concurrently.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of worker threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(4)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, cacheSizeOptionName, false, "The maximal number of built models that are kept in the cache.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of models.")
+                                         .setDefaultValueUnsignedInteger(8)
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, cacheMemoryOptionName, false,
+                                       "The maximal memory occupied by cached models. Least recently used models are evicted if it is exceeded.")
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory in megabytes.")
+                             .setDefaultValueUnsignedInteger(2048)
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, idleTimeoutOptionName, false,
+                                                   "Connections on which no request is received for the given time are closed to free their worker.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seconds", "The timeout in seconds.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(60)
+                                         .build())
+                        .build());
+}
+
+std::string ServerSettings::getSocketPath() const {
+    return this->getOption(socketOptionName).getArgumentByName("path").getValueAsString();
+}
+
+uint64_t ServerSettings::getNumberOfWorkers() const {
+    return this->getOption(workersOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t ServerSettings::getMaximalNumberOfCachedModels() const {
+    return this->getOption(cacheSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t ServerSettings::getMaximalCacheMemory() const {
+    return this->getOption(cacheMemoryOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+}
+
+uint64_t ServerSettings::getIdleTimeout() const {
+    return this->getOption(idleTimeoutOptionName).getArgumentByName("seconds").getValueAsUnsignedInteger();
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "storm-config.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the model checking server.
+ */
+class ServerSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of server settings.
+     */
+    ServerSettings();
+
+    /*!
+     * Retrieves the path of the UNIX domain socket on which the server listens.
+     */
+    std::string getSocketPath() const;
+
+    /*!
+     * Retrieves the number of worker threads, i.e., the number of connections that are served concurrently.
+     */
+    uint64_t getNumberOfWorkers() const;
+
+    /*!
+     * Retrieves the maximal number of models that are kept in the cache.
+     */
+    uint64_t getMaximalNumberOfCachedModels() const;
+
+    /*!
+     * Retrieves the maximal (estimated) memory in megabytes that is occupied by the cached models.
+     */
+    uint64_t getMaximalCacheMemory() const;
+
+    /*!
+     * Retrieves the time in seconds after which connections without incoming requests are closed.
+     */
+    uint64_t getIdleTimeout() const;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string socketOptionName;
+    static const std::string workersOptionName;
+    static const std::string cacheSizeOptionName;
+    static const std::string cacheMemoryOptionName;
+    static const std::string idleTimeoutOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
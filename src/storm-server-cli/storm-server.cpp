@@ -0,0 +1,35 @@
+#include "storm/exceptions/BaseException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/macros.h"
+
+#include "storm-cli-utilities/cli.h"
+#include "storm-server-cli/server/ModelCache.h"
+#include "storm-server-cli/server/Server.h"
+#include "storm-server-cli/settings/modules/ServerSettings.h"
+
+void processOptions() {
+    auto const& serverSettings = storm::settings::getModule<storm::settings::modules::ServerSettings>();
+    storm::server::ModelCache modelCache(serverSettings.getMaximalNumberOfCachedModels(), serverSettings.getMaximalCacheMemory() * 1024 * 1024);
+    storm::server::Server server(serverSettings.getSocketPath(), serverSettings.getNumberOfWorkers(), modelCache, serverSettings.getIdleTimeout());
+    server.run();
+}
+
+void initSettings(std::string const& name, std::string const& executableName) {
+    storm::settings::initializeAll(name, executableName);
+    storm::settings::addModule<storm::settings::modules::ServerSettings>();
+}
+
+/*!
+ * Main entry point of the executable storm-server.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        return storm::cli::process("Storm-server", "storm-server", initSettings, processOptions, argc, argv);
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-server to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-server to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
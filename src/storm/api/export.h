@@ -2,12 +2,15 @@
 
 #include "storm/adapters/JsonForward.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/CompressedFileStream.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/macros.h"
 
@@ -24,12 +27,15 @@ void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& fi
 template<typename ValueType>
 void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename,
                             std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true) {
-    std::ofstream stream;
-    storm::utility::openFile(filename, stream);
+    // The file is compressed if its extension asks for it (.gz or .zst).
+    storm::io::CompressedOutputFileStream stream(filename);
+    stream.precision(std::cout.precision());
+    STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
     storm::exporter::DirectEncodingOptions options;
     options.allowPlaceholders = allowPlaceholders;
+    options.parallelize = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
     storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
-    storm::utility::closeFile(stream);
+    stream.close();
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -2,6 +2,7 @@
 
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
+#include "storm/transformer/StatePermuter.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -146,5 +147,17 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> transformToNondetermini
     }
 }
 
+/*!
+ * Renumbers the states of the given model according to the given order.
+ * Labels, rewards, valuations and choice origins are permuted accordingly so that properties referring to them can be checked on the result.
+ * Results obtained on the returned model refer to the new state indices. Use storm::transformer::permuteStates to obtain the mapping to the original
+ * ones and storm::transformer::translateToOriginalStates to translate the results.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> permuteModelStates(storm::models::sparse::Model<ValueType> const& model,
+                                                                            storm::transformer::StateOrder order) {
+    return storm::transformer::permuteStates(model, order).model;
+}
+
 }  // namespace api
 }  // namespace storm
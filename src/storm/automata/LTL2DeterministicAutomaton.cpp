@@ -8,6 +8,10 @@
 #include "storm/utility/macros.h"
 
 #include <sys/wait.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
 
 #ifdef STORM_HAVE_SPOT
 #include "spot/tl/formula.hh"
@@ -65,16 +69,25 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(s
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool) {
     std::string prefixLtl = f.toPrefixString();
 
-    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' da.hoa");
+    // The automaton is written to a unique temporary file as several automata might be constructed concurrently.
+    std::string hoaFile = (std::filesystem::temp_directory_path() / "storm-da-XXXXXX").string();
+    int fd = mkstemp(hoaFile.data());
+    STORM_LOG_THROW(fd >= 0, storm::exceptions::FileIoException, "Could not create temporary file for deterministic automaton: " << strerror(errno));
+    close(fd);
+
+    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' " << hoaFile);
 
     pid_t pid;
 
     pid = fork();
+    if (pid < 0) {
+        std::filesystem::remove(hoaFile);
+    }
     STORM_LOG_THROW(pid >= 0, storm::exceptions::FileIoException, "Could not construct deterministic automaton, fork failed");
 
     if (pid == 0) {
         // we are in the child process
-        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), "da.hoa", NULL) < 0) {
+        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), hoaFile.c_str(), NULL) < 0) {
             std::cerr << "ERROR: exec failed: " << strerror(errno) << '\n';
             std::exit(1);
         }
@@ -83,22 +96,40 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
     } else {  // in the parent
         int status;
 
-        // wait for completion
-        while (wait(&status) != pid)
-            ;
+        // wait for completion of this particular child, other threads might have started their own
+        while (waitpid(pid, &status, 0) < 0) {
+            if (errno != EINTR) {
+                std::string error = strerror(errno);
+                std::filesystem::remove(hoaFile);
+                STORM_LOG_THROW(false, storm::exceptions::FileIoException,
+                                "Could not construct deterministic automaton, waiting for process failed: " << error);
+            }
+        }
 
-        int rv;
+        int rv = -1;
         if (WIFEXITED(status)) {
             rv = WEXITSTATUS(status);
         } else {
+            std::filesystem::remove(hoaFile);
             STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Could not construct deterministic automaton: process aborted");
         }
+        if (rv != 0) {
+            std::filesystem::remove(hoaFile);
+        }
         STORM_LOG_THROW(rv == 0, storm::exceptions::FileIoException,
                         "Could not construct deterministic automaton for " << prefixLtl << ", return code = " << rv);
 
-        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from da.hoa");
+        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from " << hoaFile);
 
-        return DeterministicAutomaton::parseFromFile("da.hoa");
+        std::shared_ptr<DeterministicAutomaton> result;
+        try {
+            result = DeterministicAutomaton::parseFromFile(hoaFile);
+        } catch (...) {
+            std::filesystem::remove(hoaFile);
+            throw;
+        }
+        std::filesystem::remove(hoaFile);
+        return result;
     }
 }
 
@@ -1,5 +1,6 @@
 #include "storm/builder/DdJaniModelBuilder.h"
 
+#include <functional>
 #include <sstream>
 
 #include <boost/algorithm/string/join.hpp>
@@ -1608,6 +1609,7 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
         std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToWritingFragment;
 
         bool overlappingGuards = false;
+        std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
         for (auto const& edge : edgeDds) {
             STORM_LOG_THROW(edge.isMarkovian, storm::exceptions::WrongFormatException, "Can only combine Markovian edges.");
 
@@ -1616,10 +1618,11 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
             }
 
             guard |= edge.guard;
-            transitions += edge.transitions;
+            edgeTransitions.push_back(edge.transitions);
             variableToWritingFragment = joinVariableWritingFragmentMaps(variableToWritingFragment, edge.variableToWritingFragment);
             joinTransientAssignmentMapsInPlace(transientEdgeAssignments, edge.transientEdgeAssignments);
         }
+        transitions = storm::utility::dd::combineBalanced(std::move(edgeTransitions), transitions, std::plus<>());
 
         // Currently, we can only combine the transient edge assignments if there is no overlap of the guards of the edges.
         STORM_LOG_THROW(!overlappingGuards || transientEdgeAssignments.empty(), storm::exceptions::NotSupportedException,
@@ -1723,6 +1726,7 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
         std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
         std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
         bool overlappingGuards = false;
+        std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
         for (auto const& edgeDd : edgeDds) {
             STORM_LOG_THROW(
                 (this->model.getModelType() == storm::jani::ModelType::CTMC || this->model.getModelType() == storm::jani::ModelType::MA) == edgeDd.isMarkovian,
@@ -1736,9 +1740,9 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 !overlappingGuards || this->model.getModelType() == storm::jani::ModelType::CTMC || this->model.getModelType() == storm::jani::ModelType::MA,
                 "Guard of an edge in a DTMC overlaps with previous guards.");
 
-            // Add the elements of the current edge to the global ones.
+            // Add the elements of the current edge to the global ones. The transitions are summed up afterwards.
             allGuards |= edgeDd.guard;
-            allTransitions += edgeDd.transitions;
+            edgeTransitions.push_back(edgeDd.transitions);
 
             // Add the transient variable assignments to the resulting one. This transformation is illegal for
             // CTMCs for which there is some overlap in edges that have some transient assignment (this needs to
@@ -1749,6 +1753,8 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
             globalVariableToWritingFragment = joinVariableWritingFragmentMaps(globalVariableToWritingFragment, edgeDd.variableToWritingFragment);
         }
 
+        allTransitions = storm::utility::dd::combineBalanced(std::move(edgeTransitions), allTransitions, std::plus<>());
+
         STORM_LOG_THROW(this->model.getModelType() == storm::jani::ModelType::DTMC || !overlappingGuards || transientEdgeAssignments.empty(),
                         storm::exceptions::NotSupportedException,
                         "Cannot have transient edge assignments when combining Markovian edges with overlapping guards.");
@@ -1796,8 +1802,9 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
         std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
         std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
 
+        std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
         for (auto const& edge : edges) {
-            transitions += edge.transitions;
+            edgeTransitions.push_back(edge.transitions);
             for (auto const& assignment : edge.transientEdgeAssignments) {
                 addToTransientAssignmentMap(transientEdgeAssignments, assignment.first, assignment.second);
             }
@@ -1805,6 +1812,7 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 addToVariableWritingFragmentMap(globalVariableToWritingFragment, variableFragment.first, variableFragment.second);
             }
         }
+        transitions = storm::utility::dd::combineBalanced(std::move(edgeTransitions), transitions, std::plus<>());
 
         return ActionDd(guard, transitions, transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment,
                         this->variables.manager->getBddZero());
@@ -1813,12 +1821,16 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
     ActionDd combineEdgesToActionNondeterministic(std::vector<EdgeDd> const& edges, uint64_t localNondeterminismVariableOffset) {
         // Sum all guards, so we can read off the maximal number of nondeterministic choices in any given state.
         storm::dd::Bdd<Type> allGuards = this->variables.manager->getBddZero();
-        storm::dd::Add<Type, uint_fast64_t> sumOfGuards = this->variables.manager->template getAddZero<uint_fast64_t>();
+        std::vector<storm::dd::Add<Type, uint_fast64_t>> guardAdds;
+        std::vector<storm::dd::Bdd<Type>> guards;
         for (auto const& edge : edges) {
             STORM_LOG_ASSERT(!edge.isMarkovian, "Unexpected Markovian edge.");
-            sumOfGuards += edge.guard.template toAdd<uint_fast64_t>();
-            allGuards |= edge.guard;
+            guardAdds.push_back(edge.guard.template toAdd<uint_fast64_t>());
+            guards.push_back(edge.guard);
         }
+        storm::dd::Add<Type, uint_fast64_t> sumOfGuards = storm::utility::dd::combineBalanced(
+            std::move(guardAdds), this->variables.manager->template getAddZero<uint_fast64_t>(), std::plus<>());
+        allGuards = storm::utility::dd::combineBalanced(std::move(guards), allGuards, std::logical_or<>());
         uint_fast64_t maxChoices = sumOfGuards.getMax();
         STORM_LOG_TRACE("Found " << maxChoices << " non-Markovian local choices.");
 
@@ -1,6 +1,7 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 
 #include <boost/algorithm/string/join.hpp>
+#include <functional>
 
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
@@ -886,6 +887,8 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
     std::set<storm::expressions::Variable> assignedGlobalVariables = equalizeAssignedGlobalVariables(generationInfo, commandDds);
 
     // Then combine the commands to the full action DD and multiply missing identities along the way.
+    std::vector<storm::dd::Add<Type, ValueType>> commandTransitions;
+    commandTransitions.reserve(commandDds.size());
     for (auto& commandDd : commandDds) {
         // Check for overlapping guards.
         temporary = commandDd.guardDd && allGuards;
@@ -895,8 +898,9 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
                             "Guard of a command overlaps with previous guards.");
 
         allGuards |= commandDd.guardDd;
-        allCommands += commandDd.transitionsDd;
+        commandTransitions.push_back(commandDd.transitionsDd);
     }
+    allCommands = storm::utility::dd::combineBalanced(std::move(commandTransitions), allCommands, std::plus<>());
 
     return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
 }
@@ -933,11 +937,15 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
     std::set<storm::expressions::Variable> assignedGlobalVariables = equalizeAssignedGlobalVariables(generationInfo, commandDds);
 
     // Sum all guards, so we can read off the maximal number of nondeterministic choices in any given state.
-    storm::dd::Add<Type, uint_fast64_t> sumOfGuards = generationInfo.manager->template getAddZero<uint_fast64_t>();
+    std::vector<storm::dd::Add<Type, uint_fast64_t>> guardAdds;
+    std::vector<storm::dd::Bdd<Type>> guards;
     for (auto const& commandDd : commandDds) {
-        sumOfGuards += commandDd.guardDd.template toAdd<uint_fast64_t>();
-        allGuards |= commandDd.guardDd;
+        guardAdds.push_back(commandDd.guardDd.template toAdd<uint_fast64_t>());
+        guards.push_back(commandDd.guardDd);
     }
+    storm::dd::Add<Type, uint_fast64_t> sumOfGuards = storm::utility::dd::combineBalanced(
+        std::move(guardAdds), generationInfo.manager->template getAddZero<uint_fast64_t>(), std::plus<>());
+    allGuards = storm::utility::dd::combineBalanced(std::move(guards), allGuards, std::logical_or<>());
     uint_fast64_t maxChoices = sumOfGuards.getMax();
 
     STORM_LOG_TRACE("Found " << maxChoices << " local choices.");
@@ -947,9 +955,11 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
         return ActionDecisionDiagram(*generationInfo.manager);
     } else if (maxChoices == 1) {
         // Sum up all commands.
+        std::vector<storm::dd::Add<Type, ValueType>> commandTransitions;
         for (auto const& commandDd : commandDds) {
-            allCommands += commandDd.transitionsDd;
+            commandTransitions.push_back(commandDd.transitionsDd);
         }
+        allCommands = storm::utility::dd::combineBalanced(std::move(commandTransitions), allCommands, std::plus<>());
         return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
     } else {
         // Calculate number of required variables to encode the nondeterminism.
@@ -37,4 +37,8 @@ ModelCheckerEnvironment& Environment::modelchecker() {
 ModelCheckerEnvironment const& Environment::modelchecker() const {
     return internalEnv.get().modelcheckerEnvironment.get();
 }
+
+std::vector<Environment> Environment::copyPerWorker(uint64_t numberOfWorkers) const {
+    return std::vector<Environment>(numberOfWorkers, *this);
+}
 }  // namespace storm
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "storm/environment/SubEnvironment.h"
 
 namespace storm {
@@ -14,6 +17,10 @@ struct InternalEnvironment {
     SubEnvironment<ModelCheckerEnvironment> modelcheckerEnvironment;
 };
 
+/*!
+ * An environment is not thread-safe: its sub-environments are created lazily, even upon read access. Threads that work concurrently therefore need to
+ * use their own copy of the environment (see copyPerWorker). Copying an environment only reads the copied environment.
+ */
 class Environment {
    public:
     Environment();
@@ -26,6 +33,11 @@ class Environment {
     ModelCheckerEnvironment& modelchecker();
     ModelCheckerEnvironment const& modelchecker() const;
 
+    /*!
+     * Creates the given number of copies of this environment, e.g., one for each worker of a concurrent computation.
+     */
+    std::vector<Environment> copyPerWorker(uint64_t numberOfWorkers) const;
+
    private:
     SubEnvironment<InternalEnvironment> internalEnv;
 };
@@ -43,6 +43,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
     if (multiobjectiveSettings.isMaxStepsSet()) {
         maxSteps = multiobjectiveSettings.getMaxSteps();
     }
+    weightVectorBatchSize = multiobjectiveSettings.getWeightVectorBatchSize();
     if (multiobjectiveSettings.hasSchedulerRestriction()) {
         schedulerRestriction = multiobjectiveSettings.getSchedulerRestriction();
     }
@@ -165,6 +166,15 @@ void MultiObjectiveModelCheckerEnvironment::unsetMaxSteps() {
     maxSteps = boost::none;
 }
 
+uint64_t const& MultiObjectiveModelCheckerEnvironment::getWeightVectorBatchSize() const {
+    return weightVectorBatchSize;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setWeightVectorBatchSize(uint64_t const& value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The number of weight vectors per iteration has to be positive.");
+    weightVectorBatchSize = value;
+}
+
 bool MultiObjectiveModelCheckerEnvironment::isSchedulerRestrictionSet() const {
     return schedulerRestriction.is_initialized();
 }
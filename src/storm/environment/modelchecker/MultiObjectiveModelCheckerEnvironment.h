@@ -61,6 +61,9 @@ class MultiObjectiveModelCheckerEnvironment {
     void setMaxSteps(uint64_t const& value);
     void unsetMaxSteps();
 
+    uint64_t const& getWeightVectorBatchSize() const;
+    void setWeightVectorBatchSize(uint64_t const& value);
+
     bool isSchedulerRestrictionSet() const;
     storm::storage::SchedulerClass const& getSchedulerRestriction() const;
     void setSchedulerRestriction(storm::storage::SchedulerClass const& value);
@@ -82,6 +85,7 @@ class MultiObjectiveModelCheckerEnvironment {
     bool bsccOrderEncoding;
     bool redundantBsccConstraints;
     boost::optional<uint64_t> maxSteps;
+    uint64_t weightVectorBatchSize;
     boost::optional<storm::storage::SchedulerClass> schedulerRestriction;
     bool printResults;
     bool useLexicographicModelChecking;
@@ -23,6 +23,7 @@ GameSolverEnvironment::GameSolverEnvironment() {
     STORM_LOG_ASSERT(considerRelativeTerminationCriterion ||
                          gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Absolute,
                      "Unknown convergence criterion");
+    optimisticBounds = gameSettings.isOptimisticBoundsSet();
 }
 
 GameSolverEnvironment::~GameSolverEnvironment() {
@@ -66,4 +67,12 @@ void GameSolverEnvironment::setRelativeTerminationCriterion(bool value) {
     considerRelativeTerminationCriterion = value;
 }
 
+bool const& GameSolverEnvironment::isOptimisticBoundsSet() const {
+    return optimisticBounds;
+}
+
+void GameSolverEnvironment::setOptimisticBounds(bool value) {
+    optimisticBounds = value;
+}
+
 }  // namespace storm
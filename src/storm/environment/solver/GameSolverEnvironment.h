@@ -24,6 +24,8 @@ class GameSolverEnvironment {
     void setRelativeTerminationCriterion(bool value);
     storm::solver::MultiplicationStyle const& getMultiplicationStyle() const;
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
+    bool const& isOptimisticBoundsSet() const;
+    void setOptimisticBounds(bool value);
 
    private:
     storm::solver::GameMethod gameMethod;
@@ -31,5 +33,6 @@ class GameSolverEnvironment {
     uint64_t maxIterationCount;
     storm::RationalNumber precision;
     bool considerRelativeTerminationCriterion;
+    bool optimisticBounds;
 };
 }  // namespace storm
@@ -25,6 +25,7 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     forceRequireUnique = minMaxSettings.isForceUniqueSolutionRequirementSet();
+    prioritizedValueIteration = minMaxSettings.isPrioritizedValueIterationSet();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +85,12 @@ void MinMaxSolverEnvironment::setForceRequireUnique(bool value) {
     forceRequireUnique = value;
 }
 
+bool MinMaxSolverEnvironment::isPrioritizedValueIteration() const {
+    return prioritizedValueIteration;
+}
+
+void MinMaxSolverEnvironment::setPrioritizedValueIteration(bool value) {
+    prioritizedValueIteration = value;
+}
+
 }  // namespace storm
@@ -26,6 +26,8 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isForceRequireUnique() const;
     void setForceRequireUnique(bool value);
+    bool isPrioritizedValueIteration() const;
+    void setPrioritizedValueIteration(bool value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +37,6 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool forceRequireUnique;
+    bool prioritizedValueIteration;
 };
 }  // namespace storm
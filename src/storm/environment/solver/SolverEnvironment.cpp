@@ -16,6 +16,7 @@ SolverEnvironment::SolverEnvironment() {
     auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     forceSoundness = generalSettings.isSoundSet();
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
+    singlePrecisionMatrix = generalSettings.isSinglePrecisionMatrixSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
 }
@@ -120,6 +121,14 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+bool SolverEnvironment::isSinglePrecisionMatrix() const {
+    return singlePrecisionMatrix;
+}
+
+void SolverEnvironment::setSinglePrecisionMatrix(bool value) {
+    SolverEnvironment::singlePrecisionMatrix = value;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
@@ -0,0 +1,391 @@
+#include "storm/io/CompressedFileStream.h"
+
+#include <cstdio>
+#include <vector>
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef STORM_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace io {
+
+namespace detail {
+
+// Data is passed to the file (or the compressor) in blocks of this size.
+static const std::size_t blockSize = 1ull << 20;
+
+/*!
+ * Stream buffer that collects the written data in a large block and passes full blocks to the underlying sink.
+ */
+class BlockOutputBuffer : public std::streambuf {
+   public:
+    BlockOutputBuffer() : block(blockSize) {
+        setp(block.data(), block.data() + block.size());
+    }
+
+    virtual ~BlockOutputBuffer() = default;
+
+    /*!
+     * Writes all pending data and closes the sink.
+     */
+    virtual void finish() = 0;
+
+   protected:
+    int_type overflow(int_type ch) override {
+        if (!flushBlock()) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(char const* data, std::streamsize count) override {
+        if (static_cast<std::size_t>(count) < block.size()) {
+            return std::streambuf::xsputn(data, count);
+        }
+        // Large chunks are passed to the sink directly.
+        if (!flushBlock() || !writeBlock(data, static_cast<std::size_t>(count))) {
+            return 0;
+        }
+        return count;
+    }
+
+    int sync() override {
+        return flushBlock() ? 0 : -1;
+    }
+
+    bool flushBlock() {
+        std::size_t size = pptr() - pbase();
+        if (size > 0 && !writeBlock(pbase(), size)) {
+            return false;
+        }
+        setp(block.data(), block.data() + block.size());
+        return true;
+    }
+
+    virtual bool writeBlock(char const* data, std::size_t size) = 0;
+
+   private:
+    std::vector<char> block;
+};
+
+/*!
+ * Stream buffer that obtains data in large blocks from the underlying source.
+ */
+class BlockInputBuffer : public std::streambuf {
+   public:
+    BlockInputBuffer() : block(blockSize) {
+        setg(block.data(), block.data(), block.data());
+    }
+
+    virtual ~BlockInputBuffer() = default;
+
+   protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        std::size_t size = readBlock(block.data(), block.size());
+        if (size == 0) {
+            return traits_type::eof();
+        }
+        setg(block.data(), block.data(), block.data() + size);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    /*!
+     * Reads at most the given number of bytes into the given memory. Returns the number of bytes read, where 0 indicates the end of the input.
+     */
+    virtual std::size_t readBlock(char* data, std::size_t size) = 0;
+
+   private:
+    std::vector<char> block;
+};
+
+class PlainOutputBuffer : public BlockOutputBuffer {
+   public:
+    PlainOutputBuffer(std::string const& filename) : file(std::fopen(filename.c_str(), "wb")) {
+        STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    }
+
+    ~PlainOutputBuffer() override {
+        if (file != nullptr) {
+            std::fclose(file);
+        }
+    }
+
+    void finish() override {
+        if (file != nullptr) {
+            bool success = flushBlock();
+            success &= std::fclose(file) == 0;
+            file = nullptr;
+            STORM_LOG_THROW(success, storm::exceptions::FileIoException, "Could not write to file.");
+        }
+    }
+
+   protected:
+    bool writeBlock(char const* data, std::size_t size) override {
+        return std::fwrite(data, 1, size, file) == size;
+    }
+
+   private:
+    std::FILE* file;
+};
+
+class PlainInputBuffer : public BlockInputBuffer {
+   public:
+    PlainInputBuffer(std::string const& filename) : file(std::fopen(filename.c_str(), "rb")) {
+        STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    }
+
+    ~PlainInputBuffer() override {
+        std::fclose(file);
+    }
+
+   protected:
+    std::size_t readBlock(char* data, std::size_t size) override {
+        return std::fread(data, 1, size, file);
+    }
+
+   private:
+    std::FILE* file;
+};
+
+#ifdef STORM_HAVE_ZLIB
+class GzipOutputBuffer : public BlockOutputBuffer {
+   public:
+    GzipOutputBuffer(std::string const& filename) : file(gzopen(filename.c_str(), "wb")) {
+        STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        gzbuffer(file, blockSize);
+    }
+
+    ~GzipOutputBuffer() override {
+        if (file != nullptr) {
+            gzclose(file);
+        }
+    }
+
+    void finish() override {
+        if (file != nullptr) {
+            bool success = flushBlock();
+            success &= gzclose(file) == Z_OK;
+            file = nullptr;
+            STORM_LOG_THROW(success, storm::exceptions::FileIoException, "Could not write gzip-compressed file.");
+        }
+    }
+
+   protected:
+    bool writeBlock(char const* data, std::size_t size) override {
+        // gzwrite only accepts sizes that fit into an unsigned int.
+        while (size > 0) {
+            unsigned chunk = static_cast<unsigned>(std::min<std::size_t>(size, blockSize));
+            if (gzwrite(file, data, chunk) != static_cast<int>(chunk)) {
+                return false;
+            }
+            data += chunk;
+            size -= chunk;
+        }
+        return true;
+    }
+
+   private:
+    gzFile file;
+};
+
+class GzipInputBuffer : public BlockInputBuffer {
+   public:
+    GzipInputBuffer(std::string const& filename) : file(gzopen(filename.c_str(), "rb")) {
+        STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        gzbuffer(file, blockSize);
+    }
+
+    ~GzipInputBuffer() override {
+        gzclose(file);
+    }
+
+   protected:
+    std::size_t readBlock(char* data, std::size_t size) override {
+        int read = gzread(file, data, static_cast<unsigned>(size));
+        STORM_LOG_THROW(read >= 0, storm::exceptions::FileIoException, "Could not read gzip-compressed file.");
+        return static_cast<std::size_t>(read);
+    }
+
+   private:
+    gzFile file;
+};
+#endif
+
+#ifdef STORM_HAVE_ZSTD
+class ZstdOutputBuffer : public BlockOutputBuffer {
+   public:
+    ZstdOutputBuffer(std::string const& filename) : file(std::fopen(filename.c_str(), "wb")), context(ZSTD_createCCtx()), output(ZSTD_CStreamOutSize()) {
+        STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    }
+
+    ~ZstdOutputBuffer() override {
+        if (file != nullptr) {
+            std::fclose(file);
+        }
+        ZSTD_freeCCtx(context);
+    }
+
+    void finish() override {
+        if (file != nullptr) {
+            bool success = flushBlock() && compress(nullptr, 0, ZSTD_e_end);
+            success &= std::fclose(file) == 0;
+            file = nullptr;
+            STORM_LOG_THROW(success, storm::exceptions::FileIoException, "Could not write zstd-compressed file.");
+        }
+    }
+
+   protected:
+    bool writeBlock(char const* data, std::size_t size) override {
+        return compress(data, size, ZSTD_e_continue);
+    }
+
+   private:
+    bool compress(char const* data, std::size_t size, ZSTD_EndDirective directive) {
+        ZSTD_inBuffer input = {data, size, 0};
+        bool done = false;
+        while (!done) {
+            ZSTD_outBuffer out = {output.data(), output.size(), 0};
+            std::size_t remaining = ZSTD_compressStream2(context, &out, &input, directive);
+            if (ZSTD_isError(remaining) || std::fwrite(output.data(), 1, out.pos, file) != out.pos) {
+                return false;
+            }
+            done = directive == ZSTD_e_end ? remaining == 0 : input.pos == input.size;
+        }
+        return true;
+    }
+
+    std::FILE* file;
+    ZSTD_CCtx* context;
+    std::vector<char> output;
+};
+
+class ZstdInputBuffer : public BlockInputBuffer {
+   public:
+    ZstdInputBuffer(std::string const& filename) : file(std::fopen(filename.c_str(), "rb")), context(ZSTD_createDCtx()), input(ZSTD_DStreamInSize()) {
+        STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        inputBuffer = {input.data(), 0, 0};
+    }
+
+    ~ZstdInputBuffer() override {
+        std::fclose(file);
+        ZSTD_freeDCtx(context);
+    }
+
+   protected:
+    std::size_t readBlock(char* data, std::size_t size) override {
+        ZSTD_outBuffer out = {data, size, 0};
+        while (out.pos == 0) {
+            if (inputBuffer.pos == inputBuffer.size) {
+                inputBuffer.size = std::fread(input.data(), 1, input.size(), file);
+                inputBuffer.pos = 0;
+                if (inputBuffer.size == 0) {
+                    break;
+                }
+            }
+            std::size_t result = ZSTD_decompressStream(context, &out, &inputBuffer);
+            STORM_LOG_THROW(!ZSTD_isError(result), storm::exceptions::FileIoException,
+                            "Could not read zstd-compressed file: " << ZSTD_getErrorName(result) << ".");
+        }
+        return out.pos;
+    }
+
+   private:
+    std::FILE* file;
+    ZSTD_DCtx* context;
+    std::vector<char> input;
+    ZSTD_inBuffer inputBuffer;
+};
+#endif
+
+void checkSupport(CompressionMode const& mode) {
+    STORM_LOG_THROW(isCompressionModeSupported(mode), storm::exceptions::NotSupportedException,
+                    "Compression mode '" << toString(mode) << "' is not supported as Storm was built without the corresponding library.");
+}
+
+}  // namespace detail
+
+CompressedOutputFileStream::CompressedOutputFileStream(std::string const& filename, CompressionMode mode) : std::ostream(nullptr) {
+    detail::checkSupport(mode);
+    switch (mode) {
+        case CompressionMode::None:
+            buffer = std::make_unique<detail::PlainOutputBuffer>(filename);
+            break;
+        case CompressionMode::Gzip:
+#ifdef STORM_HAVE_ZLIB
+            buffer = std::make_unique<detail::GzipOutputBuffer>(filename);
+#endif
+            break;
+        case CompressionMode::Zstd:
+#ifdef STORM_HAVE_ZSTD
+            buffer = std::make_unique<detail::ZstdOutputBuffer>(filename);
+#endif
+            break;
+    }
+    rdbuf(buffer.get());
+}
+
+CompressedOutputFileStream::CompressedOutputFileStream(std::string const& filename)
+    : CompressedOutputFileStream(filename, getCompressionModeFromFileExtension(filename)) {
+    // Intentionally left empty.
+}
+
+CompressedOutputFileStream::~CompressedOutputFileStream() {
+    try {
+        close();
+    } catch (storm::exceptions::FileIoException const& e) {
+        STORM_LOG_ERROR(e.what());
+    }
+}
+
+void CompressedOutputFileStream::close() {
+    if (buffer) {
+        static_cast<detail::BlockOutputBuffer*>(buffer.get())->finish();
+    }
+}
+
+CompressedInputFileStream::CompressedInputFileStream(std::string const& filename, CompressionMode mode) : std::istream(nullptr) {
+    detail::checkSupport(mode);
+    switch (mode) {
+        case CompressionMode::None:
+            buffer = std::make_unique<detail::PlainInputBuffer>(filename);
+            break;
+        case CompressionMode::Gzip:
+#ifdef STORM_HAVE_ZLIB
+            buffer = std::make_unique<detail::GzipInputBuffer>(filename);
+#endif
+            break;
+        case CompressionMode::Zstd:
+#ifdef STORM_HAVE_ZSTD
+            buffer = std::make_unique<detail::ZstdInputBuffer>(filename);
+#endif
+            break;
+    }
+    rdbuf(buffer.get());
+}
+
+CompressedInputFileStream::CompressedInputFileStream(std::string const& filename)
+    : CompressedInputFileStream(filename, getCompressionModeFromFileExtension(filename)) {
+    // Intentionally left empty.
+}
+
+CompressedInputFileStream::~CompressedInputFileStream() = default;
+
+}  // namespace io
+}  // namespace storm
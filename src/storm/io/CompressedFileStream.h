@@ -0,0 +1,60 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "storm/io/CompressionMode.h"
+
+namespace storm {
+namespace io {
+
+/*!
+ * An output stream that writes to a file in large blocks and optionally compresses the written data.
+ */
+class CompressedOutputFileStream : public std::ostream {
+   public:
+    /*!
+     * Opens the given file for writing.
+     *
+     * @param filename Path and name of the file to be written to.
+     * @param mode The compression mode. If none is given, the mode is derived from the file extension.
+     * @throws FileIoException if the file can not be opened.
+     * @throws NotSupportedException if Storm was built without support for the given compression mode.
+     */
+    CompressedOutputFileStream(std::string const& filename, CompressionMode mode);
+    explicit CompressedOutputFileStream(std::string const& filename);
+    ~CompressedOutputFileStream() override;
+
+    /*!
+     * Flushes all pending (compressed) data and closes the file.
+     */
+    void close();
+
+   private:
+    std::unique_ptr<std::streambuf> buffer;
+};
+
+/*!
+ * An input stream that reads (and optionally decompresses) a file in large blocks.
+ */
+class CompressedInputFileStream : public std::istream {
+   public:
+    /*!
+     * Opens the given file for reading.
+     *
+     * @param filename Path and name of the file to be read.
+     * @param mode The compression mode. If none is given, the mode is derived from the file extension.
+     * @throws FileIoException if the file can not be opened.
+     * @throws NotSupportedException if Storm was built without support for the given compression mode.
+     */
+    CompressedInputFileStream(std::string const& filename, CompressionMode mode);
+    explicit CompressedInputFileStream(std::string const& filename);
+    ~CompressedInputFileStream() override;
+
+   private:
+    std::unique_ptr<std::streambuf> buffer;
+};
+
+}  // namespace io
+}  // namespace storm
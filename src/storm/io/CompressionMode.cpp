@@ -0,0 +1,82 @@
+#include "storm/io/CompressionMode.h"
+
+#include "storm-config.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace io {
+
+CompressionMode getCompressionModeFromString(std::string const& input) {
+    if (input == "none") {
+        return CompressionMode::None;
+    } else if (input == "gzip") {
+        return CompressionMode::Gzip;
+    } else if (input == "zstd") {
+        return CompressionMode::Zstd;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The compression mode '" << input << "' does not match any known mode.");
+}
+
+std::string toString(CompressionMode const& input) {
+    switch (input) {
+        case CompressionMode::None:
+            return "none";
+        case CompressionMode::Gzip:
+            return "gzip";
+        case CompressionMode::Zstd:
+            return "zstd";
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unhandled compression mode.");
+}
+
+namespace detail {
+bool hasSuffix(std::string const& filename, std::string const& suffix) {
+    return filename.size() > suffix.size() && filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+}  // namespace detail
+
+CompressionMode getCompressionModeFromFileExtension(std::string const& filename) {
+    if (detail::hasSuffix(filename, ".gz")) {
+        return CompressionMode::Gzip;
+    } else if (detail::hasSuffix(filename, ".zst")) {
+        return CompressionMode::Zstd;
+    }
+    return CompressionMode::None;
+}
+
+std::string stripCompressionExtension(std::string const& filename) {
+    switch (getCompressionModeFromFileExtension(filename)) {
+        case CompressionMode::Gzip:
+            return filename.substr(0, filename.size() - 3);
+        case CompressionMode::Zstd:
+            return filename.substr(0, filename.size() - 4);
+        case CompressionMode::None:
+            break;
+    }
+    return filename;
+}
+
+bool isCompressionModeSupported(CompressionMode const& mode) {
+    switch (mode) {
+        case CompressionMode::None:
+            return true;
+        case CompressionMode::Gzip:
+#ifdef STORM_HAVE_ZLIB
+            return true;
+#else
+            return false;
+#endif
+        case CompressionMode::Zstd:
+#ifdef STORM_HAVE_ZSTD
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+}  // namespace io
+}  // namespace storm
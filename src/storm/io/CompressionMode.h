@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+
+namespace storm {
+namespace io {
+
+enum class CompressionMode { None, Gzip, Zstd };
+
+/*!
+ * @return The CompressionMode whose string representation matches the given input
+ * @throws InvalidArgumentException if the input doesn't match any known compression mode
+ */
+CompressionMode getCompressionModeFromString(std::string const& input);
+
+/*!
+ * @return The string representation of the given input
+ */
+std::string toString(CompressionMode const& input);
+
+/*!
+ * @return The CompressionMode matching the extension of the given file (.gz or .zst). Files without such an extension are considered uncompressed.
+ */
+CompressionMode getCompressionModeFromFileExtension(std::string const& filename);
+
+/*!
+ * @return The given filename without the extension that indicates its compression mode (if any).
+ */
+std::string stripCompressionExtension(std::string const& filename);
+
+/*!
+ * @return True if Storm was built with support for the given compression mode.
+ */
+bool isCompressionModeSupported(CompressionMode const& mode);
+
+}  // namespace io
+}  // namespace storm
@@ -1,6 +1,9 @@
 #include "storm/io/DirectEncodingExporter.h"
 #include <storm/exceptions/NotSupportedException.h>
 
+#include <charconv>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -16,6 +19,167 @@
 namespace storm {
 namespace exporter {
 
+namespace detail {
+
+/*!
+ * Appends the given value to the string, using the placeholders if possible.
+ * Floating point numbers are formatted like an output stream with the given precision would do.
+ */
+template<typename ValueType>
+void appendValue(std::string& out, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders, std::streamsize precision) {
+    std::stringstream stream;
+    stream.precision(precision);
+    writeValue(stream, value, placeholders);
+    out += stream.str();
+}
+
+template<>
+void appendValue(std::string& out, double const& value, std::unordered_map<double, std::string> const&, std::streamsize precision) {
+    char buffer[64];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, static_cast<int>(precision));
+    out.append(buffer, result.ptr);
+}
+
+void appendNumber(std::string& out, uint64_t value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+/*!
+ * Formats the state information and outgoing transitions of a range of states.
+ * All data is only read such that several ranges can be formatted concurrently.
+ */
+template<typename ValueType>
+class DrnStateFormatter {
+   public:
+    DrnStateFormatter(storm::models::sparse::Model<ValueType> const& model, std::vector<ValueType> const& exitRates,
+                      std::unordered_map<ValueType, std::string> const& placeholders, std::streamsize precision)
+        : model(model),
+          pomdp(model.getType() == storm::models::ModelType::Pomdp ? dynamic_cast<storm::models::sparse::Pomdp<ValueType> const*>(&model) : nullptr),
+          exitRates(exitRates),
+          placeholders(placeholders),
+          precision(precision) {
+        // Intentionally left empty.
+    }
+
+    void formatStates(uint64_t groupStart, uint64_t groupEnd, std::string& out) const {
+        storm::storage::SparseMatrix<ValueType> const& matrix = model.getTransitionMatrix();
+        for (uint64_t group = groupStart; group < groupEnd; ++group) {
+            out += "state ";
+            appendNumber(out, group);
+
+            // Write exit rates for CTMCs and MAs
+            if (!exitRates.empty()) {
+                out += " !";
+                appendValue(out, exitRates.at(group), placeholders, precision);
+            }
+
+            if (pomdp != nullptr) {
+                out += " {";
+                appendNumber(out, pomdp->getObservation(group));
+                out += "}";
+            }
+
+            // Write state rewards
+            bool first = true;
+            for (auto const& rewardModelEntry : model.getRewardModels()) {
+                out += first ? " [" : ", ";
+                first = false;
+                if (rewardModelEntry.second.hasStateRewards()) {
+                    appendValue(out, rewardModelEntry.second.getStateRewardVector().at(group), placeholders, precision);
+                } else {
+                    out += "0";
+                }
+            }
+            if (!first) {
+                out += "]";
+            }
+
+            // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+            for (auto const& label : model.getStateLabeling().getLabelsOfState(group)) {
+                STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                                "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+                // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+                if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+                    out += " \"";
+                    out += label;
+                    out += "\"";
+                } else {
+                    out += " ";
+                    out += label;
+                }
+            }
+            out += '\n';
+            // Write state valuations as comments
+            if (model.hasStateValuations()) {
+                out += "//";
+                out += model.getStateValuations().getStateInfo(group);
+                out += '\n';
+            }
+
+            // Write probabilities
+            uint64_t start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+            uint64_t end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+            // Iterate over all actions
+            for (uint64_t row = start; row < end; ++row) {
+                // Write choice
+                out += "\taction ";
+                if (model.hasChoiceLabeling()) {
+                    bool lfirst = true;
+                    if (model.getChoiceLabeling().getLabelsOfChoice(row).empty()) {
+                        out += "__NOLABEL__";
+                    }
+                    for (auto const& label : model.getChoiceLabeling().getLabelsOfChoice(row)) {
+                        if (!lfirst) {
+                            out += "_";
+                            lfirst = false;
+                        }
+                        out += label;
+                    }
+                } else {
+                    appendNumber(out, row - start);
+                }
+
+                // Write action rewards
+                bool first = true;
+                for (auto const& rewardModelEntry : model.getRewardModels()) {
+                    out += first ? " [" : ", ";
+                    first = false;
+                    if (rewardModelEntry.second.hasStateActionRewards()) {
+                        appendValue(out, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders, precision);
+                    } else {
+                        out += "0";
+                    }
+                }
+                if (!first) {
+                    out += "]";
+                }
+                out += '\n';
+
+                // Write transitions
+                for (auto const& entry : matrix.getRow(row)) {
+                    out += "\t\t";
+                    appendNumber(out, entry.getColumn());
+                    out += " : ";
+                    appendValue(out, entry.getValue(), placeholders, precision);
+                    out += '\n';
+                }
+            }
+        }
+    }
+
+   private:
+    storm::models::sparse::Model<ValueType> const& model;
+    storm::models::sparse::Pomdp<ValueType> const* pomdp;
+    std::vector<ValueType> const& exitRates;
+    std::unordered_map<ValueType, std::string> const& placeholders;
+    std::streamsize precision;
+};
+
+}  // namespace detail
+
 template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
@@ -70,112 +234,61 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
 
     storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
 
-    // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
-
-        // Write exit rates for CTMCs and MAs
-        if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
-        }
-
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
-        }
-
-        // Write state rewards
-        bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-            if (first) {
-                os << " [";
-                first = false;
-            } else {
-                os << ", ";
-            }
-
-            if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-            } else {
-                os << "0";
-            }
-        }
-
-        if (!first) {
-            os << "]";
+    // The states are formatted in blocks which are written to the stream in one piece.
+    // Blocks contain roughly the same number of transitions such that they can be formatted concurrently.
+    std::vector<uint64_t> blockStarts = {0};
+    uint64_t entriesInBlock = 0;
+    for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+        uint64_t rowStart = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+        uint64_t rowEnd = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+        entriesInBlock += matrix.getRowGroupEntryCount(group) + (rowEnd - rowStart) + 1;
+        if (entriesInBlock >= options.transitionsPerBlock) {
+            blockStarts.push_back(group + 1);
+            entriesInBlock = 0;
         }
+    }
+    if (blockStarts.back() != matrix.getRowGroupCount()) {
+        blockStarts.push_back(matrix.getRowGroupCount());
+    }
 
-        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
-            } else {
-                os << " " << label;
+    detail::DrnStateFormatter<ValueType> formatter(*sparseModel, exitRates, placeholders, os.precision());
+    bool const parallel = options.parallelize && !std::is_same<ValueType, storm::RationalFunction>::value;
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!parallel, "Storm was built without support for Intel TBB, defaulting to sequential export.");
+#endif
+    // Formatted blocks are kept in memory until all blocks of the current window are written.
+    uint64_t const numBlocks = blockStarts.size() - 1;
+    uint64_t const windowSize = parallel ? std::max<uint64_t>(1, options.blocksPerWindow) : 1;
+    std::vector<std::string> buffers(std::min(windowSize, numBlocks));
+    for (uint64_t windowStart = 0; windowStart < numBlocks; windowStart += windowSize) {
+        uint64_t windowEnd = std::min(windowStart + windowSize, numBlocks);
+        auto formatBlock = [&](uint64_t block) {
+            std::string& buffer = buffers[block - windowStart];
+            buffer.clear();
+            formatter.formatStates(blockStarts[block], blockStarts[block + 1], buffer);
+        };
+#ifdef STORM_HAVE_INTELTBB
+        if (parallel) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(windowStart, windowEnd), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t block = range.begin(); block < range.end(); ++block) {
+                    formatBlock(block);
+                }
+            });
+        } else {
+            for (uint64_t block = windowStart; block < windowEnd; ++block) {
+                formatBlock(block);
             }
         }
-        os << '\n';
-        // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+#else
+        for (uint64_t block = windowStart; block < windowEnd; ++block) {
+            formatBlock(block);
         }
-
-        // Write probabilities
-        typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-        typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-        // Iterate over all actions
-        for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-            // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
-                bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
-                }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                    if (!lfirst) {
-                        os << "_";
-                        lfirst = false;
-                    }
-                    os << label;
-                }
-            } else {
-                os << "\taction " << row - start;
-            }
-
-            // Write action rewards
-            bool first = true;
-            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                if (first) {
-                    os << " [";
-                    first = false;
-                } else {
-                    os << ", ";
-                }
-
-                if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
-                } else {
-                    os << "0";
-                }
-            }
-            if (!first) {
-                os << "]";
-            }
-            os << '\n';
-
-            // Write transitions
-            for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
-            }
+#endif
+        for (uint64_t block = windowStart; block < windowEnd; ++block) {
+            std::string const& buffer = buffers[block - windowStart];
+            os.write(buffer.data(), buffer.size());
         }
-    }  // end state iteration
+    }
 }
 
 template<typename ValueType>
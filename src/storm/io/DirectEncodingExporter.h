@@ -10,6 +10,12 @@ namespace exporter {
 
 struct DirectEncodingOptions {
     bool allowPlaceholders = true;
+    // If set, blocks of states are formatted concurrently (requires TBB). Not supported for parametric models.
+    bool parallelize = false;
+    // The approximate number of transitions per block of states that is formatted and written in one piece.
+    uint64_t transitionsPerBlock = 1ull << 16;
+    // The number of blocks that are formatted concurrently before they are written.
+    uint64_t blocksPerWindow = 64;
 };
 /*!
  * Exports a sparse model into the explicit DRN format.
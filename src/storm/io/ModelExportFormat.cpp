@@ -1,6 +1,7 @@
 #include "ModelExportFormat.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/io/CompressionMode.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -34,11 +35,13 @@ std::string toString(ModelExportFormat const& input) {
 }
 
 ModelExportFormat getModelExportFormatFromFileExtension(std::string const& filename) {
-    auto pos = filename.find_last_of('.');
+    // Ignore extensions indicating a compressed file, e.g. model.drn.gz
+    std::string const uncompressedFilename = storm::io::stripCompressionExtension(filename);
+    auto pos = uncompressedFilename.find_last_of('.');
     STORM_LOG_THROW(pos != std::string::npos, storm::exceptions::InvalidArgumentException,
                     "Couldn't detect a file extension from input filename '" << filename << "'.");
     ++pos;
-    return getModelExportFormatFromString(filename.substr(pos));
+    return getModelExportFormatFromString(uncompressedFilename.substr(pos));
 }
 
 }  // namespace exporter
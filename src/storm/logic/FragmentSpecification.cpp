@@ -71,7 +71,13 @@ FragmentSpecification rpatl() {
     // TODO: Only allow OperatorFormulas when they are inside of a GameFormula?
     // TODO: Require that operator formulas are required at the top level of a GameFormula?
     rpatl.setGameFormulasAllowed(true);
+    rpatl.setProbabilityOperatorsAllowed(true);
+    rpatl.setReachabilityProbabilityFormulasAllowed(true);
+    rpatl.setUntilFormulasAllowed(true);
+    rpatl.setGloballyFormulasAllowed(true);
+    rpatl.setNextFormulasAllowed(true);
     rpatl.setRewardOperatorsAllowed(true);
+    rpatl.setReachabilityRewardFormulasAllowed(true);
     rpatl.setLongRunAverageRewardFormulasAllowed(true);
     rpatl.setLongRunAverageOperatorsAllowed(true);
 
@@ -9,6 +9,7 @@
 
 #include "storm/logic/ComparisonType.h"
 #include "storm/logic/PlayerCoalition.h"
+#include "storm/modelchecker/hints/AnalysisCache.h"
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/solver/OptimizationDirection.h"
 
@@ -52,7 +53,7 @@ class CheckTask {
     CheckTask<NewFormulaType, ValueType> substituteFormula(NewFormulaType const& newFormula) const {
         CheckTask<NewFormulaType, ValueType> result(newFormula, this->optimizationDirection, this->playerCoalition, this->rewardModel,
                                                     this->onlyInitialStatesRelevant, this->bound, this->qualitative, this->produceSchedulers, this->hint,
-                                                    this->robustUncertainty);
+                                                    this->analysisCache, this->robustUncertainty);
         result.updateOperatorInformation();
         return result;
     }
@@ -131,7 +132,7 @@ class CheckTask {
     CheckTask<FormulaType, NewValueType> convertValueType() const {
         return CheckTask<FormulaType, NewValueType>(this->formula, this->optimizationDirection, this->playerCoalition, this->rewardModel,
                                                     this->onlyInitialStatesRelevant, this->bound, this->qualitative, this->produceSchedulers, this->hint,
-                                                    this->robustUncertainty);
+                                                    this->analysisCache, this->robustUncertainty);
     }
 
     /*!
@@ -298,6 +299,21 @@ class CheckTask {
         return *hint;
     }
 
+    /*!
+     * Sets a cache of analysis results of the considered model that might be shared with other tasks on the same model (if supported by the model
+     * checker).
+     */
+    void setAnalysisCache(std::shared_ptr<AnalysisCache> const& analysisCache) {
+        this->analysisCache = analysisCache;
+    }
+
+    /*!
+     * Retrieves the cache of analysis results of the considered model (or nullptr if there is none).
+     */
+    std::shared_ptr<AnalysisCache> const& getAnalysisCache() const {
+        return analysisCache;
+    }
+
     /*!
      * Conversion operator that strips the type of the formula.
      */
@@ -328,11 +344,13 @@ class CheckTask {
      * with bounds 0/1.
      * @param produceSchedulers If supported by the model checker and the model formalism, schedulers to achieve
      * a value will be produced if this flag is set.
+     * @param hint A hint that might contain information that speeds up the model checking process.
+     * @param analysisCache A cache of analysis results of the considered model.
      */
     CheckTask(std::reference_wrapper<FormulaType const> const& formula, boost::optional<storm::OptimizationDirection> const& optimizationDirection,
               boost::optional<storm::logic::PlayerCoalition> playerCoalition, boost::optional<std::string> const& rewardModel, bool onlyInitialStatesRelevant,
               boost::optional<storm::logic::Bound> const& bound, bool qualitative, bool produceSchedulers, std::shared_ptr<ModelCheckerHint> const& hint,
-              bool robust)
+              std::shared_ptr<AnalysisCache> const& analysisCache, bool robust)
         : formula(formula),
           optimizationDirection(optimizationDirection),
           playerCoalition(playerCoalition),
@@ -342,6 +360,7 @@ class CheckTask {
           qualitative(qualitative),
           produceSchedulers(produceSchedulers),
           hint(hint),
+          analysisCache(analysisCache),
           robustUncertainty(robust) {
         // Intentionally left empty.
     }
@@ -374,6 +393,9 @@ class CheckTask {
     // A hint that might contain information that speeds up the modelchecking process (if supported by the model checker)
     std::shared_ptr<ModelCheckerHint> hint;
 
+    // A cache of analysis results that might be shared with other tasks on the same model (if supported by the model checker).
+    std::shared_ptr<AnalysisCache> analysisCache;
+
     /// Whether uncertainty should be resolved robust (standard) or angelically.
     bool robustUncertainty;
 };
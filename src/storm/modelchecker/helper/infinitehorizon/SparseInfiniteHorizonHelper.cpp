@@ -1,8 +1,11 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <mutex>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -15,6 +18,9 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -150,35 +156,90 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     }
 
     // If requested, allocate memory for the choices made
-    if (Nondeterministic && this->isProduceSchedulerSet()) {
-        if (!_producedOptimalChoices.is_initialized()) {
-            _producedOptimalChoices.emplace();
-        }
-        _producedOptimalChoices->resize(_transitionMatrix.getRowGroupCount());
-    }
+    createProducedOptimalChoices();
     STORM_LOG_ASSERT(Nondeterministic || !this->isProduceSchedulerSet(), "Scheduler production enabled for deterministic model.");
 
     // Decompose the model to their bottom components (MECS or BSCCS)
     createDecomposition();
 
     // Compute the long-run average for all components in isolation.
+    std::vector<ValueType> componentLraValues = computeComponentLraValues(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter);
+
+    // Solve the resulting SSP where end components are collapsed into single auxiliary states
+    STORM_LOG_INFO("Solving stochastic shortest path problem.");
+    return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeComponentLraValues(Environment const& env,
+                                                                                                           ValueGetter const& stateValuesGetter,
+                                                                                                           ValueGetter const& actionValuesGetter) {
     // Set up some logging
+    uint64_t const numComponents = _longRunComponentDecomposition->size();
     std::string const componentString = (Nondeterministic ? std::string("Maximal end") : std::string("Bottom strongly connected")) +
-                                        (_longRunComponentDecomposition->size() == 1 ? std::string(" component") : std::string(" components"));
+                                        (numComponents == 1 ? std::string(" component") : std::string(" components"));
     storm::utility::ProgressMeasurement progress(componentString);
-    progress.setMaxCount(_longRunComponentDecomposition->size());
+    progress.setMaxCount(numComponents);
     progress.startNewMeasurement(0);
-    STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    STORM_LOG_INFO("Computing long run average values for " << numComponents << " " << componentString << " individually...");
+    std::vector<ValueType> componentLraValues(numComponents);
+
+    bool parallelize = numComponents > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    if (parallelize && !isConcurrentComponentAnalysisSupported(env)) {
+        STORM_LOG_INFO("The components are analyzed sequentially as the selected solution method does not support concurrent invocations.");
+        parallelize = false;
     }
+    if (parallelize) {
+#ifdef STORM_HAVE_INTELTBB
+        // Lazily initialized data has to be available before the components are analyzed concurrently.
+        createBackwardTransitions();
+        _transitionMatrix.getRowGroupIndices();
+        // The tasks only write the choices of the states of their components.
+        createProducedOptimalChoices();
 
-    // Solve the resulting SSP where end components are collapsed into single auxiliary states
-    STORM_LOG_INFO("Solving stochastic shortest path problem.");
-    return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
+        std::mutex progressMutex;
+        uint64_t numFinishedComponents = 0;
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numComponents), [&](tbb::blocked_range<uint64_t> const& range) {
+            // Each task works on its own copy of the environment. Solvers and LRA-VI helpers are created per component.
+            Environment taskEnvironment = env;
+            for (uint64_t componentIndex = range.begin(); componentIndex < range.end(); ++componentIndex) {
+                componentLraValues[componentIndex] =
+                    computeLraForComponent(taskEnvironment, stateValuesGetter, actionValuesGetter, (*_longRunComponentDecomposition)[componentIndex]);
+            }
+            std::lock_guard<std::mutex> lock(progressMutex);
+            numFinishedComponents += range.size();
+            progress.updateProgress(numFinishedComponents);
+        });
+        return componentLraValues;
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+    }
+
+    for (uint64_t componentIndex = 0; componentIndex < numComponents; ++componentIndex) {
+        componentLraValues[componentIndex] =
+            computeLraForComponent(env, stateValuesGetter, actionValuesGetter, (*_longRunComponentDecomposition)[componentIndex]);
+        progress.updateProgress(componentIndex + 1);
+    }
+    return componentLraValues;
+}
+
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isConcurrentComponentAnalysisSupported(Environment const&) const {
+    // Rational functions share global caches that must not be accessed concurrently.
+    return !std::is_same<ValueType, storm::RationalFunction>::value;
+}
+
+template<typename ValueType, bool Nondeterministic>
+void SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::createProducedOptimalChoices() {
+    if (Nondeterministic && this->isProduceSchedulerSet()) {
+        if (!_producedOptimalChoices.is_initialized()) {
+            _producedOptimalChoices.emplace();
+        }
+        if (_producedOptimalChoices->size() != _transitionMatrix.getRowGroupCount()) {
+            _producedOptimalChoices->resize(_transitionMatrix.getRowGroupCount());
+        }
+    }
 }
 
 template<typename ValueType, bool Nondeterministic>
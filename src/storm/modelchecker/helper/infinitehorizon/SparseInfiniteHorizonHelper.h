@@ -118,6 +118,24 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     void createBackwardTransitions();
 
+    /*!
+     * @post if scheduler production is enabled and Nondeterministic is true, _producedOptimalChoices has an entry for each state.
+     * Does not modify _producedOptimalChoices if it is already allocated, so it is safe to call this while components are analyzed concurrently.
+     */
+    void createProducedOptimalChoices();
+
+    /*!
+     * @return true iff computeLraForComponent may be invoked concurrently for different components (using separate copies of the given environment).
+     */
+    virtual bool isConcurrentComponentAnalysisSupported(Environment const& env) const;
+
+    /*!
+     * Computes the LRA value of each component of the long run component decomposition.
+     * If Intel TBB is enabled and concurrent analysis is supported, the components are processed in parallel.
+     * @return the LRA value for each component (in the order of the decomposition)
+     */
+    std::vector<ValueType> computeComponentLraValues(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter);
+
     /*!
      * @post _longRunComponentDecomposition points to a decomposition of the long run components (MECs, BSCCs)
      */
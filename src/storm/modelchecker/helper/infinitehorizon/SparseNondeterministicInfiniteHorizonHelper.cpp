@@ -81,13 +81,8 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
                                                                                          storm::storage::MaximalEndComponent const& component) {
     // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
 
-    // Allocate memory for the nondeterministic choices.
-    if (this->isProduceSchedulerSet()) {
-        if (!this->_producedOptimalChoices.is_initialized()) {
-            this->_producedOptimalChoices.emplace();
-        }
-        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
-    }
+    // Allocate memory for the nondeterministic choices (unless this already happened before the components are analyzed concurrently).
+    this->createProducedOptimalChoices();
 
     auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
     if (trivialResult.first) {
@@ -95,19 +90,12 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
-    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
-    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
-        method != storm::solver::LraMethod::LinearProgramming) {
-        STORM_LOG_INFO(
-            "Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::LinearProgramming;
-    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
-        STORM_LOG_INFO(
-            "Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::ValueIteration;
-    }
+    storm::solver::LraMethod method = getLraMethodForNontrivialMec(env);
+    STORM_LOG_INFO_COND(method == env.solver().lra().getNondetLraMethod(),
+                        "Selecting '" << (method == storm::solver::LraMethod::LinearProgramming ? "LP" : "VI")
+                                      << "' as the solution technique for long-run properties to guarantee "
+                                      << (method == storm::solver::LraMethod::LinearProgramming ? "exact" : "sound")
+                                      << " results. If you want to override this, please explicitly specify a different LRA method.");
     STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
                          "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
     if (method == storm::solver::LraMethod::LinearProgramming) {
@@ -119,6 +107,25 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 }
 
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getLraMethodForNontrivialMec(Environment const& env) const {
+    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
+    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
+        method != storm::solver::LraMethod::LinearProgramming) {
+        method = storm::solver::LraMethod::LinearProgramming;
+    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
+        method = storm::solver::LraMethod::ValueIteration;
+    }
+    return method;
+}
+
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isConcurrentComponentAnalysisSupported(Environment const& env) const {
+    // LP solvers are not guaranteed to support concurrent instances.
+    return SparseInfiniteHorizonHelper<ValueType, true>::isConcurrentComponentAnalysisSupported(env) &&
+           getLraMethodForNontrivialMec(env) != storm::solver::LraMethod::LinearProgramming;
+}
+
 template<typename ValueType>
 std::pair<bool, ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForTrivialMec(
     Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter,
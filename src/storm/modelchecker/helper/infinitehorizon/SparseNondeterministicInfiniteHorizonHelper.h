@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
 
@@ -65,6 +66,14 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
    protected:
     virtual void createDecomposition() override;
 
+    virtual bool isConcurrentComponentAnalysisSupported(Environment const& env) const override;
+
+    /*!
+     * @return the method that is used to compute the LRA value of non-trivial MECs, considering the settings in env as well as the requirements for
+     * exact and sound computations.
+     */
+    storm::solver::LraMethod getLraMethodForNontrivialMec(Environment const& env) const;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
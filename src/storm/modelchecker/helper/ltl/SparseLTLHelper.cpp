@@ -237,10 +237,13 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
 
     // Compute accepting states
     storm::storage::BitVector acceptingStates;
+    // The backward transitions are computed only once, as they are as large as the product itself.
+    storm::storage::SparseMatrix<ValueType> productBackwardTransitions;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
-                                              product->getProductModel().getBackwardTransitions(), product);
+        productBackwardTransitions = product->getProductModel().getBackwardTransitions();
+        acceptingStates =
+            computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, product);
 
     } else {
         STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
@@ -257,6 +260,9 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     }
 
     STORM_LOG_INFO("Computing probabilities for reaching accepting components...");
+    if (!Nondeterministic) {
+        productBackwardTransitions = product->getProductModel().getBackwardTransitions();
+    }
 
     storm::storage::BitVector bvTrue(product->getProductModel().getNumberOfStates(), true);
     storm::storage::BitVector soiProduct(product->getStatesOfInterest());
@@ -276,8 +282,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     if (Nondeterministic) {
         MDPSparseModelCheckingHelperReturnType<ValueType> prodCheckResult =
             storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
-                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
-                acceptingStates, this->isQualitativeSet(),
+                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, bvTrue, acceptingStates,
+                this->isQualitativeSet(),
                 this->isProduceSchedulerSet()  // Whether to create memoryless scheduler for the Model-DA Product.
             );
         prodNumericResult = std::move(prodCheckResult.values);
@@ -289,8 +295,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
 
     } else {
         prodNumericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
-            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
-            acceptingStates, this->isQualitativeSet());
+            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, bvTrue, acceptingStates,
+            this->isQualitativeSet());
     }
 
     std::vector<ValueType> numericResult = product->projectToOriginalModel(this->_transitionMatrix.getRowGroupCount(), prodNumericResult);
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * This class stores the results of analyses of a fixed model that can be reused when checking several properties on that model.
+ * @note The model checker has to make sure that a given cache actually belongs to the considered model and thus a cache might be ignored.
+ */
+class AnalysisCache {
+   public:
+    AnalysisCache() = default;
+    virtual ~AnalysisCache() = default;
+
+    /*!
+     * Prints how often the cached results have been reused.
+     */
+    virtual void printStatistics(std::ostream& out) const = 0;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -117,6 +117,18 @@ void ExplicitModelCheckerHint<ValueType>::setNoEndComponentsInMaybeStates(bool v
     noEndComponentsInMaybeStates = value;
 }
 
+template<typename ValueType>
+bool ExplicitModelCheckerHint<ValueType>::getResultHintOnlyForNonMaybeStates() const {
+    STORM_LOG_THROW(!resultHintOnlyForNonMaybeStates || (hasMaybeStates() && hasResultHint()), storm::exceptions::InvalidOperationException,
+                    "The result hint is restricted to non-maybestates but no maybestates or no result hint is specified.");
+    return resultHintOnlyForNonMaybeStates;
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerHint<ValueType>::setResultHintOnlyForNonMaybeStates(bool value) {
+    resultHintOnlyForNonMaybeStates = value;
+}
+
 template class ExplicitModelCheckerHint<double>;
 template class ExplicitModelCheckerHint<storm::RationalNumber>;
 template class ExplicitModelCheckerHint<storm::RationalFunction>;
@@ -55,6 +55,11 @@ class ExplicitModelCheckerHint : public ModelCheckerHint {
     bool getNoEndComponentsInMaybeStates() const;
     void setNoEndComponentsInMaybeStates(bool value);
 
+    // If set, the result hint only specifies the values of the non-maybe states, i.e., the values of the maybestates must not be used as initial values.
+    // May only be enabled iff a resultHint and a set of maybestates are given.
+    bool getResultHintOnlyForNonMaybeStates() const;
+    void setResultHintOnlyForNonMaybeStates(bool value);
+
    private:
     boost::optional<std::vector<ValueType>> resultHint;
     boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
@@ -62,6 +67,7 @@ class ExplicitModelCheckerHint : public ModelCheckerHint {
     bool computeOnlyMaybeStates;
     boost::optional<storm::storage::BitVector> maybeStates;
     bool noEndComponentsInMaybeStates;
+    bool resultHintOnlyForNonMaybeStates = false;
 };
 
 }  // namespace modelchecker
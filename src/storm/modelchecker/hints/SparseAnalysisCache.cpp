@@ -0,0 +1,225 @@
+#include "storm/modelchecker/hints/SparseAnalysisCache.h"
+
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+/*!
+ * Checks whether applying the Bellman operator to the given values changes the value of any maybe state by more than the given precision.
+ */
+template<typename ValueType>
+bool isFixpoint(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, boost::optional<storm::OptimizationDirection> const& dir,
+                storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& values, ValueType const& precision, bool relative) {
+    for (auto state : maybeStates) {
+        uint64_t firstRow = dir ? transitionMatrix.getRowGroupIndices()[state] : state;
+        uint64_t endRow = dir ? transitionMatrix.getRowGroupIndices()[state + 1] : state + 1;
+        ValueType best = transitionMatrix.multiplyRowWithVector(firstRow, values);
+        for (uint64_t row = firstRow + 1; row < endRow; ++row) {
+            ValueType rowValue = transitionMatrix.multiplyRowWithVector(row, values);
+            if (storm::solver::minimize(dir.get()) ? rowValue < best : rowValue > best) {
+                best = std::move(rowValue);
+            }
+        }
+        ValueType residual = storm::utility::abs<ValueType>(best - values[state]);
+        if (residual > (relative ? precision * storm::utility::abs<ValueType>(best) : precision)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+template<typename ValueType>
+SparseAnalysisCache<ValueType>::SparseAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t maximalNumberOfStoredSolutions)
+    : transitionMatrix(transitionMatrix),
+      maximalNumberOfStoredSolutions(maximalNumberOfStoredSolutions),
+      backwardTransitionsRequests(0),
+      qualitativeAnalysisHits(0),
+      qualitativeAnalysisMisses(0),
+      warmStarts(0),
+      discardedSolutions(0),
+      evictedSolutions(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool SparseAnalysisCache<ValueType>::isCacheFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const {
+    return &this->transitionMatrix == &transitionMatrix;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& SparseAnalysisCache<ValueType>::getBackwardTransitions() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++backwardTransitionsRequests;
+    return getOrComputeBackwardTransitions();
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> const& SparseAnalysisCache<ValueType>::getStatesWithProbability01(
+    boost::optional<storm::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return getUntilQueryResults({dir, phiStates, psiStates}).statesWithProbability01;
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitModelCheckerHint<ValueType>> SparseAnalysisCache<ValueType>::createUntilProbabilitiesHint(
+    boost::optional<storm::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    bool allowWarmStart) {
+    std::lock_guard<std::mutex> lock(mutex);
+    UntilQueryResults& results = getUntilQueryResults({dir, phiStates, psiStates});
+    storm::storage::BitVector maybeStates = ~(results.statesWithProbability01.first | results.statesWithProbability01.second);
+
+    auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+    auto warmStartSolution = solutions.end();
+    if (allowWarmStart) {
+        for (auto solutionIt = solutions.begin(); solutionIt != solutions.end(); ++solutionIt) {
+            if (solutionIt->psiStates == psiStates && (warmStartSolution == solutions.end() || solutionIt->dir == dir)) {
+                warmStartSolution = solutionIt;
+            }
+        }
+    }
+    std::vector<ValueType> values;
+    if (warmStartSolution != solutions.end()) {
+        ++warmStarts;
+        values = warmStartSolution->values;
+        solutions.splice(solutions.begin(), solutions, warmStartSolution);
+    } else {
+        // The values of the maybe states are irrelevant as the model checkers choose their initial values themselves.
+        values = std::vector<ValueType>(maybeStates.size(), storm::utility::zero<ValueType>());
+        hint->setResultHintOnlyForNonMaybeStates(true);
+    }
+    storm::utility::vector::setVectorValues(values, results.statesWithProbability01.first, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues(values, results.statesWithProbability01.second, storm::utility::one<ValueType>());
+
+    bool noEndComponentsInMaybeStates = false;
+    if (dir) {
+        // Model checkers of nondeterministic models check this before using the values of the hint, so we analyze it only once.
+        if (!results.noEndComponentsInMaybeStates) {
+            results.noEndComponentsInMaybeStates = storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(),
+                                                                                        getOrComputeBackwardTransitions(), maybeStates, ~maybeStates)
+                                                       .full();
+        }
+        noEndComponentsInMaybeStates = results.noEndComponentsInMaybeStates.get();
+    }
+
+    hint->setNoEndComponentsInMaybeStates(noEndComponentsInMaybeStates);
+    hint->setResultHint(std::move(values));
+    hint->setMaybeStates(std::move(maybeStates));
+    hint->setComputeOnlyMaybeStates(true);
+    return hint;
+}
+
+template<typename ValueType>
+void SparseAnalysisCache<ValueType>::storeUntilProbabilities(boost::optional<storm::OptimizationDirection> const& dir,
+                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                             std::vector<ValueType> const& values, boost::optional<storm::RationalNumber> const& precision,
+                                                             bool relative) {
+    STORM_LOG_ASSERT(values.size() == transitionMatrix.getRowGroupCount(), "Unexpected size of the solution.");
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Parametric models are solved exactly, so warm starts would not be of any use.
+        return;
+    } else {
+        if (maximalNumberOfStoredSolutions == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (precision) {
+            // The qualitative analysis is usually available from the creation of the hint, so this lookup is not counted.
+            UntilQuery query{dir, phiStates, psiStates};
+            auto findRes = untilQueries.find(query);
+            auto const& statesWithProbability01 =
+                findRes != untilQueries.end() ? findRes->second.statesWithProbability01 : getUntilQueryResults(query).statesWithProbability01;
+            storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+            if (!isFixpoint(transitionMatrix, dir, maybeStates, values, storm::utility::convertNumber<ValueType>(precision.get()), relative)) {
+                STORM_LOG_INFO("Discarding the solution of an until probabilities query as the solver did not converge.");
+                ++discardedSolutions;
+                return;
+            }
+        }
+
+        auto solutionIt = std::find_if(solutions.begin(), solutions.end(), [&dir, &psiStates](StoredSolution const& solution) {
+            return solution.dir == dir && solution.psiStates == psiStates;
+        });
+        if (solutionIt != solutions.end()) {
+            solutionIt->values = values;
+            solutions.splice(solutions.begin(), solutions, solutionIt);
+        } else {
+            solutions.push_front({dir, psiStates, values});
+            if (solutions.size() > maximalNumberOfStoredSolutions) {
+                solutions.pop_back();
+                ++evictedSolutions;
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+void SparseAnalysisCache<ValueType>::printStatistics(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "Analysis cache statistics:\n";
+    out << "  * requests of backward transitions: " << backwardTransitionsRequests << '\n';
+    out << "  * qualitative analyses of until probabilities: " << qualitativeAnalysisHits << " hits, " << qualitativeAnalysisMisses << " misses\n";
+    out << "  * warm starts from stored solutions: " << warmStarts << '\n';
+    out << "  * discarded solutions of solvers that did not converge: " << discardedSolutions << '\n';
+    out << "  * evicted solutions: " << evictedSolutions << '\n';
+}
+
+template<typename ValueType>
+typename SparseAnalysisCache<ValueType>::UntilQueryResults& SparseAnalysisCache<ValueType>::getUntilQueryResults(UntilQuery const& query) {
+    auto findRes = untilQueries.find(query);
+    if (findRes != untilQueries.end()) {
+        ++qualitativeAnalysisHits;
+        return findRes->second;
+    }
+
+    ++qualitativeAnalysisMisses;
+    storm::storage::SparseMatrix<ValueType> const& backward = getOrComputeBackwardTransitions();
+    UntilQueryResults results;
+    if (!query.dir) {
+        results.statesWithProbability01 = storm::utility::graph::performProb01(backward, query.phiStates, query.psiStates);
+    } else if (storm::solver::minimize(query.dir.get())) {
+        results.statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backward,
+                                                                                  query.phiStates, query.psiStates);
+    } else {
+        results.statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backward,
+                                                                                  query.phiStates, query.psiStates);
+    }
+    return untilQueries.emplace(query, std::move(results)).first->second;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& SparseAnalysisCache<ValueType>::getOrComputeBackwardTransitions() {
+    if (!backwardTransitions) {
+        backwardTransitions = transitionMatrix.transpose(true);
+    }
+    return backwardTransitions.get();
+}
+
+template<typename ValueType>
+bool SparseAnalysisCache<ValueType>::UntilQuery::operator==(UntilQuery const& other) const {
+    return dir == other.dir && phiStates == other.phiStates && psiStates == other.psiStates;
+}
+
+template<typename ValueType>
+std::size_t SparseAnalysisCache<ValueType>::UntilQueryHash::operator()(UntilQuery const& query) const {
+    std::size_t seed = query.dir ? static_cast<std::size_t>(query.dir.get()) + 1 : 0;
+    boost::hash_combine(seed, std::hash<storm::storage::BitVector>()(query.phiStates));
+    boost::hash_combine(seed, std::hash<storm::storage::BitVector>()(query.psiStates));
+    return seed;
+}
+
+template class SparseAnalysisCache<double>;
+template class SparseAnalysisCache<storm::RationalNumber>;
+template class SparseAnalysisCache<storm::RationalFunction>;
+
+}  // namespace modelchecker
+}  // namespace storm
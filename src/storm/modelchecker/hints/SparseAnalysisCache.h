@@ -0,0 +1,149 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/modelchecker/hints/AnalysisCache.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * Caches the backward transitions, the qualitative analyses of until probabilities and the solutions of until probabilities of a sparse model.
+ * The qualitative analyses are keyed by the optimization direction and the phi and psi states. The solutions are keyed by the psi states only, such that
+ * queries for the same target set but with another bound, optimization direction or set of phi states can be warm started. Only a bounded number of
+ * solutions is stored; the least recently used one is evicted first. All methods are thread-safe.
+ */
+template<typename ValueType>
+class SparseAnalysisCache : public AnalysisCache {
+   public:
+    /*!
+     * Creates an empty cache for the model with the given transition matrix. The matrix must not be modified while the cache is in use.
+     *
+     * @param maximalNumberOfStoredSolutions The maximal number of solutions that are kept for warm starts. If zero, no solutions are stored and
+     * checks are never warm started.
+     */
+    explicit SparseAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t maximalNumberOfStoredSolutions = 0);
+
+    virtual ~SparseAnalysisCache() = default;
+
+    /*!
+     * Retrieves whether this cache was created for the given transition matrix.
+     */
+    bool isCacheFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const;
+
+    /*!
+     * Retrieves the backward transitions of the model. They are computed upon the first call.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions();
+
+    /*!
+     * Retrieves the states that satisfy phi until psi with probability 0 and 1, respectively.
+     *
+     * @param dir If given, the probabilities are minimized or maximized over all schedulers of the (nondeterministic) model. Otherwise, the model is
+     * assumed to be deterministic.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> const& getStatesWithProbability01(boost::optional<storm::OptimizationDirection> const& dir,
+                                                                                                     storm::storage::BitVector const& phiStates,
+                                                                                                     storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Creates a hint for computing the probabilities of phi until psi that only requires to compute the values of the maybe states.
+     * If warm starts are allowed and a solution for the same psi states has been stored before, the hint contains this solution as initial values of
+     * the maybe states. Solutions with the same optimization direction are preferred. Otherwise, the hint only contains the values of the non-maybe
+     * states.
+     *
+     * @param dir If given, the probabilities are minimized or maximized over all schedulers of the (nondeterministic) model.
+     * @param allowWarmStart If set, the initial values of the maybe states may be taken from a stored solution. Since these values are not necessarily
+     * lower bounds of the actual values, this should not be set if sound results are required.
+     */
+    std::shared_ptr<ExplicitModelCheckerHint<ValueType>> createUntilProbabilitiesHint(boost::optional<storm::OptimizationDirection> const& dir,
+                                                                                      storm::storage::BitVector const& phiStates,
+                                                                                      storm::storage::BitVector const& psiStates, bool allowWarmStart);
+
+    /*!
+     * Stores the solution of the given until probabilities query such that it can be used to warm start subsequent checks with the same psi states.
+     * The solution is only stored if it is a fixpoint of the Bellman operator up to the given precision, i.e., solutions of solvers that did not converge
+     * are discarded. Solutions of parametric models are never stored.
+     *
+     * @param precision The precision of the solver that computed the solution or none if the solution was computed exactly.
+     * @param relative Whether the precision is relative to the values.
+     */
+    void storeUntilProbabilities(boost::optional<storm::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates,
+                                 storm::storage::BitVector const& psiStates, std::vector<ValueType> const& values,
+                                 boost::optional<storm::RationalNumber> const& precision, bool relative);
+
+    virtual void printStatistics(std::ostream& out) const override;
+
+   private:
+    struct UntilQuery {
+        bool operator==(UntilQuery const& other) const;
+
+        boost::optional<storm::OptimizationDirection> dir;
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+    };
+
+    struct UntilQueryHash {
+        std::size_t operator()(UntilQuery const& query) const;
+    };
+
+    struct UntilQueryResults {
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+        // Whether all maybe states reach a non-maybe state almost surely under all schedulers, i.e., there are no end components of maybe states.
+        boost::optional<bool> noEndComponentsInMaybeStates;
+    };
+
+    struct StoredSolution {
+        boost::optional<storm::OptimizationDirection> dir;
+        storm::storage::BitVector psiStates;
+        std::vector<ValueType> values;
+    };
+
+    // The following methods require that the mutex is locked.
+    UntilQueryResults& getUntilQueryResults(UntilQuery const& query);
+    storm::storage::SparseMatrix<ValueType> const& getOrComputeBackwardTransitions();
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    uint64_t const maximalNumberOfStoredSolutions;
+
+    // Guards all members below.
+    mutable std::mutex mutex;
+
+    boost::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+    std::unordered_map<UntilQuery, UntilQueryResults, UntilQueryHash> untilQueries;
+    // The latest solution for each set of psi states and optimization direction, ordered from the most to the least recently used one.
+    std::list<StoredSolution> solutions;
+
+    uint64_t backwardTransitionsRequests;
+    uint64_t qualitativeAnalysisHits;
+    uint64_t qualitativeAnalysisMisses;
+    uint64_t warmStarts;
+    uint64_t discardedSolutions;
+    uint64_t evictedSolutions;
+};
+
+/*!
+ * Retrieves the given cache if it is a sparse analysis cache for the given transition matrix and nullptr otherwise.
+ */
+template<typename ValueType>
+std::shared_ptr<SparseAnalysisCache<ValueType>> getSparseAnalysisCache(std::shared_ptr<AnalysisCache> const& cache,
+                                                                       storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    auto result = std::dynamic_pointer_cast<SparseAnalysisCache<ValueType>>(cache);
+    if (result && result->isCacheFor(transitionMatrix)) {
+        return result;
+    }
+    return nullptr;
+}
+
+}  // namespace modelchecker
+}  // namespace storm
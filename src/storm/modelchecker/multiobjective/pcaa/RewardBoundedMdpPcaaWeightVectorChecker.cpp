@@ -78,18 +78,22 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
 
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
-    EpochCheckingData cachedData;
+    // Each worker that may analyze epochs concurrently gets its own solvers.
+    std::vector<EpochCheckingData> cachedData(rewardUnfolding.getNumberOfEpochWorkers());
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
     Environment newEnv = env;
     newEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
     newEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+    std::vector<Environment> workerEnvs = newEnv.copyPerWorker(cachedData.size());
     storm::utility::ProgressMeasurement progress("epochs");
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        computeEpochSolution(newEnv, epoch, weightVector, cachedData);
+    auto analyzer = [&](helper::rewardbounded::EpochModel<ValueType, false>& epochModel, uint64_t worker) {
+        return computeEpochSolution(workerEnvs[worker], epochModel, weightVector, cachedData[worker]);
+    };
+    auto epochSolved = [&](typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -106,10 +110,10 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
-    }
+        return !storm::utility::resources::isTerminate();
+    };
+    rewardUnfolding.analyzeEpochs(epochOrder, analyzer, epochSolved, &swEpochModelBuild, &swEpochModelAnalysis);
+    this->numCheckedEpochs += numCheckedEpochs;
 
     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
         std::vector<std::string> headers;
@@ -132,14 +136,10 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
 }
 
 template<class SparseMdpModelType>
-void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSolution(
-    Environment const& env, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch,
-    std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData) {
-    ++numCheckedEpochs;
-    swEpochModelBuild.start();
-    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-    swEpochModelBuild.stop();
-    swEpochModelAnalysis.start();
+std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<typename SparseMdpModelType::ValueType, false>::SolutionType>
+RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSolution(
+    Environment const& env, helper::rewardbounded::EpochModel<ValueType, false>& epochModel, std::vector<ValueType> const& weightVector,
+    EpochCheckingData& cachedData) const {
     std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> result;
     result.reserve(epochModel.epochInStates.getNumberOfSetBits());
     uint64_t solutionSize = this->objectives.size() + 1;
@@ -319,14 +319,13 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             }
         }
     }
-    rewardUnfolding.setSolutionForCurrentEpoch(std::move(result));
-    swEpochModelAnalysis.stop();
+    return result;
 }
 
 template<class SparseMdpModelType>
-void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::updateCachedData(Environment const& env,
-                                                                                   helper::rewardbounded::EpochModel<ValueType, false> const& epochModel,
-                                                                                   EpochCheckingData& cachedData, std::vector<ValueType> const& weightVector) {
+void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::updateCachedData(
+    Environment const& env, helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, EpochCheckingData& cachedData,
+    std::vector<ValueType> const& weightVector) const {
     if (epochModel.epochMatrixChanged) {
         // Update the cached MinMaxSolver data
         cachedData.bMinMax.resize(epochModel.epochMatrix.getRowCount());
@@ -60,11 +60,15 @@ class RewardBoundedMdpPcaaWeightVectorChecker : public PcaaWeightVectorChecker<S
         std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> solutions;
     };
 
-    void computeEpochSolution(Environment const& env, typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::Epoch const& epoch,
-                              std::vector<ValueType> const& weightVector, EpochCheckingData& cachedData);
+    /*!
+     * Analyzes the given epoch model. Does not modify the state of this checker (apart from the given cached data) and can thus be invoked concurrently.
+     */
+    std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> computeEpochSolution(
+        Environment const& env, helper::rewardbounded::EpochModel<ValueType, false>& epochModel, std::vector<ValueType> const& weightVector,
+        EpochCheckingData& cachedData) const;
 
     void updateCachedData(Environment const& env, typename helper::rewardbounded::EpochModel<ValueType, false> const& epochModel, EpochCheckingData& cachedData,
-                          std::vector<ValueType> const& weightVector);
+                          std::vector<ValueType> const& weightVector) const;
 
     storm::utility::Stopwatch swAll, swEpochModelBuild, swEpochModelAnalysis;
     uint64_t numCheckedEpochs, numChecks;
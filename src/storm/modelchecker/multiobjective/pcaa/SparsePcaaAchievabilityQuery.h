@@ -40,9 +40,10 @@ class SparsePcaaAchievabilityQuery : public SparsePcaaQuery<SparseModelType, Geo
     bool checkAchievability(Environment const& env);
 
     /*
-     * Updates the precision of the weightVectorChecker w.r.t. the provided weights
+     * Updates the precision of the weightVectorChecker w.r.t. the provided weights.
+     * For multiple weight vectors, the smallest precision among them is taken.
      */
-    void updateWeightedPrecision(WeightVector const& weights);
+    void updateWeightedPrecision(std::vector<WeightVector> const& weightVectors);
 
     /*
      * Returns true iff there is one point in the given polytope that satisfies the given thresholds.
@@ -1,6 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -29,7 +31,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      preprocessorResult(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -87,31 +92,122 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
     return halfspaces[farestHalfspaceIndex].normalVector();
 }
 
+template<class SparseModelType, typename GeometryValueType>
+std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector>
+SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors) {
+    std::vector<WeightVector> result;
+    result.push_back(findSeparatingVector(pointToBeSeparated));
+    if (underApproximation->isEmpty()) {
+        // Every weight vector is separating, so we consider the remaining Dirac weight vectors
+        while (result.size() < maxNumberOfVectors && result.size() < pointToBeSeparated.size() && !diracWeightVectorsToBeChecked.empty()) {
+            result.push_back(findSeparatingVector(pointToBeSeparated));
+        }
+        return result;
+    }
+
+    // Consider the remaining halfspaces of the underApproximation that separate the given point, ordered by their distance to the point.
+    std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> halfspaces = underApproximation->getHalfspaces();
+    std::vector<std::pair<GeometryValueType, uint64_t>> distanceHalfspaceIndexPairs;
+    for (uint64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
+        GeometryValueType distance = halfspaces[halfspaceIndex].euclideanDistance(pointToBeSeparated);
+        if (!storm::utility::isZero(distance) && halfspaces[halfspaceIndex].normalVector() != result.front()) {
+            distanceHalfspaceIndexPairs.emplace_back(distance, halfspaceIndex);
+        }
+    }
+    std::stable_sort(distanceHalfspaceIndexPairs.begin(), distanceHalfspaceIndexPairs.end(),
+                     [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+    for (auto const& distanceHalfspaceIndexPair : distanceHalfspaceIndexPairs) {
+        if (result.size() >= maxNumberOfVectors) {
+            break;
+        }
+        result.push_back(halfspaces[distanceHalfspaceIndexPair.second].normalVector());
+    }
+    return result;
+}
+
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-    // Normalize the direction vector so that the entries sum up to one
-    storm::utility::vector::scaleVectorInPlace(
-        direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-    STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-    RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-    // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-            step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-            step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+    std::vector<WeightVector> directions;
+    directions.push_back(std::move(direction));
+    performRefinementSteps(env, std::move(directions));
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    // Normalize the direction vectors so that the entries sum up to one
+    for (auto& direction : directions) {
+        GeometryValueType sum = std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>());
+        storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / sum);
+    }
+
+    // Each direction is checked by its own weight vector checker. The additional checkers inherit the precision of the main checker.
+    std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers;
+    checkers.push_back(weightVectorChecker.get());
+    for (uint64_t directionIndex = 1; directionIndex < directions.size(); ++directionIndex) {
+        if (additionalWeightVectorCheckers.size() < directionIndex) {
+            additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+        }
+        checkers.push_back(additionalWeightVectorCheckers[directionIndex - 1].get());
+        checkers.back()->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+    }
+
+    auto checkDirection = [&](Environment const& checkEnv, uint64_t directionIndex) {
+        checkers[directionIndex]->check(checkEnv,
+                                        storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(directions[directionIndex]));
+    };
+    bool checkConcurrently = directions.size() > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifndef STORM_HAVE_INTELTBB
+    if (checkConcurrently) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        checkConcurrently = false;
+    }
+#endif
+    if (checkConcurrently) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, directions.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            Environment taskEnv(env);
+            for (uint64_t directionIndex = range.begin(); directionIndex < range.end(); ++directionIndex) {
+                checkDirection(taskEnv, directionIndex);
+            }
+        });
+#endif
+    } else {
+        for (uint64_t directionIndex = 0; directionIndex < directions.size(); ++directionIndex) {
+            checkDirection(env, directionIndex);
         }
     }
-    refinementSteps.push_back(std::move(step));
 
-    updateOverApproximation();
+    for (uint64_t directionIndex = 0; directionIndex < directions.size(); ++directionIndex) {
+        auto const& checker = *checkers[directionIndex];
+        STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
+                            storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
+        RefinementStep step;
+        step.weightVector = std::move(directions[directionIndex]);
+        step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+        step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
+        // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+        for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+            }
+        }
+        refinementSteps.push_back(std::move(step));
+        updateOverApproximation();
+    }
     updateUnderApproximation();
 }
 
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getWeightVectorBatchSize(Environment const& env) const {
+    uint64_t result = env.modelchecker().multi().getWeightVectorBatchSize();
+    if (env.modelchecker().multi().isMaxStepsSet()) {
+        uint64_t const& maxSteps = env.modelchecker().multi().getMaxSteps();
+        result = std::min<uint64_t>(result, maxSteps - std::min<uint64_t>(maxSteps, refinementSteps.size()));
+    }
+    return std::max<uint64_t>(result, 1);
+}
+
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
     storm::storage::geometry::Halfspace<GeometryValueType> h(
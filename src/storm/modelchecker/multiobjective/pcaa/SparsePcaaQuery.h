@@ -63,11 +63,33 @@ class SparsePcaaQuery {
      */
     WeightVector findSeparatingVector(Point const& pointToBeSeparated);
 
+    /*
+     * Returns up to the given number of distinct weight vectors that separate the under approximation from the given point.
+     * The first one is the weight vector returned by findSeparatingVector. The remaining ones are the normal vectors of further halfspaces of the under
+     * approximation, ordered by their distance to the given point.
+     *
+     * @param pointToBeSeparated the point that is to be seperated
+     * @param maxNumberOfVectors the maximal number of weight vectors to return
+     */
+    std::vector<WeightVector> findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors);
+
     /*
      * Refines the current result w.r.t. the given direction vector.
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. each of the given direction vectors.
+     * If Intel TBB is enabled, the weight vectors are checked concurrently, each by its own weight vector checker.
+     * The approximations are updated with the results in the order of the given directions, so the outcome does not depend on the scheduling of the checks.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of weight vectors that may be checked in the next refinement steps, taking the maximum number of refinement steps into account.
+     */
+    uint64_t getWeightVectorBatchSize(Environment const& env) const;
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -95,6 +117,10 @@ class SparsePcaaQuery {
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
 
+    // Further weight vector checkers that are used to check multiple weight vectors concurrently. They are created on demand.
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
+
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
     // Overapproximation of the set of achievable values
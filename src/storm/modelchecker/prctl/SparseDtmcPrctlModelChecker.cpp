@@ -17,11 +17,13 @@
 #include "storm/modelchecker/helper/infinitehorizon/SparseDeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
+#include "storm/modelchecker/hints/SparseAnalysisCache.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/QuantileHelper.h"
 
 #include "storm/logic/FragmentSpecification.h"
 
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/solver/SolveGoal.h"
 
 #include "storm/models/sparse/Dtmc.h"
@@ -127,10 +129,27 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
     ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
-    std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
-        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
-        checkTask.getHint());
+    std::vector<ValueType> numericResult;
+    auto analysisCache = getSparseAnalysisCache(checkTask.getAnalysisCache(), this->getModel().getTransitionMatrix());
+    if (analysisCache && checkTask.getHint().isEmpty()) {
+        // Reuse the qualitative analysis of previous checks of the same query and possibly a solution for the same target states.
+        auto hint = analysisCache->createUntilProbabilitiesHint(boost::none, leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(),
+                                                                !env.solver().isForceSoundness());
+        numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
+            env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+            analysisCache->getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
+            *hint);
+        if (!checkTask.isQualitativeSet()) {
+            auto precision = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType());
+            analysisCache->storeUntilProbabilities(boost::none, leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), numericResult,
+                                                   precision.first, precision.second && precision.second.get());
+        }
+    } else {
+        numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
+            env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+            this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
+            checkTask.getHint());
+    }
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
 
@@ -19,12 +19,15 @@
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
+#include "storm/modelchecker/hints/SparseAnalysisCache.h"
 #include "storm/modelchecker/lexicographic/lexicographicModelChecking.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/QuantileHelper.h"
 
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/solver/SolveGoal.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -180,6 +183,28 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
     ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+    if constexpr (std::is_same<ValueType, SolutionType>::value) {
+        auto analysisCache = getSparseAnalysisCache(checkTask.getAnalysisCache(), this->getModel().getTransitionMatrix());
+        if (analysisCache && checkTask.getHint().isEmpty()) {
+            // Reuse the qualitative analysis of previous checks of the same query and possibly a solution for the same target states.
+            auto hint = analysisCache->createUntilProbabilitiesHint(checkTask.getOptimizationDirection(), leftResult.getTruthValuesVector(),
+                                                                    rightResult.getTruthValuesVector(), !env.solver().isForceSoundness());
+            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
+                env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+                analysisCache->getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
+                checkTask.isProduceSchedulersSet(), *hint);
+            if (!checkTask.isQualitativeSet()) {
+                analysisCache->storeUntilProbabilities(checkTask.getOptimizationDirection(), leftResult.getTruthValuesVector(),
+                                                       rightResult.getTruthValuesVector(), ret.values, env.solver().minMax().getPrecision(),
+                                                       env.solver().minMax().getRelativeTerminationCriterion());
+            }
+            std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.values)));
+            if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
+                result->asExplicitQuantitativeCheckResult<SolutionType>().setScheduler(std::move(ret.scheduler));
+            }
+            return result;
+        }
+    }
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
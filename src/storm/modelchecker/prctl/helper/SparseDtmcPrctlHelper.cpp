@@ -68,9 +68,10 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
 
-    // initialize data that will be needed for each epoch
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
+    // initialize data that will be needed for each epoch. Each worker that may analyze epochs concurrently gets its own solver.
+    uint64_t numWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+    std::vector<std::vector<ValueType>> x(numWorkers), b(numWorkers);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numWorkers);
 
     Environment preciseEnv = env;
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
@@ -83,18 +84,16 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     // Set the correct equation problem format.
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
     rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
+    std::vector<Environment> workerEnvs = preciseEnv.copyPerWorker(numWorkers);
 
     storm::utility::ProgressMeasurement progress("epochs");
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto analyzer = [&](rewardbounded::EpochModel<ValueType, true>& epochModel, uint64_t worker) {
+        return epochModel.analyzeSingleObjective(workerEnvs[worker], x[worker], b[worker], linEqSolvers[worker], lowerBound, upperBound);
+    };
+    auto epochSolved = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -108,10 +107,9 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
-    }
+        return !storm::utility::resources::isTerminate();
+    };
+    rewardUnfolding.analyzeEpochs(epochOrder, analyzer, epochSolved, &swBuild, &swCheck);
 
     std::map<storm::storage::sparse::state_type, ValueType> result;
     for (auto initState : model.getInitialStates()) {
@@ -219,7 +217,8 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             // This is the initial guess for the iterative solvers. It should be safe as for all
             // 'maybe' states we know that the probability is strictly larger than 0.
             std::vector<ValueType> x;
-            if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasResultHint()) {
+            if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasResultHint() &&
+                !hint.template asExplicitModelCheckerHint<ValueType>().getResultHintOnlyForNonMaybeStates()) {
                 x = storm::utility::vector::filterVector(hint.template asExplicitModelCheckerHint<ValueType>().getResultHint(), maybeStates);
             } else {
                 x = std::vector<ValueType>(maybeStates.getNumberOfSetBits(), storm::utility::convertNumber<ValueType>(0.5));
@@ -496,7 +495,8 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             // Initialize the x vector with the hint (if available) or with 1 for each element.
             // This is the initial guess for the iterative solvers.
             std::vector<ValueType> x;
-            if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasResultHint()) {
+            if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasResultHint() &&
+                !hint.template asExplicitModelCheckerHint<ValueType>().getResultHintOnlyForNonMaybeStates()) {
                 x = storm::utility::vector::filterVector(hint.template asExplicitModelCheckerHint<ValueType>().getResultHint(), maybeStates);
             } else {
                 x = std::vector<ValueType>(submatrix.getColumnCount(), storm::utility::one<ValueType>());
@@ -71,14 +71,16 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         auto initEpoch = rewardUnfolding.getStartEpoch();
         auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
 
-        // initialize data that will be needed for each epoch
-        std::vector<ValueType> x, b;
-        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
+        // initialize data that will be needed for each epoch. Each worker that may analyze epochs concurrently gets its own solver.
+        uint64_t numWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+        std::vector<std::vector<ValueType>> x(numWorkers), b(numWorkers);
+        std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numWorkers);
 
         ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
             initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
         Environment preciseEnv = env;
         preciseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+        std::vector<Environment> workerEnvs = preciseEnv.copyPerWorker(numWorkers);
 
         // In case of cdf export we store the necessary data.
         std::vector<std::vector<ValueType>> cdfData;
@@ -87,13 +89,10 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         progress.setMaxCount(epochOrder.size());
         progress.startNewMeasurement(0);
         uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
-            swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-            swCheck.stop();
+        auto analyzer = [&](rewardbounded::EpochModel<ValueType, true>& epochModel, uint64_t worker) {
+            return epochModel.analyzeSingleObjective(workerEnvs[worker], dir, x[worker], b[worker], minMaxSolvers[worker], lowerBound, upperBound);
+        };
+        auto epochSolved = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
             if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
                 !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                 std::vector<ValueType> cdfEntry;
@@ -107,10 +106,9 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
             }
             ++numCheckedEpochs;
             progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
-            }
-        }
+            return !storm::utility::resources::isTerminate();
+        };
+        rewardUnfolding.analyzeEpochs(epochOrder, analyzer, epochSolved, &swBuild, &swCheck);
 
         std::map<storm::storage::sparse::state_type, ValueType> result;
         for (auto initState : initialStates) {
@@ -316,6 +314,7 @@ void extractValueAndSchedulerHint(SparseMdpHintType<SolutionType>& hintStorage,
 
     // Deal with solution value hint. Only applicable if there are no End Components consisting of maybe states.
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasResultHint() &&
+        !hint.template asExplicitModelCheckerHint<ValueType>().getResultHintOnlyForNonMaybeStates() &&
         (skipECWithinMaybeStatesCheck || hintStorage.hasSchedulerHint() ||
          storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, maybeStates, ~maybeStates)
              .full())) {
@@ -1,11 +1,14 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -405,6 +408,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
         setCurrentEpochClass(epoch);
         epochModel.epochMatrixChanged = true;
+        workerEpochModelsUpToDate.assign(workerEpochModels.size(), false);
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
                 std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
@@ -860,15 +864,22 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    setSolutionForEpoch(currentEpoch.get(), std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions) {
+    STORM_LOG_ASSERT(currentEpoch && epochManager.compareEpochClass(epoch, currentEpoch.get()),
+                     "Tried to set a solution for an epoch whose epoch class is not the current one.");
     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
@@ -885,7 +896,156 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     solution.count = predecessorEpochs.size();
     solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getNumberOfEpochWorkers() const {
+#ifdef STORM_HAVE_INTELTBB
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        return std::max<uint64_t>(1, storm::utility::getNumberOfThreads());
+    }
+#endif
+    return 1;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+bool MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::dependsOnAnyEpoch(Epoch const& epoch, std::set<Epoch> const& epochs) const {
+    for (auto const& step : possibleEpochSteps) {
+        Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+        if (successorEpoch != epoch && epochs.count(successorEpoch) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(std::vector<Epoch> const& epochOrder, EpochModelAnalyzer const& analyzer,
+                                                                                    EpochSolvedCallback const& epochSolved, storm::utility::Stopwatch* buildWatch,
+                                                                                    storm::utility::Stopwatch* analysisWatch) {
+    uint64_t const numWorkers = getNumberOfEpochWorkers();
+#ifndef STORM_HAVE_INTELTBB
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    }
+#endif
+    // Bounds the number of epochs whose step solutions are held at the same time.
+    uint64_t const maxBatchSize = numWorkers == 1 ? 1 : 4 * numWorkers;
+    if (workerEpochModels.size() + 1 < numWorkers) {
+        workerEpochModels.resize(numWorkers - 1);
+        workerEpochModelsUpToDate.resize(numWorkers - 1, false);
+    }
+
+    auto epochIt = epochOrder.begin();
+    std::vector<Epoch> batch;
+    std::set<Epoch> batchEpochs;
+    while (epochIt != epochOrder.end()) {
+        // Gather epochs of the same epoch class that do not depend on each other.
+        // As the epochs are sorted in a valid computation order, all their successor epochs have been solved before.
+        batch.clear();
+        batchEpochs.clear();
+        do {
+            batch.push_back(*epochIt);
+            batchEpochs.insert(*epochIt);
+            ++epochIt;
+        } while (batch.size() < maxBatchSize && epochIt != epochOrder.end() && epochManager.compareEpochClass(*epochIt, batch.front()) &&
+                 !dependsOnAnyEpoch(*epochIt, batchEpochs));
+
+        if (batch.size() == 1) {
+            if (buildWatch) {
+                buildWatch->start();
+            }
+            auto& currentEpochModel = setCurrentEpoch(batch.front());
+            if (buildWatch) {
+                buildWatch->stop();
+            }
+            if (analysisWatch) {
+                analysisWatch->start();
+            }
+            auto solution = analyzer(currentEpochModel, 0);
+            if (analysisWatch) {
+                analysisWatch->stop();
+            }
+            setSolutionForEpoch(batch.front(), std::move(solution));
+            if (!epochSolved(batch.front())) {
+                return;
+            }
+            continue;
+        }
+
+        // Set up the epoch-specific parts of the epoch models.
+        if (buildWatch) {
+            buildWatch->start();
+        }
+        std::vector<std::vector<SolutionType>> batchStepSolutions;
+        std::vector<std::vector<storm::storage::BitVector>> batchObjectiveRewardFilters;
+        bool epochClassChanged = false;
+        for (auto const& epoch : batch) {
+            setCurrentEpoch(epoch);
+            epochClassChanged |= epochModel.epochMatrixChanged;
+            batchStepSolutions.push_back(std::move(epochModel.stepSolutions));
+            batchObjectiveRewardFilters.push_back(epochModel.objectiveRewardFilter);
+        }
+        // Distribute the epochs over the workers. Each worker processes a contiguous chunk of the batch using its own epoch model.
+        uint64_t const numChunks = std::min<uint64_t>(numWorkers, batch.size());
+        std::vector<uint64_t> chunkStart(numChunks + 1);
+        for (uint64_t chunk = 0; chunk <= numChunks; ++chunk) {
+            chunkStart[chunk] = chunk * batch.size() / numChunks;
+        }
+        std::vector<bool> workerMatrixChanged(numChunks);
+        workerMatrixChanged[0] = epochClassChanged;
+        for (uint64_t worker = 1; worker < numChunks; ++worker) {
+            auto& workerEpochModel = workerEpochModels[worker - 1];
+            workerMatrixChanged[worker] = !workerEpochModelsUpToDate[worker - 1];
+            if (workerMatrixChanged[worker]) {
+                workerEpochModel.epochMatrix = epochModel.epochMatrix;
+                workerEpochModel.stepChoices = epochModel.stepChoices;
+                workerEpochModel.objectiveRewards = epochModel.objectiveRewards;
+                workerEpochModel.epochInStates = epochModel.epochInStates;
+                workerEpochModel.equationSolverProblemFormat = epochModel.equationSolverProblemFormat;
+                workerEpochModelsUpToDate[worker - 1] = true;
+            }
+        }
+        if (buildWatch) {
+            buildWatch->stop();
+        }
+
+        if (analysisWatch) {
+            analysisWatch->start();
+        }
+        std::vector<std::vector<SolutionType>> batchSolutions(batch.size());
+        auto analyzeChunk = [&](uint64_t worker) {
+            auto& workerEpochModel = worker == 0 ? epochModel : workerEpochModels[worker - 1];
+            for (uint64_t batchIndex = chunkStart[worker]; batchIndex < chunkStart[worker + 1]; ++batchIndex) {
+                workerEpochModel.epochMatrixChanged = batchIndex == chunkStart[worker] && workerMatrixChanged[worker];
+                workerEpochModel.stepSolutions = std::move(batchStepSolutions[batchIndex]);
+                workerEpochModel.objectiveRewardFilter = std::move(batchObjectiveRewardFilters[batchIndex]);
+                batchSolutions[batchIndex] = analyzer(workerEpochModel, worker);
+            }
+        };
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numChunks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                analyzeChunk(worker);
+            }
+        });
+#else
+        for (uint64_t worker = 0; worker < numChunks; ++worker) {
+            analyzeChunk(worker);
+        }
+#endif
+        if (analysisWatch) {
+            analysisWatch->stop();
+        }
+
+        for (uint64_t batchIndex = 0; batchIndex < batch.size(); ++batchIndex) {
+            setSolutionForEpoch(batch[batchIndex], std::move(batchSolutions[batchIndex]));
+            if (!epochSolved(batch[batchIndex])) {
+                return;
+            }
+        }
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -28,6 +29,17 @@ class MultiDimensionalRewardUnfolding {
 
     typedef typename std::conditional<SingleObjectiveMode, ValueType, std::vector<ValueType>>::type SolutionType;
 
+    /*!
+     * Function that analyzes the given epoch model and returns the solutions for its in-states.
+     * The second argument is the index of the worker that performs the analysis. Different workers may run concurrently and thus must not share solvers.
+     */
+    typedef std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, uint64_t)> EpochModelAnalyzer;
+
+    /*!
+     * Function that is called after the solution of the given epoch has been stored. Returning false aborts the analysis of further epochs.
+     */
+    typedef std::function<bool(Epoch const&)> EpochSolvedCallback;
+
     /*
      *
      * @param model The (preprocessed) model
@@ -78,6 +90,28 @@ class MultiDimensionalRewardUnfolding {
     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
 
     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+
+    /*!
+     * @return the number of workers that analyzeEpochs may use concurrently, i.e., the number of solver instances a caller needs to provide.
+     */
+    uint64_t getNumberOfEpochWorkers() const;
+
+    /*!
+     * Analyzes the given epochs, i.e., sets the epoch model for each epoch, analyzes it using the given analyzer, and stores the solution.
+     * The epochs are treated as a DAG in which each epoch depends on its successor epochs. Ready epochs of the same epoch class, i.e., epochs whose
+     * successors have all been solved, are analyzed concurrently if Intel TBB is enabled. Each worker operates on its own copy of the epoch model.
+     * The number of epochs processed at once is bounded so that only few step solutions are held in memory at the same time.
+     * Solutions that are no longer needed are released as in setSolutionForCurrentEpoch.
+     *
+     * @param epochOrder The epochs in a valid computation order, e.g., as obtained from getEpochComputationOrder.
+     * @param analyzer The function used to analyze the epoch models.
+     * @param epochSolved Invoked (sequentially and in the given order) after the solution of an epoch has been stored.
+     * @param buildWatch If given, the time for setting up the epoch models is added to this stopwatch.
+     * @param analysisWatch If given, the time for analyzing the epoch models is added to this stopwatch.
+     */
+    void analyzeEpochs(std::vector<Epoch> const& epochOrder, EpochModelAnalyzer const& analyzer, EpochSolvedCallback const& epochSolved,
+                       storm::utility::Stopwatch* buildWatch = nullptr, storm::utility::Stopwatch* analysisWatch = nullptr);
+
     SolutionType getInitialStateResult(Epoch const& epoch);  // Assumes that the initial state is unique
     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
 
@@ -86,6 +120,8 @@ class MultiDimensionalRewardUnfolding {
 
    private:
     void setCurrentEpochClass(Epoch const& epoch);
+    void setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions);
+    bool dependsOnAnyEpoch(Epoch const& epoch, std::set<Epoch> const& epochs) const;
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -136,6 +172,10 @@ class MultiDimensionalRewardUnfolding {
     EpochModel<ValueType, SingleObjectiveMode> epochModel;
     boost::optional<Epoch> currentEpoch;
 
+    // Copies of the epoch model for concurrent workers (worker 0 uses epochModel) and whether they reflect the current epoch class.
+    std::vector<EpochModel<ValueType, SingleObjectiveMode>> workerEpochModels;
+    std::vector<bool> workerEpochModelsUpToDate;
+
     EpochManager epochManager;
 
     std::vector<Dimension<ValueType>> dimensions;
@@ -395,9 +395,20 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                                                 CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding) {
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
     auto upperBound = rewardUnfolding.getUpperObjectiveBound();
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;  // Needed for MDP
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;         // Needed for DTMC
+    // Each worker that may analyze epochs concurrently gets its own solver.
+    uint64_t numWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+    std::vector<std::vector<ValueType>> x(numWorkers), b(numWorkers);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numWorkers);  // Needed for MDP
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numWorkers);         // Needed for DTMC
+    std::vector<Environment> workerEnvs = env.copyPerWorker(numWorkers);
+    auto analyzer = [&](EpochModel<ValueType, true>& epochModel, uint64_t worker) {
+        if (model.isNondeterministicModel()) {
+            return epochModel.analyzeSingleObjective(workerEnvs[worker], boundedUntilOperator.getOptimalityType(), x[worker], b[worker],
+                                                     minMaxSolvers[worker], lowerBound, upperBound);
+        } else {
+            return epochModel.analyzeSingleObjective(workerEnvs[worker], x[worker], b[worker], linEqSolvers[worker], lowerBound, upperBound);
+        }
+    };
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
@@ -432,18 +443,9 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                 }
                 STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
                 auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
+                bool insufficientPrecision = false;
+                auto epochSolved = [&](typename MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swEpochAnalysis.stop();
-
                     CostLimits epochAsCostLimits;
                     if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
                                                    epochAsCostLimits)) {
@@ -456,7 +458,7 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
                             if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
                                 // unclear result due to insufficient precision.
-                                swExploration.stop();
+                                insufficientPrecision = true;
                                 return false;
                             }
                         } else {
@@ -468,6 +470,12 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             unsatCostLimits.insert(epochAsCostLimits);
                         }
                     }
+                    return true;
+                };
+                rewardUnfolding.analyzeEpochs(epochSequence, analyzer, epochSolved, &swEpochAnalysis, &swEpochAnalysis);
+                if (insufficientPrecision) {
+                    swExploration.stop();
+                    return false;
                 }
             }
         } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <random>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -914,6 +915,8 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHyb
     // When using the hybrid technique, we recursively treat the SCCs up to some size.
     std::vector<storm::storage::sparse::state_type> entryStateQueue;
     STORM_LOG_DEBUG("Eliminating " << subsystem.size() << " states using the hybrid elimination technique.\n");
+    STORM_LOG_INFO_COND(!storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() || isConcurrentSccEliminationEnabled(),
+                        "SCCs are eliminated sequentially as the arithmetic of rational functions is not thread-safe.");
     uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0,
                                           storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue,
                                           computeResultsForInitialStatesOnly, distanceBasedPriorities);
@@ -1016,6 +1019,50 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
 
         // And then recursively treat the remaining sub-SCCs.
         STORM_LOG_TRACE("Eliminating " << remainingSccs.getNumberOfSetBits() << " remaining SCCs on level " << level << ".");
+        bool eliminateSubSccEntryStates =
+            eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet();
+        if (isIndependentSccEliminationEnabled()) {
+            // The sub-SCCs that are small enough to be eliminated directly do not interfere with each other as long as their entry states are kept.
+            storm::storage::BitVector smallSccIndices(decomposition.size());
+            std::vector<storm::storage::BitVector> smallSccs;
+            std::vector<storm::storage::BitVector> smallSccEntryStates;
+            for (auto sccIndex : remainingSccs) {
+                storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
+                if (newScc.size() > maximalSccSize) {
+                    continue;
+                }
+                smallSccIndices.set(sccIndex);
+                smallSccs.emplace_back(forwardTransitions.getRowCount(), newScc.begin(), newScc.end());
+                // Here, every state with a predecessor outside of the SCC is an entry state (regardless of the probability) such that the remaining
+                // states only have predecessors within the SCC.
+                storm::storage::BitVector& entryStates = smallSccEntryStates.emplace_back(forwardTransitions.getRowCount());
+                for (auto const& state : newScc) {
+                    for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                        if (!smallSccs.back().get(predecessor.getColumn())) {
+                            entryStates.set(state);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (smallSccs.size() > 1) {
+                STORM_LOG_TRACE("Eliminating " << smallSccs.size() << " independent SCCs on level " << level << ".");
+                performIndependentSccElimination(smallSccs, smallSccEntryStates, matrix, backwardTransitions, values, initialStates,
+                                                computeResultsForInitialStatesOnly, distanceBasedPriorities);
+                for (auto const& entryStates : smallSccEntryStates) {
+                    if (eliminateSubSccEntryStates) {
+                        std::shared_ptr<StatePriorityQueue> naivePriorities = createStatePriorityQueue(entryStates);
+                        performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates,
+                                                           computeResultsForInitialStatesOnly);
+                    } else {
+                        entryStateQueue.insert(entryStateQueue.end(), entryStates.begin(), entryStates.end());
+                    }
+                }
+                maximalDepth = std::max(maximalDepth, level + 1);
+                remainingSccs &= ~smallSccIndices;
+            }
+        }
         for (auto sccIndex : remainingSccs) {
             storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
 
@@ -1033,10 +1080,9 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
             }
 
             // Recursively descend in SCC-hierarchy.
-            uint_fast64_t depth =
-                treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions,
-                         eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(),
-                         level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+            uint_fast64_t depth = treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions,
+                                           eliminateSubSccEntryStates, level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly,
+                                           distanceBasedPriorities);
             maximalDepth = std::max(maximalDepth, depth);
         }
     } else {
@@ -1064,6 +1110,153 @@ uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(
     return maximalDepth;
 }
 
+template<typename SparseDtmcModelType>
+bool SparseDtmcEliminationModelChecker<SparseDtmcModelType>::isIndependentSccEliminationEnabled() {
+    return storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateIndependentSccsSet() ||
+           isConcurrentSccEliminationEnabled();
+}
+
+template<typename SparseDtmcModelType>
+bool SparseDtmcEliminationModelChecker<SparseDtmcModelType>::isConcurrentSccEliminationEnabled() {
+#ifdef STORM_HAVE_INTELTBB
+    // Rational functions share global caches that must not be accessed concurrently.
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() &&
+           !std::is_same<ValueType, storm::RationalFunction>::value;
+#else
+    return false;
+#endif
+}
+
+template<typename SparseDtmcModelType>
+void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performIndependentSccElimination(
+    std::vector<storm::storage::BitVector> const& sccs, std::vector<storm::storage::BitVector> const& entryStates,
+    storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
+    std::vector<ValueType>& values, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly,
+    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    // Eliminating a state whose predecessors all belong to its SCC only changes the rows of the SCC states and the backward rows of their successors.
+    // Each SCC is therefore treated on a slice that consists of copies of these rows (restricted to predecessors within the SCC). Local indices of a
+    // slice refer to positions in the sorted vector of the states of the slice. The slices are written back after all SCCs were treated.
+    struct Slice {
+        std::vector<storm::storage::sparse::state_type> states;
+        storm::storage::FlexibleSparseMatrix<ValueType> transitionMatrix;
+        storm::storage::FlexibleSparseMatrix<ValueType> backwardTransitions;
+        std::vector<ValueType> values;
+    };
+    std::vector<Slice> slices(sccs.size());
+
+    auto eliminateSccStates = [&](uint64_t sccIndex) {
+        storm::storage::BitVector const& scc = sccs[sccIndex];
+        Slice& slice = slices[sccIndex];
+        storm::storage::BitVector sliceStates = scc;
+        for (auto state : scc) {
+            for (auto const& entry : transitionMatrix.getRow(state)) {
+                sliceStates.set(entry.getColumn());
+            }
+        }
+        slice.states.assign(sliceStates.begin(), sliceStates.end());
+        auto toLocalState = [&slice](storm::storage::sparse::state_type state) -> storm::storage::sparse::state_type {
+            return std::lower_bound(slice.states.begin(), slice.states.end(), state) - slice.states.begin();
+        };
+
+        uint64_t numberOfLocalStates = slice.states.size();
+        slice.transitionMatrix = storm::storage::FlexibleSparseMatrix<ValueType>(numberOfLocalStates);
+        slice.backwardTransitions = storm::storage::FlexibleSparseMatrix<ValueType>(numberOfLocalStates);
+        slice.values.reserve(numberOfLocalStates);
+        storm::storage::BitVector localStatesToEliminate(numberOfLocalStates);
+        storm::storage::BitVector localInitialStates(numberOfLocalStates);
+        boost::optional<std::vector<uint_fast64_t>> localDistanceBasedPriorities;
+        if (distanceBasedPriorities) {
+            localDistanceBasedPriorities = std::vector<uint_fast64_t>(numberOfLocalStates);
+        }
+        for (uint64_t localState = 0; localState < numberOfLocalStates; ++localState) {
+            storm::storage::sparse::state_type state = slice.states[localState];
+            slice.values.push_back(values[state]);
+            localInitialStates.set(localState, initialStates.get(state));
+            if (localDistanceBasedPriorities) {
+                localDistanceBasedPriorities.get()[localState] = distanceBasedPriorities.get()[state];
+            }
+            if (scc.get(state)) {
+                localStatesToEliminate.set(localState, !entryStates[sccIndex].get(state));
+                auto const& row = transitionMatrix.getRow(state);
+                auto& localRow = slice.transitionMatrix.getRow(localState);
+                localRow.reserve(row.size());
+                for (auto const& entry : row) {
+                    localRow.emplace_back(toLocalState(entry.getColumn()), entry.getValue());
+                }
+            }
+            for (auto const& entry : backwardTransitions.getRow(state)) {
+                if (scc.get(entry.getColumn())) {
+                    slice.backwardTransitions.getRow(localState).emplace_back(toLocalState(entry.getColumn()), entry.getValue());
+                }
+            }
+        }
+
+        std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(localDistanceBasedPriorities, slice.transitionMatrix,
+                                                                                       slice.backwardTransitions, slice.values, localStatesToEliminate);
+        performPrioritizedStateElimination(statePriorities, slice.transitionMatrix, slice.backwardTransitions, slice.values, localInitialStates,
+                                           computeResultsForInitialStatesOnly);
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (isConcurrentSccEliminationEnabled()) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccs.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t sccIndex = range.begin(); sccIndex < range.end(); ++sccIndex) {
+                eliminateSccStates(sccIndex);
+            }
+        });
+    } else {
+        for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+            eliminateSccStates(sccIndex);
+        }
+    }
+#else
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        eliminateSccStates(sccIndex);
+    }
+#endif
+
+    // Write back the slices. As the SCCs are disjoint, the slices do not overlap in the rows of the SCC states and in the predecessors within the SCCs.
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        storm::storage::BitVector const& scc = sccs[sccIndex];
+        Slice& slice = slices[sccIndex];
+        for (uint64_t localState = 0; localState < slice.states.size(); ++localState) {
+            storm::storage::sparse::state_type state = slice.states[localState];
+            if (scc.get(state)) {
+                values[state] = std::move(slice.values[localState]);
+                auto& row = transitionMatrix.getRow(state);
+                row.clear();
+                for (auto const& entry : slice.transitionMatrix.getRow(localState)) {
+                    row.emplace_back(slice.states[entry.getColumn()], entry.getValue());
+                }
+                row.shrink_to_fit();
+            }
+
+            // Replace the predecessors within the SCC by the ones of the slice and keep the order of the columns.
+            auto& backwardRow = backwardTransitions.getRow(state);
+            auto const& localBackwardRow = slice.backwardTransitions.getRow(localState);
+            typename storm::storage::FlexibleSparseMatrix<ValueType>::row_type newBackwardRow;
+            newBackwardRow.reserve(backwardRow.size() + localBackwardRow.size());
+            auto localIt = localBackwardRow.begin();
+            for (auto const& entry : backwardRow) {
+                if (scc.get(entry.getColumn())) {
+                    continue;
+                }
+                for (; localIt != localBackwardRow.end() && slice.states[localIt->getColumn()] < entry.getColumn(); ++localIt) {
+                    newBackwardRow.emplace_back(slice.states[localIt->getColumn()], localIt->getValue());
+                }
+                newBackwardRow.push_back(entry);
+            }
+            for (; localIt != localBackwardRow.end(); ++localIt) {
+                newBackwardRow.emplace_back(slice.states[localIt->getColumn()], localIt->getValue());
+            }
+            newBackwardRow.shrink_to_fit();
+            backwardRow = std::move(newBackwardRow);
+        }
+        // Release the memory of the slice right away.
+        slice = Slice();
+    }
+}
+
 template<typename SparseDtmcModelType>
 bool SparseDtmcEliminationModelChecker<SparseDtmcModelType>::checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                                              storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions) {
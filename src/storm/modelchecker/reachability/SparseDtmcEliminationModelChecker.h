@@ -117,6 +117,29 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                   bool computeResultsForInitialStatesOnly,
                                   boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities = boost::none);
 
+    /*!
+     * Retrieves whether independent SCCs are to be eliminated separately, see performIndependentSccElimination.
+     */
+    static bool isIndependentSccEliminationEnabled();
+
+    /*!
+     * Retrieves whether independent SCCs are to be eliminated concurrently.
+     */
+    static bool isConcurrentSccEliminationEnabled();
+
+    /*!
+     * Eliminates all states of the given SCCs except for their entry states. Each SCC is treated on a copy of the rows that are affected by the
+     * elimination of its states, such that the SCCs can be treated concurrently if isConcurrentSccEliminationEnabled holds.
+     *
+     * @param sccs The SCCs, which must be pairwise disjoint.
+     * @param entryStates For each SCC, the states of the SCC that have a predecessor outside of the SCC.
+     */
+    static void performIndependentSccElimination(std::vector<storm::storage::BitVector> const& sccs, std::vector<storm::storage::BitVector> const& entryStates,
+                                                storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
+                                                storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values,
+                                                storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly,
+                                                boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities);
+
     static bool checkConsistent(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                 storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions);
 };
@@ -10,13 +10,17 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
+#include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
 
 #include "storm/logic/FragmentSpecification.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/solver/SolveGoal.h"
+
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
 namespace modelchecker {
@@ -55,6 +59,72 @@ std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<SparseSmgModelType>::che
     STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Only game formulas with Operatorformulas as subformula are supported.");
 }
 
+template<typename SparseSmgModelType>
+template<typename FormulaType>
+storm::storage::BitVector SparseSmgRpatlModelChecker<SparseSmgModelType>::getStatesOfCoalition(CheckTask<FormulaType, ValueType> const& checkTask) const {
+    STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+                    "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+    STORM_LOG_THROW(checkTask.isPlayerCoalitionSet(), storm::exceptions::InvalidPropertyException, "No player coalition was set.");
+    STORM_LOG_THROW(!checkTask.isProduceSchedulersSet(), storm::exceptions::NotSupportedException,
+                    "Computing schedulers is not supported for stochastic multiplayer games.");
+    return this->getModel().computeStatesOfCoalition(checkTask.getPlayerCoalition());
+}
+
+template<typename SparseSmgModelType>
+std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<SparseSmgModelType>::computeNextProbabilities(
+    Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
+    storm::logic::NextFormula const& pathFormula = checkTask.getFormula();
+    storm::storage::BitVector statesOfCoalition = getStatesOfCoalition(checkTask);
+    std::unique_ptr<CheckResult> subResultPointer = this->check(env, pathFormula.getSubformula());
+    ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
+    std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeNextProbabilities(
+        env, checkTask.getOptimizationDirection(), this->getModel().getTransitionMatrix(), subResult.getTruthValuesVector(), statesOfCoalition);
+    return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+}
+
+template<typename SparseSmgModelType>
+std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<SparseSmgModelType>::computeUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    storm::logic::UntilFormula const& pathFormula = checkTask.getFormula();
+    storm::storage::BitVector statesOfCoalition = getStatesOfCoalition(checkTask);
+    std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+    std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+    ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+    ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+    std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(
+        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
+        statesOfCoalition);
+    return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+}
+
+template<typename SparseSmgModelType>
+std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<SparseSmgModelType>::computeGloballyProbabilities(
+    Environment const& env, CheckTask<storm::logic::GloballyFormula, ValueType> const& checkTask) {
+    storm::logic::GloballyFormula const& pathFormula = checkTask.getFormula();
+    storm::storage::BitVector statesOfCoalition = getStatesOfCoalition(checkTask);
+    std::unique_ptr<CheckResult> subResultPointer = this->check(env, pathFormula.getSubformula());
+    ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
+    std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeGloballyProbabilities(
+        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), statesOfCoalition);
+    return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+}
+
+template<typename SparseSmgModelType>
+std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<SparseSmgModelType>::computeReachabilityRewards(
+    Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) {
+    storm::logic::EventuallyFormula const& eventuallyFormula = checkTask.getFormula();
+    storm::storage::BitVector statesOfCoalition = getStatesOfCoalition(checkTask);
+    std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
+    ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
+    auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+    std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeReachabilityRewards(
+        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), statesOfCoalition);
+    return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+}
+
 template<typename SparseSmgModelType>
 std::unique_ptr<CheckResult> SparseSmgRpatlModelChecker<SparseSmgModelType>::computeLongRunAverageProbabilities(
     Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
@@ -28,11 +28,27 @@ class SparseSmgRpatlModelChecker : public SparsePropositionalModelChecker<Sparse
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
     virtual std::unique_ptr<CheckResult> checkGameFormula(Environment const& env, CheckTask<storm::logic::GameFormula, ValueType> const& checkTask) override;
 
+    virtual std::unique_ptr<CheckResult> computeNextProbabilities(Environment const& env,
+                                                                  CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeGloballyProbabilities(Environment const& env,
+                                                                      CheckTask<storm::logic::GloballyFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                    CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
+
     virtual std::unique_ptr<CheckResult> computeLongRunAverageProbabilities(Environment const& env,
                                                                             CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(
         Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
         CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
+
+   private:
+    /*!
+     * Checks that the given task can be handled by the game helpers and returns the states of the coalition set in the task.
+     */
+    template<typename FormulaType>
+    storm::storage::BitVector getStatesOfCoalition(CheckTask<FormulaType, ValueType> const& checkTask) const;
 };
 }  // namespace modelchecker
 }  // namespace storm
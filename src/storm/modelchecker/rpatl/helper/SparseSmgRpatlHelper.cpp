@@ -0,0 +1,241 @@
+#include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+std::vector<ValueType> SparseSmgRpatlHelper<ValueType>::computeNextProbabilities(Environment const&, storm::solver::OptimizationDirection dir,
+                                                                                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                 storm::storage::BitVector const& nextStates,
+                                                                                 storm::storage::BitVector const& statesOfCoalition) {
+    std::vector<ValueType> result;
+    result.reserve(transitionMatrix.getRowGroupCount());
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+        bool const maximizeState = storm::solver::maximize(statesOfCoalition.get(state) ? dir : storm::solver::invert(dir));
+        ValueType bestValue = transitionMatrix.getConstrainedRowSum(rowGroupIndices[state], nextStates);
+        for (uint64_t row = rowGroupIndices[state] + 1; row < rowGroupIndices[state + 1]; ++row) {
+            ValueType rowValue = transitionMatrix.getConstrainedRowSum(row, nextStates);
+            if (maximizeState ? rowValue > bestValue : rowValue < bestValue) {
+                bestValue = std::move(rowValue);
+            }
+        }
+        result.push_back(std::move(bestValue));
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    bool qualitative, storm::storage::BitVector const& statesOfCoalition) {
+    // The player that maximizes the probability is the one that tries to reach the psi states.
+    storm::storage::BitVector maximizingStates = goal.minimize() ? ~statesOfCoalition : statesOfCoalition;
+    storm::storage::BitVector statesWithProbability0 =
+        ~computeStatesWithProbabilityGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates, maximizingStates);
+    storm::storage::BitVector statesWithProbability1 =
+        computeStatesWithProbability1(transitionMatrix, backwardTransitions, phiStates, psiStates, maximizingStates);
+    storm::storage::BitVector maybeStates = ~(statesWithProbability0 | statesWithProbability1);
+    STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
+                                     << statesWithProbability0.getNumberOfSetBits() << " with probability 0 (" << maybeStates.getNumberOfSetBits()
+                                     << " states remaining).");
+
+    std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues(result, statesWithProbability1, storm::utility::one<ValueType>());
+    if (qualitative) {
+        // Set the values for all maybe-states to 0.5 to indicate that their probability values are neither 0 nor 1.
+        storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, storm::utility::convertNumber<ValueType>(0.5));
+    } else if (!maybeStates.empty()) {
+        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
+        std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, statesWithProbability1);
+        storm::storage::BitVector maybeStatesOfCoalition = statesOfCoalition % maybeStates;
+        std::vector<ValueType> x(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+        internal::GameViHelper<ValueType> viHelper(submatrix, maybeStatesOfCoalition);
+        viHelper.performValueIteration(env, goal.direction(), x, b);
+        storm::utility::vector::setVectorValues(result, maybeStates, x);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseSmgRpatlHelper<ValueType>::computeGloballyProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative,
+    storm::storage::BitVector const& statesOfCoalition) {
+    // The coalition maximizes the probability to always stay in psi states iff it minimizes the probability to eventually leave them.
+    goal.oneMinus();
+    std::vector<ValueType> result =
+        computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions,
+                                  storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), ~psiStates, qualitative, statesOfCoalition);
+    for (auto& element : result) {
+        element = storm::utility::one<ValueType>() - element;
+    }
+    return result;
+}
+
+template<typename ValueType>
+template<typename RewardModelType>
+std::vector<ValueType> SparseSmgRpatlHelper<ValueType>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+    bool qualitative, storm::storage::BitVector const& statesOfCoalition) {
+    STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::NotSupportedException, "The reward model is empty.");
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    storm::storage::BitVector const allStates(numberOfStates, true);
+
+    // The player that minimizes the reward is the one that tries to reach the target states. If it can not enforce this almost surely, the reward is
+    // infinite.
+    storm::storage::BitVector minimizingStates = goal.minimize() ? statesOfCoalition : ~statesOfCoalition;
+    storm::storage::BitVector finiteStates = computeStatesWithProbability1(transitionMatrix, backwardTransitions, allStates, targetStates, minimizingStates);
+    storm::storage::BitVector maybeStates = finiteStates & ~targetStates;
+    STORM_LOG_INFO("Preprocessing: " << (numberOfStates - finiteStates.getNumberOfSetBits()) << " states with reward infinity, "
+                                     << targetStates.getNumberOfSetBits() << " target states (" << maybeStates.getNumberOfSetBits() << " states remaining).");
+
+    std::vector<ValueType> result(numberOfStates, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues(result, ~finiteStates, storm::utility::infinity<ValueType>());
+    if (qualitative) {
+        // Set the values for all maybe-states to 1 to indicate that their reward values are neither 0 nor infinity.
+        storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, storm::utility::one<ValueType>());
+    } else if (!maybeStates.empty()) {
+        // Choices that leave the finite states are never taken by the minimizing player. The maximizing player has no such choices in the finite states.
+        storm::storage::BitVector selectedChoices = transitionMatrix.getRowFilter(maybeStates, finiteStates);
+        std::vector<ValueType> b = storm::utility::vector::filterVector(rewardModel.getTotalRewardVector(transitionMatrix), selectedChoices);
+
+        // Value iteration from below converges to the least fixpoint, which only coincides with the expected rewards if the play can not stay in the maybe
+        // states forever without collecting reward. This is only possible within an end component of the zero-reward sub-game. As the maximizing player
+        // can not avoid the target states on its own, the minimizing player takes part in every such end component.
+        storm::storage::BitVector zeroRewardChoices = rewardModel.getChoicesWithZeroReward(transitionMatrix) & selectedChoices;
+        if (!zeroRewardChoices.empty()) {
+            storm::storage::MaximalEndComponentDecomposition<ValueType> zeroRewardEndComponents(transitionMatrix, backwardTransitions, maybeStates,
+                                                                                              zeroRewardChoices);
+            STORM_LOG_THROW(zeroRewardEndComponents.empty(), storm::exceptions::NotSupportedException,
+                            "The play can stay in " << zeroRewardEndComponents.size()
+                                                    << " end component(s) of non-target states without collecting reward. Such games are not supported.");
+        }
+
+        storm::storage::SparseMatrix<ValueType> submatrix =
+            transitionMatrix.restrictRows(selectedChoices, true).getSubmatrix(true, maybeStates, maybeStates, false);
+        storm::storage::BitVector maybeStatesOfCoalition = statesOfCoalition % maybeStates;
+        std::vector<ValueType> x(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+        internal::GameViHelper<ValueType> viHelper(submatrix, maybeStatesOfCoalition);
+        viHelper.performValueIteration(env, goal.direction(), x, b);
+        storm::utility::vector::setVectorValues(result, maybeStates, x);
+    }
+    return result;
+}
+
+template<typename ValueType>
+storm::storage::BitVector SparseSmgRpatlHelper<ValueType>::computeStatesWithProbabilityGreater0(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& reachingPlayerStates) {
+    return computePositiveAttractor(transitionMatrix, backwardTransitions, phiStates, psiStates, reachingPlayerStates);
+}
+
+template<typename ValueType>
+storm::storage::BitVector SparseSmgRpatlHelper<ValueType>::computeStatesWithProbability1(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& reachingPlayerStates) {
+    // Repeatedly remove the states from which the reaching player can not enforce to reach a psi state with positive probability without risking to
+    // leave the current candidate set.
+    storm::storage::BitVector candidateStates = phiStates | psiStates;
+    while (true) {
+        storm::storage::BitVector newCandidateStates =
+            computePositiveAttractor(transitionMatrix, backwardTransitions, candidateStates, psiStates, reachingPlayerStates, &candidateStates);
+        if (newCandidateStates == candidateStates) {
+            return candidateStates;
+        }
+        candidateStates = std::move(newCandidateStates);
+    }
+}
+
+template<typename ValueType>
+storm::storage::BitVector SparseSmgRpatlHelper<ValueType>::computePositiveAttractor(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, storm::storage::BitVector const& reachingPlayerStates,
+    storm::storage::BitVector const* safeStates) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+    // Determine the choices that may be taken and the states that may be added to the attractor.
+    storm::storage::BitVector candidateStates = constraintStates & ~targetStates;
+    storm::storage::BitVector allowedChoices(transitionMatrix.getRowCount(), true);
+    if (safeStates) {
+        allowedChoices = transitionMatrix.getRowFilter(storm::storage::BitVector(numberOfStates, true), *safeStates);
+        for (auto state : candidateStates) {
+            if (!reachingPlayerStates.get(state) && allowedChoices.getNextUnsetIndex(rowGroupIndices[state]) < rowGroupIndices[state + 1]) {
+                candidateStates.set(state, false);
+            }
+        }
+    }
+
+    // For the states of the opponent, we count the choices that do not yet have a successor in the attractor.
+    std::vector<uint64_t> remainingChoices(numberOfStates, 0);
+    for (auto state : candidateStates) {
+        remainingChoices[state] = rowGroupIndices[state + 1] - rowGroupIndices[state];
+    }
+    storm::storage::BitVector choicesWithSuccessorInAttractor(transitionMatrix.getRowCount(), false);
+
+    storm::storage::BitVector result = targetStates;
+    std::vector<uint64_t> stack(targetStates.begin(), targetStates.end());
+    while (!stack.empty()) {
+        uint64_t currentState = stack.back();
+        stack.pop_back();
+        for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+            uint64_t const predecessor = predecessorEntry.getColumn();
+            if (!candidateStates.get(predecessor) || result.get(predecessor) || storm::utility::isZero(predecessorEntry.getValue())) {
+                continue;
+            }
+            bool const isReachingPlayerState = reachingPlayerStates.get(predecessor);
+            bool addPredecessor = false;
+            for (uint64_t row = rowGroupIndices[predecessor]; row < rowGroupIndices[predecessor + 1] && !addPredecessor; ++row) {
+                if (!allowedChoices.get(row) || choicesWithSuccessorInAttractor.get(row)) {
+                    continue;
+                }
+                for (auto const& entry : transitionMatrix.getRow(row)) {
+                    if (entry.getColumn() == currentState && !storm::utility::isZero(entry.getValue())) {
+                        choicesWithSuccessorInAttractor.set(row, true);
+                        addPredecessor = isReachingPlayerState || --remainingChoices[predecessor] == 0;
+                        break;
+                    }
+                }
+            }
+            if (addPredecessor) {
+                result.set(predecessor, true);
+                stack.push_back(predecessor);
+            }
+        }
+    }
+    return result;
+}
+
+template class SparseSmgRpatlHelper<double>;
+template std::vector<double> SparseSmgRpatlHelper<double>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel,
+    storm::storage::BitVector const& targetStates, bool qualitative, storm::storage::BitVector const& statesOfCoalition);
+
+#ifdef STORM_HAVE_CARL
+template class SparseSmgRpatlHelper<storm::RationalNumber>;
+template std::vector<storm::RationalNumber> SparseSmgRpatlHelper<storm::RationalNumber>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+    storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative,
+    storm::storage::BitVector const& statesOfCoalition);
+#endif
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolveGoal.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Helper class for model checking rPATL reachability and reward objectives on (turn-based) stochastic multiplayer games.
+ * The coalition optimizes in the direction of the given goal, all other players optimize in the opposite direction.
+ * After a graph-based precomputation, the values of the remaining states are approximated with value iteration (see internal::GameViHelper).
+ */
+template<typename ValueType>
+class SparseSmgRpatlHelper {
+   public:
+    static std::vector<ValueType> computeNextProbabilities(Environment const& env, storm::solver::OptimizationDirection dir,
+                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                           storm::storage::BitVector const& nextStates, storm::storage::BitVector const& statesOfCoalition);
+
+    static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                            storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                            bool qualitative, storm::storage::BitVector const& statesOfCoalition);
+
+    static std::vector<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                               storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                               storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                               storm::storage::BitVector const& psiStates, bool qualitative,
+                                                               storm::storage::BitVector const& statesOfCoalition);
+
+    /*!
+     * Computes the expected rewards that are collected until reaching a target state. States from which the minimizing player can not enforce to reach a
+     * target state almost surely get value infinity. Games with an end component of non-target states in which no reward is collected are not supported.
+     */
+    template<typename RewardModelType>
+    static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                             RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+                                                             bool qualitative, storm::storage::BitVector const& statesOfCoalition);
+
+    /*!
+     * Computes the states from which the reaching player can enforce to reach a psi state with positive probability while only visiting phi states.
+     *
+     * @param reachingPlayerStates The states that are controlled by the reaching player. All other states are controlled by its opponent.
+     */
+    static storm::storage::BitVector computeStatesWithProbabilityGreater0(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                         storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                         storm::storage::BitVector const& reachingPlayerStates);
+
+    /*!
+     * Computes the states from which the reaching player can enforce to reach a psi state almost surely while only visiting phi states.
+     *
+     * @param reachingPlayerStates The states that are controlled by the reaching player. All other states are controlled by its opponent.
+     */
+    static storm::storage::BitVector computeStatesWithProbability1(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                  storm::storage::BitVector const& reachingPlayerStates);
+
+   private:
+    /*!
+     * Computes the states from which the reaching player can enforce to reach a target state with positive probability while only visiting constraint
+     * states. If safe states are given, only choices whose successors are all safe are considered and the states of the opponent are only included if all
+     * their choices have this property.
+     */
+    static storm::storage::BitVector computePositiveAttractor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                             storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
+                                                             storm::storage::BitVector const& reachingPlayerStates,
+                                                             storm::storage::BitVector const* safeStates = nullptr);
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
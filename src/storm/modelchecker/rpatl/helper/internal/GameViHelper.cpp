@@ -0,0 +1,150 @@
+#include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+
+#include <atomic>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+template<typename ValueType>
+GameViHelper<ValueType>::GameViHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& statesOfCoalition)
+    : transitionMatrix(transitionMatrix), statesOfCoalition(statesOfCoalition) {
+    STORM_LOG_ASSERT(transitionMatrix.getRowGroupCount() == statesOfCoalition.size(), "Dimension mismatch of transition matrix and coalition states.");
+    // Only floating point values are processed concurrently as the arithmetic of exact number types is not necessarily thread-safe.
+    useIntelTbb = std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifndef STORM_HAVE_INTELTBB
+    if (useIntelTbb) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        useIntelTbb = false;
+    }
+#endif
+}
+
+template<typename ValueType>
+storm::solver::SolverStatus GameViHelper<ValueType>::performValueIteration(Environment const& env, storm::solver::OptimizationDirection dir,
+                                                                           std::vector<ValueType>& x, std::vector<ValueType> const& b) {
+    STORM_LOG_ASSERT(x.size() == transitionMatrix.getRowGroupCount(), "Unexpected size of the value vector.");
+    STORM_LOG_ASSERT(b.size() == transitionMatrix.getRowCount(), "Unexpected size of the offset vector.");
+    auto const& gameEnv = env.solver().game();
+    ValueType const precision = storm::utility::convertNumber<ValueType>(gameEnv.getPrecision());
+    bool const relative = gameEnv.getRelativeTerminationCriterion();
+    bool const optimistic = gameEnv.isOptimisticBoundsSet() || env.solver().isForceSoundness();
+    uint64_t const maxIterations = gameEnv.getMaximalNumberOfIterations();
+
+    // Make sure that lazily created data is available before the row groups are processed concurrently.
+    transitionMatrix.getRowGroupIndices();
+    auxiliaryVector.resize(x.size());
+
+    // The precision that is used to detect convergence of the lower bound. It is decreased whenever the guessed upper bound turns out to be not inductive.
+    ValueType iterationPrecision = precision;
+    auto hasConverged = [&relative, &iterationPrecision](ValueType const& oldValue, ValueType const& newValue) {
+        ValueType difference = storm::utility::abs<ValueType>(newValue - oldValue);
+        return relative ? difference <= iterationPrecision * storm::utility::abs<ValueType>(newValue) : difference <= iterationPrecision;
+    };
+    auto isNotIncreased = [](ValueType const& oldValue, ValueType const& newValue) { return newValue <= oldValue; };
+
+    uint64_t iterations = 0;
+    storm::solver::SolverStatus status = storm::solver::SolverStatus::InProgress;
+    while (status == storm::solver::SolverStatus::InProgress) {
+        bool converged = false;
+        while (!converged) {
+            if (iterations >= maxIterations) {
+                status = storm::solver::SolverStatus::MaximalIterationsExceeded;
+                break;
+            } else if (storm::utility::resources::isTerminate()) {
+                status = storm::solver::SolverStatus::Aborted;
+                break;
+            }
+            converged = performIteration(dir, x, auxiliaryVector, b, hasConverged);
+            std::swap(x, auxiliaryVector);
+            ++iterations;
+        }
+        if (status != storm::solver::SolverStatus::InProgress) {
+            break;
+        } else if (!optimistic) {
+            status = storm::solver::SolverStatus::Converged;
+            break;
+        }
+
+        // Guess an upper bound and check whether it is inductive. If so, it is an upper bound of the least fixpoint.
+        upperBound.resize(x.size());
+        for (uint64_t group = 0; group < x.size(); ++group) {
+            upperBound[group] = relative ? x[group] * (storm::utility::one<ValueType>() + precision) : x[group] + precision;
+        }
+        ++iterations;
+        if (performIteration(dir, upperBound, auxiliaryVector, b, isNotIncreased)) {
+            status = storm::solver::SolverStatus::Converged;
+        } else {
+            iterationPrecision /= storm::utility::convertNumber<ValueType>(2.0);
+            STORM_LOG_TRACE("Guessed upper bound is not inductive. Decreasing the iteration precision to "
+                            << storm::utility::convertNumber<double>(iterationPrecision) << ".");
+        }
+    }
+
+    STORM_LOG_INFO("Game value iteration terminated with status " << status << " after " << iterations << " iterations.");
+    STORM_LOG_WARN_COND(status == storm::solver::SolverStatus::Converged,
+                        "Game value iteration did not converge within " << iterations << " iterations. The result might be inaccurate.");
+    return status;
+}
+
+template<typename ValueType>
+template<typename CheckGroup>
+bool GameViHelper<ValueType>::performIteration(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& xOld, std::vector<ValueType>& xNew,
+                                               std::vector<ValueType> const& b, CheckGroup const& checkGroup) const {
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    auto processGroups = [&](uint64_t firstGroup, uint64_t lastGroup) {
+        bool allGroupsChecked = true;
+        for (uint64_t group = firstGroup; group < lastGroup; ++group) {
+            bool const maximizeGroup = storm::solver::maximize(statesOfCoalition.get(group) ? dir : storm::solver::invert(dir));
+            uint64_t row = rowGroupIndices[group];
+            uint64_t const rowEnd = rowGroupIndices[group + 1];
+            ValueType bestValue = b[row] + transitionMatrix.multiplyRowWithVector(row, xOld);
+            for (++row; row < rowEnd; ++row) {
+                ValueType rowValue = b[row] + transitionMatrix.multiplyRowWithVector(row, xOld);
+                if (maximizeGroup ? rowValue > bestValue : rowValue < bestValue) {
+                    bestValue = std::move(rowValue);
+                }
+            }
+            if (!checkGroup(xOld[group], bestValue)) {
+                allGroupsChecked = false;
+            }
+            xNew[group] = std::move(bestValue);
+        }
+        return allGroupsChecked;
+    };
+
+    if (useIntelTbb) {
+#ifdef STORM_HAVE_INTELTBB
+        std::atomic<bool> allGroupsChecked(true);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, xOld.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            if (!processGroups(range.begin(), range.end())) {
+                allGroupsChecked.store(false, std::memory_order_relaxed);
+            }
+        });
+        return allGroupsChecked.load();
+#endif
+    }
+    return processGroups(0, xOld.size());
+}
+
+template class GameViHelper<double>;
+#ifdef STORM_HAVE_CARL
+template class GameViHelper<storm::RationalNumber>;
+#endif
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+/*!
+ * Helper class that performs value iteration on (turn-based) stochastic multiplayer games.
+ * Each iteration is a single sweep over the row groups of the transition matrix, where the states of the coalition optimize in the given direction and
+ * all other states optimize in the opposite direction. If Intel TBB is enabled, the row groups of a sweep are processed concurrently.
+ * The iterations alternate between two buffers, so no memory is allocated while iterating.
+ *
+ * Optionally, the result is verified by guessing an upper bound close to the converged lower bound and checking that the upper bound is inductive, i.e.,
+ * that it is not increased by an iteration (optimistic value iteration). This is sound for least fixpoints, which makes the approach applicable to games
+ * without further treatment of end components.
+ */
+template<typename ValueType>
+class GameViHelper {
+   public:
+    /*!
+     * @param transitionMatrix The transition matrix of the game. Each row group corresponds to a state.
+     * @param statesOfCoalition The states that are controlled by the coalition (w.r.t. the row groups of the transition matrix).
+     */
+    GameViHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& statesOfCoalition);
+
+    /*!
+     * Approximates the least fixpoint of x = max/min(A*x + b), where the coalition optimizes in the given direction and the other players in the opposite
+     * direction.
+     *
+     * @param dir The optimization direction of the coalition.
+     * @param x The initial values which have to be a lower bound of the least fixpoint. Contains the result after the method returns.
+     * @param b The values that are added to each row.
+     * @return The status of the solver.
+     */
+    storm::solver::SolverStatus performValueIteration(Environment const& env, storm::solver::OptimizationDirection dir, std::vector<ValueType>& x,
+                                                      std::vector<ValueType> const& b);
+
+   private:
+    /*!
+     * Applies the game Bellman operator to xOld and writes the result to xNew.
+     *
+     * @param checkGroup Invoked with the old and the new value of each row group. The method returns true iff checkGroup returned true for all groups.
+     */
+    template<typename CheckGroup>
+    bool performIteration(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& xOld, std::vector<ValueType>& xNew,
+                          std::vector<ValueType> const& b, CheckGroup const& checkGroup) const;
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    storm::storage::BitVector const& statesOfCoalition;
+
+    /// Whether the sweeps are performed concurrently.
+    bool useIntelTbb;
+
+    /// The second buffer of the iterations and the buffer for the upper bound. Both are kept across calls.
+    std::vector<ValueType> auxiliaryVector;
+    std::vector<ValueType> upperBound;
+};
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -17,10 +17,11 @@ const std::string EliminationSettings::eliminationMethodOptionName = "method";
 const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
+const std::string EliminationSettings::independentSccsOptionName = "independentsccs";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "fillin"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.")
             .setIsAdvanced()
@@ -50,6 +51,11 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                     .setDefaultValueUnsignedInteger(20)
                     .build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, independentSccsOptionName, true,
+                                                   "Sets whether the hybrid technique eliminates independent SCCs separately. This is implied by --enable-tbb "
+                                                   "for non-parametric models, in which case the SCCs are eliminated concurrently.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, useDedicatedModelCheckerOptionName, true,
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
@@ -67,6 +73,15 @@ EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod
     }
 }
 
+void EliminationSettings::setEliminationMethod(std::string const& method) {
+    STORM_LOG_THROW(this->getOption(eliminationMethodOptionName).getArgumentByName("name").setFromStringValue(method),
+                    storm::exceptions::IllegalArgumentValueException, "Illegal elimination method '" << method << "'.");
+}
+
+std::string EliminationSettings::getEliminationMethodName() const {
+    return this->getOption(eliminationMethodOptionName).getArgumentByName("name").getValueAsString();
+}
+
 EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder() const {
     std::string eliminationOrderAsString = this->getOption(eliminationOrderOptionName).getArgumentByName("name").getValueAsString();
     if (eliminationOrderAsString == "fw") {
@@ -85,11 +100,22 @@ EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder()
         return EliminationOrder::DynamicPenalty;
     } else if (eliminationOrderAsString == "regex") {
         return EliminationOrder::RegularExpression;
+    } else if (eliminationOrderAsString == "fillin") {
+        return EliminationOrder::FillIn;
     } else {
         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
     }
 }
 
+void EliminationSettings::setEliminationOrder(std::string const& order) {
+    STORM_LOG_THROW(this->getOption(eliminationOrderOptionName).getArgumentByName("name").setFromStringValue(order),
+                    storm::exceptions::IllegalArgumentValueException, "Illegal elimination order '" << order << "'.");
+}
+
+std::string EliminationSettings::getEliminationOrderName() const {
+    return this->getOption(eliminationOrderOptionName).getArgumentByName("name").getValueAsString();
+}
+
 bool EliminationSettings::isEliminateEntryStatesLastSet() const {
     return this->getOption(entryStatesLastOptionName).getHasOptionBeenSet();
 }
@@ -98,6 +124,10 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
     return this->getOption(maximalSccSizeOptionName).getArgumentByName("maxsize").getValueAsUnsignedInteger();
 }
 
+bool EliminationSettings::isEliminateIndependentSccsSet() const {
+    return this->getOption(independentSccsOptionName).getHasOptionBeenSet();
+}
+
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
@@ -15,7 +15,7 @@ class EliminationSettings : public ModuleSettings {
     /*!
      * An enum that contains all available state elimination orders.
      */
-    enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+    enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression, FillIn };
 
     /*!
      * An enum that contains all available elimination methods.
@@ -34,6 +34,20 @@ class EliminationSettings : public ModuleSettings {
      */
     EliminationMethod getEliminationMethod() const;
 
+    /*!
+     * Sets the elimination method. This is only meant to be used for testing purposes.
+     *
+     * @param method The name of the elimination method as given on the command line.
+     */
+    void setEliminationMethod(std::string const& method);
+
+    /*!
+     * Retrieves the name of the selected elimination method as given on the command line.
+     *
+     * @return The name of the selected elimination method.
+     */
+    std::string getEliminationMethodName() const;
+
     /*!
      * Retrieves the selected elimination order.
      *
@@ -41,6 +55,20 @@ class EliminationSettings : public ModuleSettings {
      */
     EliminationOrder getEliminationOrder() const;
 
+    /*!
+     * Sets the elimination order. This is only meant to be used for testing purposes.
+     *
+     * @param order The name of the elimination order as given on the command line.
+     */
+    void setEliminationOrder(std::string const& order);
+
+    /*!
+     * Retrieves the name of the selected elimination order as given on the command line.
+     *
+     * @return The name of the selected elimination order.
+     */
+    std::string getEliminationOrderName() const;
+
     /*!
      * Retrieves whether the option to eliminate entry states in the very end is set.
      *
@@ -55,6 +83,13 @@ class EliminationSettings : public ModuleSettings {
      */
     uint_fast64_t getMaximalSccSize() const;
 
+    /*!
+     * Retrieves whether the hybrid elimination is to eliminate independent SCCs separately (and concurrently if Intel TBB is enabled).
+     *
+     * @return True iff the option is set.
+     */
+    bool isEliminateIndependentSccsSet() const;
+
     /*!
      * Retrieves whether the dedicated model checker is to be used instead of the general on.
      *
@@ -69,6 +104,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string eliminationOrderOptionName;
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
+    const static std::string independentSccsOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
 };
 
@@ -17,6 +17,7 @@ const std::string GameSolverSettings::maximalIterationsOptionName = "maxiter";
 const std::string GameSolverSettings::maximalIterationsOptionShortName = "i";
 const std::string GameSolverSettings::precisionOptionName = "precision";
 const std::string GameSolverSettings::absoluteOptionName = "absolute";
+const std::string GameSolverSettings::optimisticBoundsOptionName = "optimistic";
 
 GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration"};
@@ -47,6 +48,11 @@ GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether the relative or the absolute error is considered for detecting convergence.")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, optimisticBoundsOptionName, false,
+                                                   "Sets whether value iteration on stochastic games verifies its result with optimistic upper bounds.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::GameMethod GameSolverSettings::getGameSolvingMethod() const {
@@ -93,6 +99,10 @@ GameSolverSettings::ConvergenceCriterion GameSolverSettings::getConvergenceCrite
                                                                      : GameSolverSettings::ConvergenceCriterion::Relative;
 }
 
+bool GameSolverSettings::isOptimisticBoundsSet() const {
+    return this->getOption(optimisticBoundsOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -82,6 +82,13 @@ class GameSolverSettings : public ModuleSettings {
      */
     ConvergenceCriterion getConvergenceCriterion() const;
 
+    /*!
+     * Retrieves whether value iteration on stochastic multiplayer games shall verify its result via optimistic upper bounds.
+     *
+     * @return True iff optimistic bounds have been requested.
+     */
+    bool isOptimisticBoundsSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -91,6 +98,7 @@ class GameSolverSettings : public ModuleSettings {
     static const std::string maximalIterationsOptionShortName;
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
+    static const std::string optimisticBoundsOptionName;
 };
 
 }  // namespace modules
@@ -32,6 +32,8 @@ const std::string GeneralSettings::bisimulationOptionShortName = "bisim";
 const std::string GeneralSettings::parametricOptionName = "parametric";
 const std::string GeneralSettings::exactOptionName = "exact";
 const std::string GeneralSettings::soundOptionName = "sound";
+const std::string GeneralSettings::singlePrecisionMatrixOptionName = "single-precision-matrix";
+const std::string GeneralSettings::concurrentIntervalIterationOptionName = "concurrent-ii";
 
 GeneralSettings::GeneralSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -85,6 +87,21 @@ GeneralSettings::GeneralSettings() : ModuleSettings(moduleName) {
                              .build())
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, soundOptionName, false, "Sets whether to force sound model checking.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, singlePrecisionMatrixOptionName, false,
+                                                   "Sets whether interval iteration stores matrix entries in single precision. The results remain sound.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, concurrentIntervalIterationOptionName, false,
+                                                   "Sets whether interval iteration processes partitions of the row groups concurrently if Intel TBB is "
+                                                   "enabled. Each iteration then only reads the bounds of the previous one, which usually requires more "
+                                                   "iterations.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "minsize", "The minimal number of row groups of equation systems that are solved concurrently.")
+                                         .setDefaultValueUnsignedInteger(100000)
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 bool GeneralSettings::isHelpSet() const {
@@ -152,6 +169,18 @@ bool GeneralSettings::isSoundSet() const {
     return this->getOption(soundOptionName).getHasOptionBeenSet();
 }
 
+bool GeneralSettings::isSinglePrecisionMatrixSet() const {
+    return this->getOption(singlePrecisionMatrixOptionName).getHasOptionBeenSet();
+}
+
+bool GeneralSettings::isConcurrentIntervalIterationSet() const {
+    return this->getOption(concurrentIntervalIterationOptionName).getHasOptionBeenSet();
+}
+
+uint64_t GeneralSettings::getConcurrentIntervalIterationMinimalSize() const {
+    return this->getOption(concurrentIntervalIterationOptionName).getArgumentByName("minsize").getValueAsUnsignedInteger();
+}
+
 void GeneralSettings::finalize() {
     // Intentionally left empty.
 }
@@ -123,6 +123,27 @@ class GeneralSettings : public ModuleSettings {
      */
     bool isSoundSet() const;
 
+    /*!
+     * Retrieves whether the option enabling single precision matrix entries is set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSinglePrecisionMatrixSet() const;
+
+    /*!
+     * Retrieves whether interval iteration is to process partitions of the row groups concurrently.
+     *
+     * @return True iff the option was set.
+     */
+    bool isConcurrentIntervalIterationSet() const;
+
+    /*!
+     * Retrieves the minimal number of row groups of equation systems that interval iteration solves concurrently.
+     *
+     * @return The minimal number of row groups.
+     */
+    uint64_t getConcurrentIntervalIterationMinimalSize() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -149,6 +170,8 @@ class GeneralSettings : public ModuleSettings {
     static const std::string parametricOptionName;
     static const std::string exactOptionName;
     static const std::string soundOptionName;
+    static const std::string singlePrecisionMatrixOptionName;
+    static const std::string concurrentIntervalIterationOptionName;
 };
 
 }  // namespace modules
@@ -95,6 +95,11 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceUniqueSolutionRequirementSet() const;
 
+    /*!
+     * @return if value iteration should prioritize the updates of states whose successors changed.
+     */
+    bool isPrioritizedValueIterationSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
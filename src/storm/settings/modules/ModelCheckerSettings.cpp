@@ -2,6 +2,7 @@
 
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingMemento.h"
@@ -14,6 +15,8 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::parallelPropertiesOptionName = "parallel-properties";
+const std::string ModelCheckerSettings::warmStartOptionName = "warmstart";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +30,24 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelPropertiesOptionName, false,
+                                                   "If set, the properties are checked concurrently on the sparse model.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of properties checked at once.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, warmStartOptionName, false,
+                                                   "If set, converged solutions of previously checked properties are used as initial values for later "
+                                                   "properties with the same target states. This may change the results of solution methods that are not "
+                                                   "sound.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("solutions", "The maximal number of stored solutions.")
+                                         .setDefaultValueUnsignedInteger(4)
+                                         .makeOptional()
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +62,22 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isParallelPropertiesSet() const {
+    return this->getOption(parallelPropertiesOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfParallelProperties() const {
+    return this->getOption(parallelPropertiesOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isWarmStartSet() const {
+    return this->getOption(warmStartOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getMaximalNumberOfWarmStartSolutions() const {
+    return this->getOption(warmStartOptionName).getArgumentByName("solutions").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
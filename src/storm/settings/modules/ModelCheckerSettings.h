@@ -35,6 +35,26 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether the properties are to be checked concurrently.
+     */
+    bool isParallelPropertiesSet() const;
+
+    /*!
+     * Retrieves the number of properties that are checked concurrently.
+     */
+    uint64_t getNumberOfParallelProperties() const;
+
+    /*!
+     * Retrieves whether solutions of previously checked properties are to be used as initial values for later properties.
+     */
+    bool isWarmStartSet() const;
+
+    /*!
+     * Retrieves the maximal number of solutions that are stored for warm starts.
+     */
+    uint64_t getMaximalNumberOfWarmStartSolutions() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +62,8 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string parallelPropertiesOptionName;
+    static const std::string warmStartOptionName;
 };
 
 }  // namespace modules
@@ -66,6 +66,13 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     uint_fast64_t getMaxSteps() const;
 
+    /*!
+     * Retrieves the number of weight vectors that are checked concurrently in each refinement step of the Pareto curve approximation algorithm.
+     *
+     * @return the number of weight vectors per refinement step.
+     */
+    uint_fast64_t getWeightVectorBatchSize() const;
+
     /*!
      * Retrieves whether a scheduler restriction has been set.
      */
@@ -140,6 +147,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string exportPlotOptionName;
     const static std::string precisionOptionName;
     const static std::string maxStepsOptionName;
+    const static std::string weightVectorBatchSizeOptionName;
     const static std::string schedulerRestrictionOptionName;
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
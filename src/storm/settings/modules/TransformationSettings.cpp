@@ -16,6 +16,7 @@ const std::string TransformationSettings::chainEliminationOptionName = "eliminat
 const std::string TransformationSettings::labelBehaviorOptionName = "ec-label-behavior";
 const std::string TransformationSettings::toNondetOptionName = "to-nondet";
 const std::string TransformationSettings::toDiscreteTimeOptionName = "to-discrete";
+const std::string TransformationSettings::reorderOptionName = "reorder";
 
 TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, chainEliminationOptionName, false,
@@ -46,6 +47,20 @@ TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
                                                    "If set, CTMCs/MAs are converted to DTMCs/MDPs (which might or might not preserve the provided properties).")
                         .setIsAdvanced()
                         .build());
+    std::vector<std::string> stateOrders = {"bfs", "rcm", "scc"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, reorderOptionName, false,
+                                                   "If set, the states of sparse models are renumbered before model checking to improve memory locality. All "
+                                                   "outputs refer to the original state indices.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "order",
+                                         "The order of the states. 'bfs' explores from the initial states, 'rcm' uses the reverse Cuthill-McKee order, 'scc' "
+                                         "sorts the SCCs topologically.")
+                                         .setDefaultValueString("rcm")
+                                         .makeOptional()
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stateOrders))
+                                         .build())
+                        .build());
 }
 
 bool TransformationSettings::isChainEliminationSet() const {
@@ -73,6 +88,14 @@ bool TransformationSettings::isToDiscreteTimeModelSet() const {
     return this->getOption(toDiscreteTimeOptionName).getHasOptionBeenSet();
 }
 
+bool TransformationSettings::isReorderStatesSet() const {
+    return this->getOption(reorderOptionName).getHasOptionBeenSet();
+}
+
+storm::transformer::StateOrder TransformationSettings::getStateOrder() const {
+    return storm::transformer::stateOrderFromString(this->getOption(reorderOptionName).getArgumentByName("order").getValueAsString());
+}
+
 bool TransformationSettings::check() const {
     // Ensure that labeling preservation is only set if chain elimination is set
     STORM_LOG_THROW(isChainEliminationSet() || !this->getOption(labelBehaviorOptionName).getHasOptionBeenSet(), storm::exceptions::InvalidSettingsException,
@@ -43,6 +43,16 @@ class TransformationSettings : public ModuleSettings {
      */
     bool isToDiscreteTimeModelSet() const;
 
+    /*!
+     * Retrieves whether the states of the sparse model are to be renumbered before model checking.
+     */
+    bool isReorderStatesSet() const;
+
+    /*!
+     * Retrieves the order in which the states of the sparse model are to be renumbered.
+     */
+    storm::transformer::StateOrder getStateOrder() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -56,6 +66,7 @@ class TransformationSettings : public ModuleSettings {
     static const std::string labelBehaviorOptionName;
     static const std::string toNondetOptionName;
     static const std::string toDiscreteTimeOptionName;
+    static const std::string reorderOptionName;
 };
 
 }  // namespace modules
@@ -10,8 +10,10 @@
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
 #include "storm/solver/helper/SchedulerTrackingHelper.h"
+#include "storm/solver/helper/SinglePrecisionIntervalIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -57,10 +59,15 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::getMe
 
     if (isExactMode && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::ViToPi) {
         if (env.solver().minMax().isMethodSetFromDefault()) {
-            STORM_LOG_INFO(
-                "Selecting 'Policy iteration' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a "
-                "different method.");
-            method = MinMaxMethod::PolicyIteration;
+            if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+                // Value iteration in floating point arithmetic typically yields an optimal scheduler, which then only needs to be checked exactly.
+                method = MinMaxMethod::ViToPi;
+            } else {
+                method = MinMaxMethod::PolicyIteration;
+            }
+            STORM_LOG_INFO("Selecting '" << toString(method)
+                                         << "' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a "
+                                            "different method.");
         } else {
             STORM_LOG_WARN("The selected solution method " << toString(method) << " does not guarantee exact results.");
         }
@@ -80,6 +87,10 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::getMe
                         method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration ||
                         method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi,
                     storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method '" << toString(method) << "'.");
+    STORM_LOG_WARN_COND(!env.solver().isSinglePrecisionMatrix() || method == MinMaxMethod::IntervalIteration,
+                        "Single precision matrix entries are only used by interval iteration.");
+    STORM_LOG_WARN_COND(!env.solver().minMax().isPrioritizedValueIteration() || method == MinMaxMethod::ValueIteration,
+                        "Prioritized updates are only used by value iteration.");
     return method;
 }
 
@@ -536,9 +547,27 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
-    auto status = viHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
-                              storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision()), dir, viCallback,
-                              env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
+    SolverStatus status{SolverStatus::InProgress};
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().minMax().isPrioritizedValueIteration()) {
+            std::function<bool(uint64_t, uint64_t)> ignoredRows;
+            if (this->choiceFixedForRowGroup) {
+                ignoredRows = [&](uint64_t groupIndex, uint64_t localRowIndex) {
+                    return this->choiceFixedForRowGroup->get(groupIndex) && this->initialScheduler->at(groupIndex) != localRowIndex;
+                };
+            }
+            storm::solver::helper::PrioritizedValueIterationHelper<ValueType, false> prioritizedViHelper(viOperator, *this->A, ignoredRows);
+            status = prioritizedViHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                            storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), dir, viCallback);
+        }
+    } else {
+        STORM_LOG_WARN_COND(!env.solver().minMax().isPrioritizedValueIteration(), "Prioritized value iteration is only supported for double precision.");
+    }
+    if (status == SolverStatus::InProgress) {
+        status = viHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                             storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision()), dir, viCallback,
+                             env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
+    }
     this->reportStatus(status, numIterations);
 
     // If requested, we store the scheduler for retrieval.
@@ -572,11 +601,13 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement intervaliteration for interval-based models");
         return false;
     } else {
-        setUpViOperator();
-        helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-        auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createLowerBoundsVector(vector); };
-        auto upperBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createUpperBoundsVector(vector); };
+        std::function<void(std::vector<SolutionType>&)> lowerBoundsCallback = [&](std::vector<SolutionType>& vector) {
+            this->createLowerBoundsVector(vector);
+        };
+        std::function<void(std::vector<SolutionType>&)> upperBoundsCallback = [&](std::vector<SolutionType>& vector) {
+            this->createUpperBoundsVector(vector);
+        };
 
         uint64_t numIterations{0};
         auto iiCallback = [&](helper::IIData<ValueType> const& data) {
@@ -590,12 +621,47 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             optionalRelevantValues = this->getRelevantValues();
         }
         this->startMeasureProgress();
-        auto status = iiHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback,
-                                  dir, iiCallback, optionalRelevantValues);
+        SolverStatus status = SolverStatus::InProgress;
+        std::pair<std::vector<SolutionType>, std::vector<SolutionType>> singlePrecisionBounds;
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (env.solver().isSinglePrecisionMatrix()) {
+                std::function<bool(uint64_t, uint64_t)> ignoredRows;
+                if (this->choiceFixedForRowGroup) {
+                    ignoredRows = [&](uint64_t groupIndex, uint64_t localRowIndex) {
+                        return this->choiceFixedForRowGroup->get(groupIndex) && this->initialScheduler->at(groupIndex) != localRowIndex;
+                    };
+                }
+                helper::SinglePrecisionIntervalIterationHelper<false> singlePrecisionHelper(*this->A, ignoredRows);
+                singlePrecisionBounds.first.resize(x.size());
+                singlePrecisionBounds.second.resize(x.size());
+                lowerBoundsCallback(singlePrecisionBounds.first);
+                upperBoundsCallback(singlePrecisionBounds.second);
+                ValueType lowerBound = this->hasLowerBound() ? this->getLowerBound(true) : storm::utility::zero<ValueType>();
+                status = singlePrecisionHelper.II(singlePrecisionBounds, b, lowerBound, this->getUpperBound(true), numIterations,
+                                                  env.solver().minMax().getRelativeTerminationCriterion(), prec, dir, iiCallback, optionalRelevantValues);
+                if (status == SolverStatus::InProgress) {
+                    // Continue with the original matrix, starting from the bounds obtained so far.
+                    lowerBoundsCallback = [&](std::vector<SolutionType>& vector) { vector.swap(singlePrecisionBounds.first); };
+                    upperBoundsCallback = [&](std::vector<SolutionType>& vector) { vector.swap(singlePrecisionBounds.second); };
+                } else {
+                    storm::utility::vector::applyPointwise<SolutionType, SolutionType, SolutionType>(
+                        singlePrecisionBounds.first, singlePrecisionBounds.second, x,
+                        [](SolutionType const& lower, SolutionType const& upper) { return (lower + upper) / 2; });
+                }
+            }
+        }
+        if (status == SolverStatus::InProgress) {
+            setUpViOperator();
+            helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
+            status = iiHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback,
+                                 dir, iiCallback, optionalRelevantValues);
+        }
         this->reportStatus(status, numIterations);
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
+            // The operator is not set up yet if the single precision iterations were sufficient.
+            setUpViOperator();
             this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
         }
 
@@ -686,6 +752,12 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         impreciseSolver->solveEquations(viEnv, dir, xVi, bVi);
         initialSched = impreciseSolver->getSchedulerChoices();
     }
+    if (this->choiceFixedForRowGroup) {
+        // Value iteration is not aware of the fixed choices, so we restore them.
+        for (auto group : this->choiceFixedForRowGroup.get()) {
+            initialSched[group] = this->getInitialScheduler()[group];
+        }
+    }
     STORM_LOG_INFO("Found initial policy using Value Iteration. Starting Policy iteration now.");
     return performPolicyIteration(env, dir, x, b, std::move(initialSched));
 }
@@ -10,6 +10,7 @@
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
+#include "storm/solver/helper/SinglePrecisionIntervalIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
@@ -424,11 +425,9 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
     STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (IntervalIteration)");
-    setUpViOperator();
-    helper::IntervalIterationHelper<ValueType, true> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-    auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
-    auto upperBoundsCallback = [&](std::vector<ValueType>& vector) { this->createUpperBoundsVector(vector); };
+    std::function<void(std::vector<ValueType>&)> lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
+    std::function<void(std::vector<ValueType>&)> upperBoundsCallback = [&](std::vector<ValueType>& vector) { this->createUpperBoundsVector(vector); };
 
     uint64_t numIterations{0};
     auto iiCallback = [&](helper::IIData<ValueType> const& data) {
@@ -442,8 +441,35 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
         optionalRelevantValues = this->getRelevantValues();
     }
     this->startMeasureProgress();
-    auto status = iiHelper.II(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback, {},
-                              iiCallback, optionalRelevantValues);
+    SolverStatus status = SolverStatus::InProgress;
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> singlePrecisionBounds;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().isSinglePrecisionMatrix()) {
+            helper::SinglePrecisionIntervalIterationHelper<true> singlePrecisionHelper(*this->A);
+            singlePrecisionBounds.first.resize(x.size());
+            singlePrecisionBounds.second.resize(x.size());
+            lowerBoundsCallback(singlePrecisionBounds.first);
+            upperBoundsCallback(singlePrecisionBounds.second);
+            ValueType lowerBound = this->hasLowerBound() ? this->getLowerBound(true) : storm::utility::zero<ValueType>();
+            status = singlePrecisionHelper.II(singlePrecisionBounds, b, lowerBound, this->getUpperBound(true), numIterations,
+                                              env.solver().native().getRelativeTerminationCriterion(), prec, {}, iiCallback, optionalRelevantValues);
+            if (status == SolverStatus::InProgress) {
+                // Continue with the original matrix, starting from the bounds obtained so far.
+                lowerBoundsCallback = [&](std::vector<ValueType>& vector) { vector.swap(singlePrecisionBounds.first); };
+                upperBoundsCallback = [&](std::vector<ValueType>& vector) { vector.swap(singlePrecisionBounds.second); };
+            } else {
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+                    singlePrecisionBounds.first, singlePrecisionBounds.second, x,
+                    [](ValueType const& lower, ValueType const& upper) { return (lower + upper) / 2; });
+            }
+        }
+    }
+    if (status == SolverStatus::InProgress) {
+        setUpViOperator();
+        helper::IntervalIterationHelper<ValueType, true> iiHelper(viOperator);
+        status = iiHelper.II(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback, {},
+                             iiCallback, optionalRelevantValues);
+    }
     this->reportStatus(status, numIterations);
 
     if (!this->isCachingEnabled()) {
@@ -598,6 +624,8 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
             STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
         }
     }
+    STORM_LOG_WARN_COND(!env.solver().isSinglePrecisionMatrix() || method == NativeLinearEquationSolverMethod::IntervalIteration,
+                        "Single precision matrix entries are only used by interval iteration.");
     return method;
 }
 
@@ -1,8 +1,14 @@
 #include "storm/solver/helper/IntervalterationHelper.h"
 
+#include <algorithm>
+#include <thread>
 #include <type_traits>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/GeneralSettings.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/Extremum.h"
 #include "storm/utility/constants.h"
@@ -10,11 +16,18 @@
 
 namespace storm::solver::helper {
 
-template<typename ValueType, bool TrivialRowGrouping>
-IntervalIterationHelper<ValueType, TrivialRowGrouping>::IntervalIterationHelper(
-    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator)
-    : viOperator(viOperator) {
-    // Intentionally left empty.
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+IntervalIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::IntervalIterationHelper(
+    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator)
+    : viOperator(viOperator), parallelize(false), minimalParallelSize(0) {
+#ifdef STORM_HAVE_INTELTBB
+    auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
+    parallelize = std::is_floating_point_v<SolutionType> && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() &&
+                  generalSettings.isConcurrentIntervalIterationSet();
+    if (parallelize) {
+        minimalParallelSize = generalSettings.getConcurrentIntervalIterationMinimalSize();
+    }
+#endif
 }
 
 template<typename ValueType, OptimizationDirection Dir>
@@ -53,25 +66,81 @@ class IIBackend {
     storm::utility::Extremum<Dir, ValueType> xBest, yBest;
 };
 
+template<typename ValueType>
+bool isConvergedRelative(ValueType const& l, ValueType const& u, ValueType const& precision) {
+    if (l > storm::utility::zero<ValueType>()) {
+        return (u - l) <= l * precision;
+    } else if (u < storm::utility::zero<ValueType>()) {
+        return (l - u) >= u * precision;
+    } else {  //  l <= 0 <= u
+        return l == u;
+    }
+}
+
+/*!
+ * Backend for interval iteration on a partition of the row groups (see ValueIterationOperator::setPartitioning).
+ * The new bounds are written to a separate operand. As in IIBackend, the lower (upper) bounds never decrease (increase).
+ * Moreover, this backend checks whether the bounds of the processed (relevant) row groups have converged.
+ */
+template<typename ValueType, OptimizationDirection Dir>
+class IIPartitionBackend {
+   public:
+    IIPartitionBackend(std::pair<std::vector<ValueType>, std::vector<ValueType>> const& xyIn, bool relative, ValueType const& precision,
+                       storm::storage::BitVector const* relevantValues)
+        : xyIn(xyIn), relative(relative), precision(precision), relevantValues(relevantValues) {
+        // Intentionally left empty.
+    }
+
+    void startNewIteration() {
+        allConverged = true;
+    }
+
+    void firstRow(std::pair<ValueType, ValueType>&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        xBest = std::move(value.first);
+        yBest = std::move(value.second);
+    }
+
+    void nextRow(std::pair<ValueType, ValueType>&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        xBest &= std::move(value.first);
+        yBest &= std::move(value.second);
+    }
+
+    void applyUpdate(ValueType& xOut, ValueType& yOut, uint64_t rowGroup) {
+        xOut = std::max(xyIn.first[rowGroup], *xBest);
+        yOut = std::min(xyIn.second[rowGroup], *yBest);
+        if (allConverged && (!relevantValues || relevantValues->get(rowGroup))) {
+            allConverged = relative ? isConvergedRelative(xOut, yOut, precision) : yOut - xOut <= precision;
+        }
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return allConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> const& xyIn;
+    bool const relative;
+    ValueType const& precision;
+    storm::storage::BitVector const* relevantValues;
+    storm::utility::Extremum<Dir, ValueType> xBest, yBest;
+    bool allConverged{true};
+};
+
 template<typename ValueType>
 bool checkConvergence(std::pair<std::vector<ValueType>, std::vector<ValueType>> const& xy, uint64_t& convergenceCheckState,
                       std::function<void()> const& getNextConvergenceCheckState, bool relative, ValueType const& precision) {
     if (relative) {
         for (; convergenceCheckState < xy.first.size(); getNextConvergenceCheckState()) {
-            ValueType const& l = xy.first[convergenceCheckState];
-            ValueType const& u = xy.second[convergenceCheckState];
-            if (l > storm::utility::zero<ValueType>()) {
-                if ((u - l) > l * precision) {
-                    return false;
-                }
-            } else if (u < storm::utility::zero<ValueType>()) {
-                if ((l - u) < u * precision) {
-                    return false;
-                }
-            } else {  //  l <= 0 <= u
-                if (l != u) {
-                    return false;
-                }
+            if (!isConvergedRelative(xy.first[convergenceCheckState], xy.second[convergenceCheckState], precision)) {
+                return false;
             }
         }
     } else {
@@ -84,15 +153,20 @@ bool checkConvergence(std::pair<std::vector<ValueType>, std::vector<ValueType>>
     return true;
 }
 
-template<typename ValueType, bool TrivialRowGrouping>
-template<OptimizationDirection Dir>
-SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy,
-                                                                        std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
-                                                                        ValueType const& precision,
-                                                                        std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
-                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<OptimizationDirection Dir, typename OffsetType>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::II(
+    std::pair<std::vector<SolutionType>, std::vector<SolutionType>>& xy, OffsetType const& offsets, uint64_t& numIterations, bool relative,
+    SolutionType const& precision, std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback,
+    std::optional<storm::storage::BitVector> const& relevantValues) const {
+    if constexpr (std::is_floating_point_v<SolutionType>) {
+        // The concurrent variant usually needs more iterations, which only pays off for large equation systems.
+        if (parallelize && xy.first.size() >= minimalParallelSize) {
+            return parallelII<Dir>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+        }
+    }
     SolverStatus status{SolverStatus::InProgress};
-    IIBackend<ValueType, Dir> backend;
+    IIBackend<SolutionType, Dir> backend;
     uint64_t convergenceCheckState = 0;
     std::function<void()> getNextConvergenceCheckState;
     if (relevantValues) {
@@ -109,29 +183,65 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pai
         if (checkConvergence(xy, convergenceCheckState, getNextConvergenceCheckState, relative, precision)) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
-            status = iterationCallback(IIData<ValueType>({xy.first, xy.second, status}));
+            status = iterationCallback(IIData<SolutionType>({xy.first, xy.second, status}));
         }
     }
     return status;
 }
 
-template<typename ValueType, bool TrivialRowGrouping>
-SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets,
-                                                                        uint64_t& numIterations, bool relative, ValueType const& precision,
-                                                                        std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
-                                                                        std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
-                                                                        std::optional<storm::OptimizationDirection> const& dir,
-                                                                        std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
-                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<OptimizationDirection Dir, typename OffsetType>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::parallelII(
+    std::pair<std::vector<SolutionType>, std::vector<SolutionType>>& xy, OffsetType const& offsets, uint64_t& numIterations, bool relative,
+    SolutionType const& precision, std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback,
+    std::optional<storm::storage::BitVector> const& relevantValues) const {
+    // Use a few partitions per thread so that the load can be balanced.
+    uint64_t const numberOfPartitions = viOperator->setPartitioning(std::max<uint64_t>(1, std::thread::hardware_concurrency()) * 8);
+    storm::storage::BitVector const* relevantValuesPtr = relevantValues ? &relevantValues.value() : nullptr;
+    // Each partition writes its new bounds to xyNext (reading only from xy) and reports whether its bounds have converged.
+    std::pair<std::vector<SolutionType>, std::vector<SolutionType>> xyNext(xy);
+    std::vector<uint8_t> partitionConverged(numberOfPartitions);
+    auto applyOnPartitions = [&](uint64_t begin, uint64_t end) {
+        for (uint64_t partition = begin; partition < end; ++partition) {
+            IIPartitionBackend<SolutionType, Dir> backend(xy, relative, precision, relevantValuesPtr);
+            partitionConverged[partition] = viOperator->applyOnPartition(partition, xy, xyNext, offsets, backend);
+        }
+    };
+
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfPartitions, 1),
+                          [&applyOnPartitions](tbb::blocked_range<uint64_t> const& range) { applyOnPartitions(range.begin(), range.end()); });
+#else
+        applyOnPartitions(0, numberOfPartitions);
+#endif
+        xy.swap(xyNext);
+        if (std::all_of(partitionConverged.begin(), partitionConverged.end(), [](uint8_t converged) { return converged != 0; })) {
+            status = SolverStatus::Converged;
+        } else if (iterationCallback) {
+            status = iterationCallback(IIData<SolutionType>({xy.first, xy.second, status}));
+        }
+    }
+    return status;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::II(
+    std::vector<SolutionType>& operand, std::vector<SolutionType> const& offsets, uint64_t& numIterations, bool relative, SolutionType const& precision,
+    std::function<void(std::vector<SolutionType>&)> const& prepareLowerBounds, std::function<void(std::vector<SolutionType>&)> const& prepareUpperBounds,
+    std::optional<storm::OptimizationDirection> const& dir, std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback,
+    std::optional<storm::storage::BitVector> const& relevantValues) const {
     // Create two vectors x and y using the given operand plus an auxiliary vector.
-    std::pair<std::vector<ValueType>, std::vector<ValueType>> xy;
+    std::pair<std::vector<SolutionType>, std::vector<SolutionType>> xy;
     auto& auxVector = viOperator->allocateAuxiliaryVector(operand.size());
     xy.first.swap(operand);
     xy.second.swap(auxVector);
     prepareLowerBounds(xy.first);
     prepareUpperBounds(xy.second);
     auto doublePrec = precision + precision;
-    if constexpr (std::is_same_v<ValueType, double>) {
+    if constexpr (std::is_same_v<SolutionType, double>) {
         doublePrec -= precision * 1e-6;  // be slightly more precise to avoid a good chunk of floating point issues
     }
     SolverStatus status;
@@ -140,10 +250,10 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
     } else {
         status = II<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
     }
-    auto two = storm::utility::convertNumber<ValueType>(2.0);
+    auto two = storm::utility::convertNumber<SolutionType>(2.0);
     // get the average of lower- and upper result
-    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
-        xy.first, xy.second, xy.first, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+    storm::utility::vector::applyPointwise<SolutionType, SolutionType, SolutionType>(
+        xy.first, xy.second, xy.first, [&two](SolutionType const& a, SolutionType const& b) -> SolutionType { return (a + b) / two; });
     // Swap operand and aux vector back to original positions.
     xy.first.swap(operand);
     xy.second.swap(auxVector);
@@ -151,20 +261,34 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
     return status;
 }
 
-template<typename ValueType, bool TrivialRowGrouping>
-SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, bool relative,
-                                                                        ValueType const& precision,
-                                                                        std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
-                                                                        std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
-                                                                        std::optional<storm::OptimizationDirection> const& dir,
-                                                                        std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
-                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::II(
+    std::vector<SolutionType>& operand, std::vector<SolutionType> const& offsets, bool relative, SolutionType const& precision,
+    std::function<void(std::vector<SolutionType>&)> const& prepareLowerBounds, std::function<void(std::vector<SolutionType>&)> const& prepareUpperBounds,
+    std::optional<storm::OptimizationDirection> const& dir, std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback,
+    std::optional<storm::storage::BitVector> const& relevantValues) const {
     uint64_t numIterations = 0;
     return II(operand, offsets, numIterations, relative, precision, prepareLowerBounds, prepareUpperBounds, dir, iterationCallback, relevantValues);
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::II(
+    std::pair<std::vector<SolutionType>, std::vector<SolutionType>>& xy, std::vector<SolutionType> const& lowerOffsets,
+    std::vector<SolutionType> const& upperOffsets, uint64_t& numIterations, bool relative, SolutionType const& precision,
+    std::optional<storm::OptimizationDirection> const& dir, std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback,
+    std::optional<storm::storage::BitVector> const& relevantValues) const {
+    auto const offsets = std::make_pair(&lowerOffsets, &upperOffsets);
+    if (!dir.has_value() || maximize(*dir)) {
+        return II<OptimizationDirection::Maximize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+    } else {
+        return II<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+    }
+}
+
 template class IntervalIterationHelper<double, true>;
 template class IntervalIterationHelper<double, false>;
+template class IntervalIterationHelper<float, true, double>;
+template class IntervalIterationHelper<float, false, double>;
 template class IntervalIterationHelper<storm::RationalNumber, true>;
 template class IntervalIterationHelper<storm::RationalNumber, false>;
 
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <functional>
 #include <memory>
 #include <optional>
@@ -20,31 +22,51 @@ struct IIData {
 /*!
  * Implements interval iteration
  * @see https://doi.org/10.1007/978-3-319-63387-9_8
+ *
+ * If Intel TBB and concurrent interval iteration are enabled, the row groups of sufficiently large floating point models are split into partitions
+ * that are processed concurrently. In this case, each iteration reads the bounds from the previous iteration (instead of updating them in place).
  */
-template<typename ValueType, bool TrivialRowGrouping>
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType = ValueType>
 class IntervalIterationHelper {
    public:
-    IntervalIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator);
+    IntervalIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator);
+
+    template<OptimizationDirection Dir, typename OffsetType>
+    SolverStatus II(std::pair<std::vector<SolutionType>, std::vector<SolutionType>>& xy, OffsetType const& offsets, uint64_t& numIterations, bool relative,
+                    SolutionType const& precision, std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback = {},
+                    std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
 
-    template<OptimizationDirection Dir>
-    SolverStatus II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, std::vector<ValueType> const& offsets, uint64_t& numIterations,
-                    bool relative, ValueType const& precision, std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
+    SolverStatus II(std::vector<SolutionType>& operand, std::vector<SolutionType> const& offsets, uint64_t& numIterations, bool relative,
+                    SolutionType const& precision, std::function<void(std::vector<SolutionType>&)> const& prepareLowerBounds,
+                    std::function<void(std::vector<SolutionType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback = {},
                     std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
 
-    SolverStatus II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
-                    std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
-                    std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
-                    std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
+    SolverStatus II(std::vector<SolutionType>& operand, std::vector<SolutionType> const& offsets, bool relative, SolutionType const& precision,
+                    std::function<void(std::vector<SolutionType>&)> const& prepareLowerBounds,
+                    std::function<void(std::vector<SolutionType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback = {},
                     std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
 
-    SolverStatus II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, bool relative, ValueType const& precision,
-                    std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
-                    std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
-                    std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
+    /*!
+     * Improves the given lower and upper bounds (xy.first and xy.second) using different offsets for the lower and the upper bounds.
+     * In contrast to the other variants, the resulting bounds are not combined into a single result.
+     */
+    SolverStatus II(std::pair<std::vector<SolutionType>, std::vector<SolutionType>>& xy, std::vector<SolutionType> const& lowerOffsets,
+                    std::vector<SolutionType> const& upperOffsets, uint64_t& numIterations, bool relative, SolutionType const& precision,
+                    std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback = {},
                     std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
 
    private:
-    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
+    template<OptimizationDirection Dir, typename OffsetType>
+    SolverStatus parallelII(std::pair<std::vector<SolutionType>, std::vector<SolutionType>>& xy, OffsetType const& offsets, uint64_t& numIterations,
+                            bool relative, SolutionType const& precision, std::function<SolverStatus(IIData<SolutionType> const&)> const& iterationCallback,
+                            std::optional<storm::storage::BitVector> const& relevantValues) const;
+
+    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator;
+    bool parallelize;
+    uint64_t minimalParallelSize;
 };
 
 }  // namespace storm::solver::helper
@@ -0,0 +1,192 @@
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
+
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/DynamicPriorityQueue.h"
+#include "storm/utility/Extremum.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
+class PrioritizedVIOperatorBackend {
+   public:
+    PrioritizedVIOperatorBackend(ValueType const& precision, std::vector<ValueType>& changes) : precision{precision}, changes{changes} {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::move(value);
+    }
+
+    void nextRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best &= value;
+    }
+
+    void applyUpdate(ValueType& currValue, uint64_t rowGroup) {
+        changes[rowGroup] = storm::utility::abs<ValueType>(currValue - *best);
+        if (isConverged) {
+            if constexpr (Relative) {
+                isConverged = changes[rowGroup] <= storm::utility::abs<ValueType>(precision * currValue);
+            } else {
+                isConverged = changes[rowGroup] <= precision;
+            }
+        }
+        currValue = std::move(*best);
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    storm::utility::Extremum<Dir, ValueType> best;
+    ValueType const precision;
+    std::vector<ValueType>& changes;
+    bool isConverged{true};
+};
+
+template<typename ValueType, bool TrivialRowGrouping>
+PrioritizedValueIterationHelper<ValueType, TrivialRowGrouping>::PrioritizedValueIterationHelper(
+    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator, storm::storage::SparseMatrix<ValueType> const& matrix,
+    std::function<bool(uint64_t, uint64_t)> const& ignoredRows)
+    : viOperator(viOperator), matrix(matrix), ignoredRows(ignoredRows), backwardTransitions(matrix.transpose(true)) {
+    // Intentionally left empty
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<storm::OptimizationDirection Dir>
+ValueType PrioritizedValueIterationHelper<ValueType, TrivialRowGrouping>::computeUpdate(uint64_t rowGroup, std::vector<ValueType> const& operand,
+                                                                                        std::vector<ValueType> const& offsets) const {
+    if constexpr (TrivialRowGrouping) {
+        return offsets[rowGroup] + matrix.multiplyRowWithVector(rowGroup, operand);
+    } else {
+        storm::utility::Extremum<Dir, ValueType> best;
+        uint64_t const firstRow = matrix.getRowGroupIndices()[rowGroup];
+        uint64_t const endRow = matrix.getRowGroupIndices()[rowGroup + 1];
+        for (uint64_t row = firstRow; row < endRow; ++row) {
+            if (!ignoredRows || !ignoredRows(rowGroup, row - firstRow)) {
+                best &= offsets[row] + matrix.multiplyRowWithVector(row, operand);
+            }
+        }
+        STORM_LOG_ASSERT(!best.empty(), "All rows of row group " << rowGroup << " are ignored.");
+        return *best;
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<storm::OptimizationDirection Dir, bool Relative>
+SolverStatus PrioritizedValueIterationHelper<ValueType, TrivialRowGrouping>::VI(
+    std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
+    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    uint64_t const numberOfRowGroups = operand.size();
+    STORM_LOG_ASSERT(backwardTransitions.getRowCount() == numberOfRowGroups, "Dimension mismatch.");
+    std::vector<ValueType> changes(numberOfRowGroups, storm::utility::zero<ValueType>());
+    std::vector<ValueType> residuals(numberOfRowGroups, storm::utility::zero<ValueType>());
+    PrioritizedVIOperatorBackend<ValueType, Dir, Relative> backend{precision, changes};
+
+    auto exceedsPrecision = [&residuals, &operand, &precision](uint64_t rowGroup) {
+        if constexpr (Relative) {
+            return residuals[rowGroup] > storm::utility::abs<ValueType>(precision * operand[rowGroup]);
+        } else {
+            return residuals[rowGroup] > precision;
+        }
+    };
+    auto increasePredecessorResiduals = [this, &residuals](uint64_t rowGroup, ValueType const& change) {
+        for (auto const& entry : backwardTransitions.getRow(rowGroup)) {
+            residuals[entry.getColumn()] += storm::utility::abs<ValueType>(entry.getValue()) * change;
+        }
+    };
+
+    uint64_t numberOfLocalUpdates = 0;
+    SolverStatus status{SolverStatus::InProgress};
+    while (true) {
+        ++numIterations;
+        if (viOperator->apply(operand, operand, offsets, backend)) {
+            status = SolverStatus::Converged;
+        } else if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+        if (status != SolverStatus::InProgress) {
+            break;
+        }
+
+        // Derive the residuals from the changes during the sweep.
+        std::fill(residuals.begin(), residuals.end(), storm::utility::zero<ValueType>());
+        for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+            if (!storm::utility::isZero(changes[rowGroup])) {
+                increasePredecessorResiduals(rowGroup, changes[rowGroup]);
+            }
+        }
+        // The queue contains pairs of a residual and a row group such that the row group with the largest residual is on top.
+        // If the residual of a row group increases, it is inserted again and the outdated entry is skipped once it reaches the top.
+        storm::storage::DynamicPriorityQueue<std::pair<ValueType, uint64_t>> queue(std::less<std::pair<ValueType, uint64_t>>{});
+        for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+            if (exceedsPrecision(rowGroup)) {
+                queue.push({residuals[rowGroup], rowGroup});
+            }
+        }
+
+        // Perform local updates until no residual exceeds the precision, but at most as many as there are row groups. Afterwards, the next sweep
+        // detects whether we converged.
+        for (uint64_t remainingUpdates = numberOfRowGroups; !queue.empty() && remainingUpdates > 0;) {
+            auto const [residual, rowGroup] = queue.popTop();
+            if (residual != residuals[rowGroup]) {
+                continue;
+            }
+            --remainingUpdates;
+            ++numberOfLocalUpdates;
+            residuals[rowGroup] = storm::utility::zero<ValueType>();
+            ValueType newValue = computeUpdate<Dir>(rowGroup, operand, offsets);
+            ValueType change = storm::utility::abs<ValueType>(newValue - operand[rowGroup]);
+            operand[rowGroup] = std::move(newValue);
+            if (!storm::utility::isZero(change)) {
+                increasePredecessorResiduals(rowGroup, change);
+                for (auto const& entry : backwardTransitions.getRow(rowGroup)) {
+                    if (exceedsPrecision(entry.getColumn())) {
+                        queue.push({residuals[entry.getColumn()], entry.getColumn()});
+                    }
+                }
+            }
+        }
+    }
+    STORM_LOG_INFO("Prioritized value iteration performed " << numberOfLocalUpdates << " local updates in addition to " << numIterations << " sweeps.");
+    return status;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+SolverStatus PrioritizedValueIterationHelper<ValueType, TrivialRowGrouping>::VI(
+    std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+    std::optional<storm::OptimizationDirection> const& dir, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    STORM_LOG_ASSERT(TrivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    if (!dir.has_value() || maximize(*dir)) {
+        if (relative) {
+            return VI<storm::OptimizationDirection::Maximize, true>(operand, offsets, numIterations, precision, iterationCallback);
+        } else {
+            return VI<storm::OptimizationDirection::Maximize, false>(operand, offsets, numIterations, precision, iterationCallback);
+        }
+    } else {
+        if (relative) {
+            return VI<storm::OptimizationDirection::Minimize, true>(operand, offsets, numIterations, precision, iterationCallback);
+        } else {
+            return VI<storm::OptimizationDirection::Minimize, false>(operand, offsets, numIterations, precision, iterationCallback);
+        }
+    }
+}
+
+template class PrioritizedValueIterationHelper<double, true>;
+template class PrioritizedValueIterationHelper<double, false>;
+
+}  // namespace storm::solver::helper
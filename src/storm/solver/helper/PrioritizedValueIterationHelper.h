@@ -0,0 +1,61 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/ValueIterationOperatorForward.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Implements value iteration where full Gauss-Seidel sweeps alternate with local updates of single row groups. After each sweep, every row group is
+ * assigned an estimate (its residual) of how much its value changes in the next update, based on the changes of its successors. The row groups whose
+ * residual exceeds the precision are then updated in the order of decreasing residuals, where each update increases the residuals of the predecessors.
+ * This avoids sweeping over large parts of the state space that no longer change.
+ * Convergence is only ever detected during a full sweep, which is why the same termination criterion as for standard value iteration applies.
+ */
+template<typename ValueType, bool TrivialRowGrouping>
+class PrioritizedValueIterationHelper {
+   public:
+    /*!
+     * @param viOperator an operator for the given matrix (in backwards order)
+     * @param matrix the transition matrix. It must not be invalidated as long as this helper is used.
+     * @param ignoredRows if given, the rows for which this function returns true are skipped (with local row indices). This should match the rows that are
+     * ignored by the operator.
+     */
+    PrioritizedValueIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator,
+                                    storm::storage::SparseMatrix<ValueType> const& matrix, std::function<bool(uint64_t, uint64_t)> const& ignoredRows = {});
+
+    /*!
+     * Performs value iteration on the given operand.
+     * @param numIterations is increased by the number of full sweeps. Local updates are not counted.
+     * @param iterationCallback is invoked after each full sweep that did not converge
+     */
+    SolverStatus VI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+                    std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+   private:
+    template<storm::OptimizationDirection Dir, bool Relative>
+    SolverStatus VI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
+                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const;
+
+    /*!
+     * Computes the updated value of the given row group.
+     */
+    template<storm::OptimizationDirection Dir>
+    ValueType computeUpdate(uint64_t rowGroup, std::vector<ValueType> const& operand, std::vector<ValueType> const& offsets) const;
+
+    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    std::function<bool(uint64_t, uint64_t)> ignoredRows;
+    // Row i contains the row groups that have a choice leading to i (possibly multiple times).
+    storm::storage::SparseMatrix<ValueType> backwardTransitions;
+};
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,111 @@
+#include "storm/solver/helper/SinglePrecisionIntervalIterationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/PrecisionExceededException.h"
+
+namespace storm::solver::helper {
+
+template<bool TrivialRowGrouping>
+SinglePrecisionIntervalIterationHelper<TrivialRowGrouping>::SinglePrecisionIntervalIterationHelper(storm::storage::SparseMatrix<double> const& matrix,
+                                                                                                   std::function<bool(uint64_t, uint64_t)> const& ignoredRows)
+    : viOperator(std::make_shared<ValueIterationOperator<float, TrivialRowGrouping, double>>()),
+      positiveRoundingErrors(matrix.getRowCount(), 0.0),
+      negativeRoundingErrors(matrix.getRowCount(), 0.0) {
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            double roundedValue = static_cast<float>(entry.getValue());
+            STORM_LOG_THROW(std::isfinite(roundedValue), storm::exceptions::PrecisionExceededException,
+                            "The matrix entry " << entry.getValue() << " can not be represented in single precision.");
+            // The difference of two such close values can be represented exactly.
+            double roundingError = entry.getValue() - roundedValue;
+            if (roundingError > 0.0) {
+                positiveRoundingErrors[row] += roundingError;
+            } else {
+                negativeRoundingErrors[row] -= roundingError;
+            }
+        }
+    }
+    // The operator copies the matrix entries, so the single precision matrix is only needed temporarily.
+    if constexpr (TrivialRowGrouping) {
+        viOperator->setMatrixBackwards(matrix.template toValueType<float>());
+    } else {
+        viOperator->setMatrixBackwards(matrix.template toValueType<float>(), &matrix.getRowGroupIndices());
+        if (ignoredRows) {
+            viOperator->setIgnoredRows(true, ignoredRows);
+        }
+    }
+}
+
+template<bool TrivialRowGrouping>
+SolverStatus SinglePrecisionIntervalIterationHelper<TrivialRowGrouping>::II(std::pair<std::vector<double>, std::vector<double>>& xy,
+                                                                            std::vector<double> const& offsets, double lowerBound, double upperBound,
+                                                                            uint64_t& numIterations, bool relative, double precision,
+                                                                            std::optional<storm::OptimizationDirection> const& dir,
+                                                                            std::function<SolverStatus(IIData<double> const&)> const& iterationCallback,
+                                                                            std::optional<storm::storage::BitVector> const& relevantValues) const {
+    STORM_LOG_ASSERT(offsets.size() == positiveRoundingErrors.size(), "Dimension mismatch.");
+    // Let d be the difference between an original and a rounded entry of a row. If the corresponding solution entry lies in [lowerBound, upperBound], the
+    // rounded row misses at least d*lowerBound and at most d*upperBound (or the other way around if d is negative).
+    std::vector<double> lowerOffsets(offsets.size()), upperOffsets(offsets.size());
+    for (uint64_t row = 0; row < offsets.size(); ++row) {
+        lowerOffsets[row] = offsets[row] + positiveRoundingErrors[row] * lowerBound - negativeRoundingErrors[row] * upperBound;
+        upperOffsets[row] = offsets[row] + positiveRoundingErrors[row] * upperBound - negativeRoundingErrors[row] * lowerBound;
+    }
+
+    // The bounds can not become arbitrarily precise due to the rounding errors. We therefore regularly check whether the largest difference between the
+    // lower and upper bounds still decreases.
+    uint64_t const stagnationCheckInterval = 64;
+    double const minimalImprovementFactor = 0.99;
+    double previousMaximalDifference = std::numeric_limits<double>::infinity();
+    uint64_t iterationsSinceLastCheck = 0;
+    bool stagnated = false;
+    auto getMaximalDifference = [&relevantValues](IIData<double> const& data) {
+        double result = 0.0;
+        if (relevantValues) {
+            for (auto index : relevantValues.value()) {
+                result = std::max(result, data.y[index] - data.x[index]);
+            }
+        } else {
+            for (uint64_t index = 0; index < data.x.size(); ++index) {
+                result = std::max(result, data.y[index] - data.x[index]);
+            }
+        }
+        return result;
+    };
+    auto callback = [&](IIData<double> const& data) {
+        SolverStatus status = data.status;
+        if (iterationCallback) {
+            status = iterationCallback(data);
+        }
+        if (status == SolverStatus::InProgress && ++iterationsSinceLastCheck == stagnationCheckInterval) {
+            iterationsSinceLastCheck = 0;
+            double maximalDifference = getMaximalDifference(data);
+            if (maximalDifference > previousMaximalDifference * minimalImprovementFactor) {
+                stagnated = true;
+                status = SolverStatus::Aborted;
+            }
+            previousMaximalDifference = maximalDifference;
+        }
+        return status;
+    };
+
+    IntervalIterationHelper<float, TrivialRowGrouping, double> iiHelper(viOperator);
+    auto status = iiHelper.II(xy, lowerOffsets, upperOffsets, numIterations, relative, precision, dir, callback, relevantValues);
+    if (stagnated) {
+        STORM_LOG_INFO("Bounds obtained with single precision matrix entries stopped improving after " << numIterations << " iterations.");
+        return SolverStatus::InProgress;
+    }
+    return status;
+}
+
+template class SinglePrecisionIntervalIterationHelper<true>;
+template class SinglePrecisionIntervalIterationHelper<false>;
+
+}  // namespace storm::solver::helper
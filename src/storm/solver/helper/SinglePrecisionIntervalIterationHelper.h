@@ -0,0 +1,60 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/IntervalterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperatorForward.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+template<typename T>
+class SparseMatrix;
+}
+
+namespace solver::helper {
+
+/*!
+ * Implements interval iteration on a copy of the transition matrix whose entries are stored in single precision, whereas the bounds and all computations
+ * remain in double precision. As value iteration is limited by memory bandwidth, this makes iterations cheaper on large models.
+ * The rounding errors of the matrix entries are accounted for by shifting the offsets of the lower and upper bounds using global bounds on the solution.
+ * Hence, the obtained lower and upper bounds are correct, but they might not get arbitrarily close to each other. Once the bounds stop improving,
+ * the iteration stops such that the remaining iterations can be performed on the original matrix.
+ */
+template<bool TrivialRowGrouping>
+class SinglePrecisionIntervalIterationHelper {
+   public:
+    /*!
+     * @param matrix the transition matrix. Its row group indices must not be invalidated as long as this helper is used.
+     * @param ignoredRows if given, the rows for which this function returns true are skipped, see ValueIterationOperator::setIgnoredRows (with local row
+     * indices)
+     */
+    SinglePrecisionIntervalIterationHelper(storm::storage::SparseMatrix<double> const& matrix,
+                                           std::function<bool(uint64_t, uint64_t)> const& ignoredRows = {});
+
+    /*!
+     * Improves the given lower and upper bounds (xy.first and xy.second).
+     * @param lowerBound a lower bound for all entries of the solution
+     * @param upperBound an upper bound for all entries of the solution
+     * @return Converged if the precision is reached, InProgress if the bounds stopped improving, and the status returned by the callback otherwise.
+     */
+    SolverStatus II(std::pair<std::vector<double>, std::vector<double>>& xy, std::vector<double> const& offsets, double lowerBound, double upperBound,
+                    uint64_t& numIterations, bool relative, double precision, std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(IIData<double> const&)> const& iterationCallback = {},
+                    std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+
+   private:
+    std::shared_ptr<ValueIterationOperator<float, TrivialRowGrouping, double>> viOperator;
+
+    // For each row, the sum over the differences between the original and the rounded entries that are positive (or negative, respectively).
+    std::vector<double> positiveRoundingErrors;
+    std::vector<double> negativeRoundingErrors;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
@@ -1,6 +1,8 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
+#include <algorithm>
 #include <optional>
+#include <tuple>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/SparseMatrix.h"
@@ -24,6 +26,7 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     }
     this->backwards = Backward;
     this->hasSkippedRows = false;
+    this->partitions.clear();
     auto const numRows = matrix.getRowCount();
     matrixValues.clear();
     matrixColumns.clear();
@@ -67,6 +70,47 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     setMatrix<true>(matrix, rowGroupIndices);
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setPartitioning(uint64_t numberOfPartitions) {
+    STORM_LOG_ASSERT(numberOfPartitions > 0, "Invalid number of partitions.");
+    STORM_LOG_ASSERT(!matrixColumns.empty(), "Tried to partition the row groups but no matrix has been set.");
+    partitions.clear();
+    uint64_t const minimalPartitionSize = std::max<uint64_t>(1, matrixColumns.size() / numberOfPartitions);
+    // The row group counter and the partition boundaries refer to the order in which the row groups are processed (which is reversed when going backwards).
+    uint64_t processedGroups = 0;
+    uint64_t valuePosition = 0;
+    Partition currentPartition{0, 0, 0, 0};
+    // The last entry only indicates the end of the last row (group)
+    for (uint64_t columnPosition = 0; columnPosition + 1 < matrixColumns.size(); ++columnPosition) {
+        IndexType const column = matrixColumns[columnPosition];
+        if (column >= (TrivialRowGrouping ? StartOfRowIndicator : StartOfRowGroupIndicator)) {
+            if (processedGroups > currentPartition.firstGroup && columnPosition - currentPartition.columnPosition >= minimalPartitionSize) {
+                currentPartition.endGroup = processedGroups;
+                partitions.push_back(currentPartition);
+                currentPartition = Partition{processedGroups, 0, columnPosition, valuePosition};
+            }
+            ++processedGroups;
+        } else if (column < StartOfRowIndicator) {
+            ++valuePosition;
+        }
+    }
+    currentPartition.endGroup = processedGroups;
+    partitions.push_back(currentPartition);
+    STORM_LOG_ASSERT(valuePosition == matrixValues.size(), "Unexpected number of matrix entries.");
+
+    if (backwards) {
+        for (auto& partition : partitions) {
+            std::tie(partition.firstGroup, partition.endGroup) = std::make_pair(processedGroups - partition.endGroup, processedGroups - partition.firstGroup);
+        }
+    }
+    return partitions.size();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::getNumberOfPartitions() const {
+    return partitions.size();
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
     for (auto& c : matrixColumns) {
@@ -176,6 +220,8 @@ uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::sk
 
 template class ValueIterationOperator<double, true>;
 template class ValueIterationOperator<double, false>;
+template class ValueIterationOperator<float, true, double>;
+template class ValueIterationOperator<float, false, double>;
 template class ValueIterationOperator<storm::RationalNumber, true>;
 template class ValueIterationOperator<storm::RationalNumber, false>;
 template class ValueIterationOperator<storm::Interval, true, double>;
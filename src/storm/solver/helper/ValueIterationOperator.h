@@ -1,6 +1,7 @@
 #pragma once
 #include <functional>
 #include <optional>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -79,8 +80,9 @@ class ValueIterationOperator {
      * @tparam OperandType The type of input and output operand. Can be a value vector or a pair of two value vectors with one entry per group.
      *                      In the latter case, the rowResult for backend.firstRow and backend.nextRow is a pair of values and
      *                      applyUpdate gets two operandOutReference's to write the group result to.
-     * @tparam OffsetType The type of row offsets. Can be a single value vector (one entry per row) or a pair of a (pointer to a) value vector and a value.
-     *                      The latter case is only valid if OperandType is a pair of two value vectors.
+     * @tparam OffsetType The type of row offsets. Can be a single value vector (one entry per row), a pair of a (pointer to a) value vector and a value, or
+     *                      a pair of pointers to two value vectors (one for each operand).
+     *                      The latter two cases are only valid if OperandType is a pair of two value vectors.
      * @tparam BackendType The type of backend, shall implement the methods above
      * @param operandIn Input operand
      * @param operandOut Output operand
@@ -126,6 +128,46 @@ class ValueIterationOperator {
         return applyRobust<RobustDir>(operand, operand, offsets, backend);
     }
 
+    /*!
+     * Splits the row groups into (at most) the given number of partitions. Each partition consists of row groups that are processed consecutively and
+     * all partitions have roughly the same number of matrix entries.
+     * @return the number of partitions
+     * @note The partitioning is invalidated whenever a new matrix is set.
+     */
+    uint64_t setPartitioning(uint64_t numberOfPartitions);
+
+    /*!
+     * @return the number of partitions as set by setPartitioning (or zero if no partitioning has been set)
+     */
+    uint64_t getNumberOfPartitions() const;
+
+    /*!
+     * Same as `apply` but only processes the row groups of the given partition (see setPartitioning).
+     * @note Different partitions can be processed concurrently, provided that each of them uses its own backend and operandOut is different from operandIn.
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType>
+    bool applyOnPartition(uint64_t partitionIndex, OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets,
+                          BackendType& backend) const {
+        static_assert(!std::is_same_v<ValueType, storm::Interval>, "Robust value iteration uses a shared cache and can not be applied on partitions.");
+        STORM_LOG_ASSERT(partitionIndex < partitions.size(), "Invalid partition index " << partitionIndex << ".");
+        Partition const& partition = partitions[partitionIndex];
+        auto const groupRange = std::make_tuple(partition.firstGroup, partition.endGroup, partition.columnPosition, partition.valuePosition);
+        constexpr auto RobustDir = OptimizationDirection::Maximize;
+        if (hasSkippedRows) {
+            if (backwards) {
+                return apply<OperandType, OffsetType, BackendType, true, true, RobustDir>(operandOut, operandIn, offsets, backend, groupRange);
+            } else {
+                return apply<OperandType, OffsetType, BackendType, false, true, RobustDir>(operandOut, operandIn, offsets, backend, groupRange);
+            }
+        } else {
+            if (backwards) {
+                return apply<OperandType, OffsetType, BackendType, true, false, RobustDir>(operandOut, operandIn, offsets, backend, groupRange);
+            } else {
+                return apply<OperandType, OffsetType, BackendType, false, false, RobustDir>(operandOut, operandIn, offsets, backend, groupRange);
+            }
+        }
+    }
+
     /*!
      * Sets rows that will be skipped when applying the operator.
      * @note each row group shall have at least one row that is not ignored
@@ -161,17 +203,22 @@ class ValueIterationOperator {
    private:
     /*!
      * Internal variant of `apply`
+     * @param groupRange if given, only the row groups from the first to the second (excluded) entry are processed. The third and fourth entry
+     *                   indicate where the entries of these row groups start in matrixColumns and matrixValues, respectively
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
     template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection>
-    bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+    bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend,
+               std::optional<std::tuple<IndexType, IndexType, uint64_t, uint64_t>> const& groupRange = {}) const {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
+        auto const [firstGroup, endGroup, columnPosition, valuePosition] =
+            groupRange.value_or(std::tuple<IndexType, IndexType, uint64_t, uint64_t>(0, operandSize, 0, 0));
         backend.startNewIteration();
-        auto matrixValueIt = matrixValues.cbegin();
-        auto matrixColumnIt = matrixColumns.cbegin();
-        for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
+        auto matrixValueIt = matrixValues.cbegin() + valuePosition;
+        auto matrixColumnIt = matrixColumns.cbegin() + columnPosition;
+        for (auto groupIndex : indexRange<Backward>(firstGroup, endGroup)) {
             STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
             STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
             //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
@@ -199,8 +246,11 @@ class ValueIterationOperator {
                 return backend.converged();
             }
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        // Only the row groups that are processed last reach the end of the matrix
+        STORM_LOG_ASSERT((Backward ? firstGroup != 0 : endGroup != operandSize) || matrixColumnIt + 1 == matrixColumns.cend(),
+                         "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT((Backward ? firstGroup != 0 : endGroup != operandSize) || matrixValueIt == matrixValues.cend(),
+                         "Unexpected position of matrix column iterator.");
         backend.endOfIteration();
         return backend.converged();
     }
@@ -224,6 +274,12 @@ class ValueIterationOperator {
         return {(*offsets.first)[offsetIndex], offsets.second};
     }
 
+    template<typename OpT1, typename OpT2, typename OffT1, typename OffT2>
+    std::pair<OpT1, OpT2> initializeRowRes(std::pair<std::vector<OpT1>, std::vector<OpT2>> const&,
+                                           std::pair<std::vector<OffT1> const*, std::vector<OffT2> const*> const& offsets, uint64_t offsetIndex) const {
+        return {(*offsets.first)[offsetIndex], (*offsets.second)[offsetIndex]};
+    }
+
     template<OptimizationDirection RobustDirection, typename OpT, typename OffT>
     OpT robustInitializeRowRes(std::vector<OpT> const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
         return offsets[offsetIndex].upper();
@@ -391,6 +447,21 @@ class ValueIterationOperator {
      */
     std::vector<IndexType> const* rowGroupIndices;
 
+    /*!
+     * A set of row groups that are processed consecutively together with the positions of their first entries in matrixColumns and matrixValues.
+     */
+    struct Partition {
+        IndexType firstGroup;
+        IndexType endGroup;
+        uint64_t columnPosition;
+        uint64_t valuePosition;
+    };
+
+    /*!
+     * The partitions of the row groups (if set)
+     */
+    std::vector<Partition> partitions;
+
     /*!
      * True iff the matrix was set in backward orders
      */
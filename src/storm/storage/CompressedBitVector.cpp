@@ -0,0 +1,487 @@
+#include "storm/storage/CompressedBitVector.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+const uint64_t CompressedBitVector::chunkSize;
+const uint64_t CompressedBitVector::wordsPerChunk;
+const uint64_t CompressedBitVector::maximalArrayCardinality;
+
+namespace {
+// Counts the number of maximal intervals of set bits in the given bitmap.
+uint64_t getNumberOfRuns(std::vector<uint64_t> const& bitmap) {
+    uint64_t numberOfRuns = 0;
+    uint64_t previousWord = 0;
+    for (uint64_t word : bitmap) {
+        // A run starts at every set bit whose predecessor is not set.
+        numberOfRuns += __builtin_popcountll(word & ~((word << 1) | (previousWord >> 63)));
+        previousWord = word;
+    }
+    return numberOfRuns;
+}
+
+// Returns true if a run container is smaller than both an array and a bitmap container.
+bool isRunContainerSmallest(uint64_t cardinality, uint64_t numberOfRuns) {
+    // Array containers need 2 bytes per set bit, bitmaps need 8 KB and run containers need 4 bytes per run.
+    return 4 * numberOfRuns < std::min<uint64_t>(2 * cardinality, 8192);
+}
+}  // namespace
+
+CompressedBitVector::Container CompressedBitVector::Container::fromBitmap(uint64_t key, std::vector<uint64_t> const& bitmap) {
+    STORM_LOG_ASSERT(bitmap.size() == wordsPerChunk, "Unexpected size of bitmap.");
+    Container result;
+    result.key = key;
+    result.cardinality = 0;
+    for (uint64_t word : bitmap) {
+        result.cardinality += __builtin_popcountll(word);
+    }
+    uint64_t numberOfRuns = getNumberOfRuns(bitmap);
+    if (isRunContainerSmallest(result.cardinality, numberOfRuns)) {
+        result.type = Type::Run;
+        result.values.reserve(2 * numberOfRuns);
+        auto isSet = [&bitmap](uint64_t index) { return index < chunkSize && ((bitmap[index >> 6] >> (index & 63)) & 1ull); };
+        for (uint64_t lowBits = 0; lowBits < chunkSize; ++lowBits) {
+            if (isSet(lowBits)) {
+                uint64_t runEnd = lowBits;
+                while (isSet(runEnd + 1)) {
+                    ++runEnd;
+                }
+                result.values.push_back(static_cast<uint16_t>(lowBits));
+                result.values.push_back(static_cast<uint16_t>(runEnd - lowBits));
+                lowBits = runEnd;
+            }
+        }
+    } else if (result.cardinality <= maximalArrayCardinality) {
+        result.type = Type::Array;
+        result.values.reserve(result.cardinality);
+        for (uint64_t wordIndex = 0; wordIndex < wordsPerChunk; ++wordIndex) {
+            for (uint64_t word = bitmap[wordIndex]; word != 0; word &= word - 1) {
+                result.values.push_back(static_cast<uint16_t>((wordIndex << 6) + __builtin_ctzll(word)));
+            }
+        }
+    } else {
+        result.type = Type::Bitmap;
+        result.words = bitmap;
+    }
+    return result;
+}
+
+CompressedBitVector::Container CompressedBitVector::Container::fromSortedValues(uint64_t key, std::vector<uint16_t>&& sortedValues) {
+    uint64_t numberOfRuns = 0;
+    for (uint64_t index = 0; index < sortedValues.size(); ++index) {
+        if (index == 0 || sortedValues[index - 1] + 1 != sortedValues[index]) {
+            ++numberOfRuns;
+        }
+    }
+    if (isRunContainerSmallest(sortedValues.size(), numberOfRuns) || sortedValues.size() > maximalArrayCardinality) {
+        std::vector<uint64_t> bitmap(wordsPerChunk, 0);
+        for (uint64_t value : sortedValues) {
+            bitmap[value >> 6] |= 1ull << (value & 63);
+        }
+        return fromBitmap(key, bitmap);
+    }
+    Container result;
+    result.key = key;
+    result.type = Type::Array;
+    result.cardinality = sortedValues.size();
+    result.values = std::move(sortedValues);
+    return result;
+}
+
+CompressedBitVector::Container CompressedBitVector::Container::fromFullRange(uint64_t key, uint64_t numberOfBits) {
+    STORM_LOG_ASSERT(numberOfBits > 0 && numberOfBits <= chunkSize, "Invalid number of bits.");
+    Container result;
+    result.key = key;
+    result.type = Type::Run;
+    result.cardinality = numberOfBits;
+    result.values = {0, static_cast<uint16_t>(numberOfBits - 1)};
+    return result;
+}
+
+bool CompressedBitVector::Container::contains(uint64_t lowBits) const {
+    return getNextSetIndex(lowBits) == lowBits;
+}
+
+uint64_t CompressedBitVector::Container::getNextSetIndex(uint64_t lowBits) const {
+    if (lowBits >= chunkSize) {
+        return chunkSize;
+    }
+    switch (type) {
+        case Type::Array: {
+            auto it = std::lower_bound(values.begin(), values.end(), lowBits);
+            return it == values.end() ? chunkSize : *it;
+        }
+        case Type::Bitmap: {
+            uint64_t wordIndex = lowBits >> 6;
+            uint64_t word = words[wordIndex] & (~0ull << (lowBits & 63));
+            while (word == 0) {
+                if (++wordIndex == wordsPerChunk) {
+                    return chunkSize;
+                }
+                word = words[wordIndex];
+            }
+            return (wordIndex << 6) + __builtin_ctzll(word);
+        }
+        case Type::Run: {
+            // Find the first run that ends at or after the given index.
+            uint64_t lower = 0;
+            uint64_t upper = values.size() / 2;
+            while (lower < upper) {
+                uint64_t middle = (lower + upper) / 2;
+                if (static_cast<uint64_t>(values[2 * middle]) + values[2 * middle + 1] < lowBits) {
+                    lower = middle + 1;
+                } else {
+                    upper = middle;
+                }
+            }
+            return lower == values.size() / 2 ? chunkSize : std::max<uint64_t>(values[2 * lower], lowBits);
+        }
+    }
+    STORM_LOG_ASSERT(false, "Unknown container type.");
+    return chunkSize;
+}
+
+std::vector<uint64_t> CompressedBitVector::Container::toBitmap() const {
+    if (type == Type::Bitmap) {
+        return words;
+    }
+    std::vector<uint64_t> bitmap(wordsPerChunk, 0);
+    if (type == Type::Array) {
+        for (uint64_t value : values) {
+            bitmap[value >> 6] |= 1ull << (value & 63);
+        }
+    } else {
+        for (uint64_t run = 0; run < values.size(); run += 2) {
+            uint64_t const runEnd = static_cast<uint64_t>(values[run]) + values[run + 1];
+            for (uint64_t value = values[run]; value <= runEnd; ++value) {
+                bitmap[value >> 6] |= 1ull << (value & 63);
+            }
+        }
+    }
+    return bitmap;
+}
+
+void CompressedBitVector::Container::set(uint64_t lowBits, bool value) {
+    STORM_LOG_ASSERT(type != Type::Run, "Run containers can not be modified.");
+    STORM_LOG_ASSERT(contains(lowBits) != value, "The bit already has the given value.");
+    if (type == Type::Array) {
+        auto it = std::lower_bound(values.begin(), values.end(), lowBits);
+        if (value) {
+            values.insert(it, static_cast<uint16_t>(lowBits));
+            ++cardinality;
+            if (cardinality > maximalArrayCardinality) {
+                words = toBitmap();
+                values = std::vector<uint16_t>();
+                type = Type::Bitmap;
+            }
+        } else {
+            values.erase(it);
+            --cardinality;
+        }
+    } else {
+        if (value) {
+            words[lowBits >> 6] |= 1ull << (lowBits & 63);
+            ++cardinality;
+        } else {
+            words[lowBits >> 6] &= ~(1ull << (lowBits & 63));
+            --cardinality;
+            if (cardinality <= maximalArrayCardinality) {
+                *this = fromBitmap(key, words);
+            }
+        }
+    }
+}
+
+bool CompressedBitVector::Container::operator==(Container const& other) const {
+    if (key != other.key || cardinality != other.cardinality) {
+        return false;
+    }
+    if (type == other.type) {
+        return values == other.values && words == other.words;
+    }
+    return toBitmap() == other.toBitmap();
+}
+
+CompressedBitVector::const_iterator::const_iterator(CompressedBitVector const& bitVector, uint64_t containerIndex)
+    : bitVector(&bitVector), containerIndex(containerIndex), currentIndex(0) {
+    moveToFirstSetBitOfContainer();
+}
+
+void CompressedBitVector::const_iterator::moveToFirstSetBitOfContainer() {
+    if (containerIndex < bitVector->containers.size()) {
+        Container const& container = bitVector->containers[containerIndex];
+        currentIndex = container.key * chunkSize + container.getNextSetIndex(0);
+    } else {
+        currentIndex = 0;
+    }
+}
+
+CompressedBitVector::const_iterator& CompressedBitVector::const_iterator::operator++() {
+    Container const& container = bitVector->containers[containerIndex];
+    uint64_t nextLowBits = container.getNextSetIndex(currentIndex % chunkSize + 1);
+    if (nextLowBits < chunkSize) {
+        currentIndex = container.key * chunkSize + nextLowBits;
+    } else {
+        ++containerIndex;
+        moveToFirstSetBitOfContainer();
+    }
+    return *this;
+}
+
+uint64_t CompressedBitVector::const_iterator::operator*() const {
+    return currentIndex;
+}
+
+bool CompressedBitVector::const_iterator::operator==(const_iterator const& other) const {
+    return containerIndex == other.containerIndex && currentIndex == other.currentIndex;
+}
+
+bool CompressedBitVector::const_iterator::operator!=(const_iterator const& other) const {
+    return !(*this == other);
+}
+
+CompressedBitVector::CompressedBitVector() : bitCount(0) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(uint64_t length, bool init) : bitCount(length) {
+    if (init) {
+        for (uint64_t key = 0; key * chunkSize < length; ++key) {
+            containers.push_back(Container::fromFullRange(key, std::min(chunkSize, length - key * chunkSize)));
+        }
+    }
+}
+
+CompressedBitVector::CompressedBitVector(BitVector const& bitVector) : bitCount(bitVector.size()) {
+    std::vector<uint16_t> chunkValues;
+    uint64_t currentKey = 0;
+    for (auto index : bitVector) {
+        if (index / chunkSize != currentKey && !chunkValues.empty()) {
+            containers.push_back(Container::fromSortedValues(currentKey, std::move(chunkValues)));
+            chunkValues = std::vector<uint16_t>();
+        }
+        currentKey = index / chunkSize;
+        chunkValues.push_back(static_cast<uint16_t>(index % chunkSize));
+    }
+    if (!chunkValues.empty()) {
+        containers.push_back(Container::fromSortedValues(currentKey, std::move(chunkValues)));
+    }
+}
+
+BitVector CompressedBitVector::toBitVector() const {
+    BitVector result(bitCount);
+    for (auto const& container : containers) {
+        uint64_t const offset = container.key * chunkSize;
+        if (container.type == Container::Type::Run) {
+            for (uint64_t run = 0; run < container.values.size(); run += 2) {
+                result.setMultiple(offset + container.values[run], container.values[run + 1] + 1ull);
+            }
+        } else {
+            for (uint64_t lowBits = container.getNextSetIndex(0); lowBits < chunkSize; lowBits = container.getNextSetIndex(lowBits + 1)) {
+                result.set(offset + lowBits);
+            }
+        }
+    }
+    return result;
+}
+
+bool CompressedBitVector::operator==(CompressedBitVector const& other) const {
+    return bitCount == other.bitCount && containers == other.containers;
+}
+
+bool CompressedBitVector::operator!=(CompressedBitVector const& other) const {
+    return !(*this == other);
+}
+
+bool CompressedBitVector::get(uint64_t index) const {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to CompressedBitVector::get: written index " << index << " out of bounds.");
+    uint64_t containerIndex = getContainerIndex(index / chunkSize);
+    return containerIndex < containers.size() && containers[containerIndex].key == index / chunkSize &&
+           containers[containerIndex].contains(index % chunkSize);
+}
+
+void CompressedBitVector::set(uint64_t index, bool value) {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to CompressedBitVector::set: written index " << index << " out of bounds.");
+    uint64_t const key = index / chunkSize;
+    uint64_t const lowBits = index % chunkSize;
+    uint64_t containerIndex = getContainerIndex(key);
+    if (containerIndex == containers.size() || containers[containerIndex].key != key) {
+        if (value) {
+            containers.insert(containers.begin() + containerIndex, Container::fromSortedValues(key, {static_cast<uint16_t>(lowBits)}));
+        }
+        return;
+    }
+
+    Container& container = containers[containerIndex];
+    if (container.contains(lowBits) == value) {
+        return;
+    }
+    if (container.cardinality == 1 && !value) {
+        containers.erase(containers.begin() + containerIndex);
+        return;
+    }
+    if (container.type == Container::Type::Run) {
+        // Runs are not modified in place. Instead, the container is converted into an array or bitmap container.
+        std::vector<uint64_t> bitmap = container.toBitmap();
+        bitmap[lowBits >> 6] ^= 1ull << (lowBits & 63);
+        container = Container::fromBitmap(key, bitmap);
+    } else {
+        container.set(lowBits, value);
+    }
+}
+
+CompressedBitVector CompressedBitVector::operator&(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    CompressedBitVector result;
+    result.bitCount = bitCount;
+    auto first = containers.begin();
+    auto second = other.containers.begin();
+    while (first != containers.end() && second != other.containers.end()) {
+        if (first->key < second->key) {
+            ++first;
+        } else if (second->key < first->key) {
+            ++second;
+        } else {
+            if (first->type == Container::Type::Array && second->type == Container::Type::Array) {
+                std::vector<uint16_t> intersection;
+                std::set_intersection(first->values.begin(), first->values.end(), second->values.begin(), second->values.end(),
+                                      std::back_inserter(intersection));
+                if (!intersection.empty()) {
+                    result.containers.push_back(Container::fromSortedValues(first->key, std::move(intersection)));
+                }
+            } else {
+                std::vector<uint64_t> bitmap = first->toBitmap();
+                std::vector<uint64_t> otherBitmap = second->toBitmap();
+                bool nonEmpty = false;
+                for (uint64_t wordIndex = 0; wordIndex < wordsPerChunk; ++wordIndex) {
+                    bitmap[wordIndex] &= otherBitmap[wordIndex];
+                    nonEmpty |= bitmap[wordIndex] != 0;
+                }
+                if (nonEmpty) {
+                    result.containers.push_back(Container::fromBitmap(first->key, bitmap));
+                }
+            }
+            ++first;
+            ++second;
+        }
+    }
+    return result;
+}
+
+CompressedBitVector CompressedBitVector::operator|(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    CompressedBitVector result;
+    result.bitCount = bitCount;
+    auto first = containers.begin();
+    auto second = other.containers.begin();
+    while (first != containers.end() || second != other.containers.end()) {
+        if (second == other.containers.end() || (first != containers.end() && first->key < second->key)) {
+            result.containers.push_back(*first);
+            ++first;
+        } else if (first == containers.end() || second->key < first->key) {
+            result.containers.push_back(*second);
+            ++second;
+        } else {
+            if (first->type == Container::Type::Array && second->type == Container::Type::Array) {
+                std::vector<uint16_t> combined;
+                std::set_union(first->values.begin(), first->values.end(), second->values.begin(), second->values.end(), std::back_inserter(combined));
+                result.containers.push_back(Container::fromSortedValues(first->key, std::move(combined)));
+            } else {
+                std::vector<uint64_t> bitmap = first->toBitmap();
+                std::vector<uint64_t> otherBitmap = second->toBitmap();
+                for (uint64_t wordIndex = 0; wordIndex < wordsPerChunk; ++wordIndex) {
+                    bitmap[wordIndex] |= otherBitmap[wordIndex];
+                }
+                result.containers.push_back(Container::fromBitmap(first->key, bitmap));
+            }
+            ++first;
+            ++second;
+        }
+    }
+    return result;
+}
+
+CompressedBitVector CompressedBitVector::operator~() const {
+    CompressedBitVector result;
+    result.bitCount = bitCount;
+    auto containerIt = containers.begin();
+    for (uint64_t key = 0; key * chunkSize < bitCount; ++key) {
+        uint64_t const numberOfBits = std::min(chunkSize, bitCount - key * chunkSize);
+        if (containerIt == containers.end() || containerIt->key != key) {
+            // Chunks without set bits become full.
+            result.containers.push_back(Container::fromFullRange(key, numberOfBits));
+            continue;
+        }
+        if (containerIt->cardinality < numberOfBits) {
+            std::vector<uint64_t> bitmap = containerIt->toBitmap();
+            for (uint64_t wordIndex = 0; wordIndex < wordsPerChunk; ++wordIndex) {
+                bitmap[wordIndex] = ~bitmap[wordIndex];
+            }
+            // Clear the bits beyond the length of the bit vector.
+            for (uint64_t lowBits = numberOfBits; lowBits < chunkSize; ++lowBits) {
+                bitmap[lowBits >> 6] &= ~(1ull << (lowBits & 63));
+            }
+            result.containers.push_back(Container::fromBitmap(key, bitmap));
+        }
+        ++containerIt;
+    }
+    return result;
+}
+
+bool CompressedBitVector::empty() const {
+    return containers.empty();
+}
+
+bool CompressedBitVector::full() const {
+    return getNumberOfSetBits() == bitCount;
+}
+
+uint64_t CompressedBitVector::getNumberOfSetBits() const {
+    uint64_t result = 0;
+    for (auto const& container : containers) {
+        result += container.cardinality;
+    }
+    return result;
+}
+
+uint64_t CompressedBitVector::size() const {
+    return bitCount;
+}
+
+std::size_t CompressedBitVector::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + containers.capacity() * sizeof(Container);
+    for (auto const& container : containers) {
+        result += container.values.capacity() * sizeof(uint16_t) + container.words.capacity() * sizeof(uint64_t);
+    }
+    return result;
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::begin() const {
+    return const_iterator(*this, 0);
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::end() const {
+    return const_iterator(*this, containers.size());
+}
+
+uint64_t CompressedBitVector::getContainerIndex(uint64_t key) const {
+    auto it = std::lower_bound(containers.begin(), containers.end(), key, [](Container const& container, uint64_t key) { return container.key < key; });
+    return std::distance(containers.begin(), it);
+}
+
+std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector) {
+    out << "compressed bit vector(" << bitVector.getNumberOfSetBits() << "/" << bitVector.size() << ") [";
+    for (auto index : bitVector) {
+        out << index << " ";
+    }
+    out << "]";
+    return out;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A bit vector that is represented compactly if only few bits are set (or if the set bits form few intervals). Following the idea of Roaring bitmaps, the
+ * indices are partitioned into chunks of 2^16 consecutive indices. Each chunk with at least one set bit is stored in a container, which is either a sorted
+ * array of the set indices, a bitmap or a sorted list of runs of consecutive set indices. Chunks without set bits do not occupy any memory.
+ */
+class CompressedBitVector {
+   public:
+    /*!
+     * A class that enables iterating over the indices of the bit vector whose corresponding bits are set to true. The indices are iterated over from
+     * smallest to largest.
+     */
+    class const_iterator {
+        // Declare the CompressedBitVector class as a friend class to access its internal storage.
+        friend class CompressedBitVector;
+
+       public:
+        // Define iterator
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = uint64_t*;
+        using reference = uint64_t&;
+
+        /*!
+         * Increases the position of the iterator to the position of the next bit that is set to true in the underlying bit vector.
+         *
+         * @return A reference to this iterator.
+         */
+        const_iterator& operator++();
+
+        /*!
+         * Returns the index of the current bit to which this iterator points.
+         */
+        uint64_t operator*() const;
+
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+
+       private:
+        /*!
+         * Constructs an iterator that points to the first set bit of the container with the given index (or to the end if there is no such container).
+         */
+        const_iterator(CompressedBitVector const& bitVector, uint64_t containerIndex);
+
+        // Moves to the first set bit of the current container or to the end if there is no further container.
+        void moveToFirstSetBitOfContainer();
+
+        CompressedBitVector const* bitVector;
+        uint64_t containerIndex;
+        uint64_t currentIndex;
+    };
+
+    /*!
+     * Constructs an empty bit vector of length 0.
+     */
+    CompressedBitVector();
+
+    /*!
+     * Constructs a bit vector which can hold the given number of bits and initializes all bits with the provided truth value.
+     *
+     * @param length The number of bits the bit vector should be able to hold.
+     * @param init The initial value of the bits.
+     */
+    explicit CompressedBitVector(uint64_t length, bool init = false);
+
+    /*!
+     * Constructs a compressed bit vector with the same length and set bits as the given bit vector.
+     */
+    explicit CompressedBitVector(BitVector const& bitVector);
+
+    /*!
+     * Converts this bit vector into an (uncompressed) bit vector.
+     */
+    BitVector toBitVector() const;
+
+    /*!
+     * Compares the given bit vector with the current one.
+     *
+     * @return True iff both bit vectors have the same length and the same bits are set.
+     */
+    bool operator==(CompressedBitVector const& other) const;
+    bool operator!=(CompressedBitVector const& other) const;
+
+    /*!
+     * Retrieves the truth value of the bit at the given index.
+     */
+    bool get(uint64_t index) const;
+
+    /*!
+     * Sets the given truth value at the given index.
+     */
+    void set(uint64_t index, bool value = true);
+
+    /*!
+     * Performs a logical "and" with the given bit vector of the same length.
+     */
+    CompressedBitVector operator&(CompressedBitVector const& other) const;
+
+    /*!
+     * Performs a logical "or" with the given bit vector of the same length.
+     */
+    CompressedBitVector operator|(CompressedBitVector const& other) const;
+
+    /*!
+     * Performs a logical "not" on the bit vector.
+     */
+    CompressedBitVector operator~() const;
+
+    /*!
+     * Retrieves whether no bits are set to true in this bit vector.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves whether all bits are set in this bit vector.
+     */
+    bool full() const;
+
+    /*!
+     * Returns the number of bits that are set to true in this bit vector.
+     */
+    uint64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves the number of bits this bit vector can store.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Returns the size of the bit vector in memory measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
+    /*!
+     * Returns an iterator to the indices of the set bits in the bit vector.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Returns an iterator pointing at the element past the back of the bit vector.
+     */
+    const_iterator end() const;
+
+    friend std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector);
+
+   private:
+    // The number of indices per chunk.
+    static const uint64_t chunkSize = 1ull << 16;
+    // The number of 64-bit words of the bitmap of a chunk.
+    static const uint64_t wordsPerChunk = chunkSize / 64;
+    // The maximal number of set bits of array containers. Array containers with more set bits would be larger than a bitmap.
+    static const uint64_t maximalArrayCardinality = 4096;
+
+    /*!
+     * Stores the set bits of one chunk.
+     */
+    struct Container {
+        enum class Type : uint8_t { Array, Bitmap, Run };
+
+        /*!
+         * Creates a container with the smallest representation of the given bitmap, which needs to consist of wordsPerChunk words.
+         */
+        static Container fromBitmap(uint64_t key, std::vector<uint64_t> const& bitmap);
+
+        /*!
+         * Creates a container with the smallest representation of the given (sorted) indices of a chunk.
+         */
+        static Container fromSortedValues(uint64_t key, std::vector<uint16_t>&& sortedValues);
+
+        /*!
+         * Creates a run container for the first numberOfBits indices of a chunk.
+         */
+        static Container fromFullRange(uint64_t key, uint64_t numberOfBits);
+
+        bool contains(uint64_t lowBits) const;
+
+        /*!
+         * Retrieves the smallest set index of the chunk that is at least the given one or chunkSize if there is none.
+         */
+        uint64_t getNextSetIndex(uint64_t lowBits) const;
+
+        /*!
+         * Retrieves the bitmap of this container.
+         */
+        std::vector<uint64_t> toBitmap() const;
+
+        /*!
+         * Sets the given bit of the chunk, where the container must not be a run container.
+         */
+        void set(uint64_t lowBits, bool value);
+
+        bool operator==(Container const& other) const;
+
+        // The index of the chunk, i.e., the first index of the chunk divided by the chunk size.
+        uint64_t key;
+        Type type;
+        // The number of set bits in the chunk.
+        uint64_t cardinality;
+        // Array containers store the sorted set indices (relative to the chunk) and run containers store pairs of the first index and the length minus one.
+        std::vector<uint16_t> values;
+        // Bitmap containers store the bits of the chunk.
+        std::vector<uint64_t> words;
+    };
+
+    // Retrieves the index of the first container whose key is at least the given one.
+    uint64_t getContainerIndex(uint64_t key) const;
+
+    // The containers of the chunks with at least one set bit, sorted by their keys.
+    std::vector<Container> containers;
+
+    // The number of bits that this bit vector can hold.
+    uint64_t bitCount;
+};
+
+std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector);
+
+}  // namespace storage
+}  // namespace storm
@@ -11,7 +11,7 @@
 namespace storm {
 namespace storage {
 template<typename ValueType>
-FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0) {
+FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0), trivialRowGrouping(true) {
     // Intentionally left empty.
 }
 
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
 
@@ -152,7 +153,8 @@ class Scheduler {
    private:
     boost::optional<storm::storage::MemoryStructure> memoryStructure;
     std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
-    std::vector<storm::storage::BitVector> dontCareStates;
+    // Typically only few states are don't care states, so they are stored compressed.
+    std::vector<storm::storage::CompressedBitVector> dontCareStates;
     uint_fast64_t numOfUndefinedChoices;
     uint_fast64_t numOfDeterministicChoices;
     uint_fast64_t numOfDontCareStates;
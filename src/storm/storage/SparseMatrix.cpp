@@ -1446,6 +1446,40 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_t
     return result;
 }
 
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRowGroupsAndColumns(std::vector<index_type> const& inverseRowGroupPermutation,
+                                                                            std::vector<index_type> const& columnPermutation) const {
+    STORM_LOG_ASSERT(inverseRowGroupPermutation.size() == this->getRowGroupCount(), "Row group permutation does not match the number of row groups.");
+    STORM_LOG_ASSERT(columnPermutation.size() == this->getColumnCount(), "Column permutation does not match the number of columns.");
+    bool const trivialRowGrouping = this->hasTrivialRowGrouping();
+    SparseMatrixBuilder<ValueType> matrixBuilder(this->getRowCount(), this->getColumnCount(), this->getEntryCount(), true, !trivialRowGrouping,
+                                                 trivialRowGrouping ? 0 : this->getRowGroupCount());
+
+    std::vector<MatrixEntry<index_type, value_type>> rowEntries;
+    index_type newRow = 0;
+    for (index_type newGroup = 0; newGroup < inverseRowGroupPermutation.size(); ++newGroup) {
+        index_type const oldGroup = inverseRowGroupPermutation[newGroup];
+        if (!trivialRowGrouping) {
+            matrixBuilder.newRowGroup(newRow);
+        }
+        index_type const startRow = trivialRowGrouping ? oldGroup : this->getRowGroupIndices()[oldGroup];
+        index_type const endRow = trivialRowGrouping ? oldGroup + 1 : this->getRowGroupIndices()[oldGroup + 1];
+        for (index_type oldRow = startRow; oldRow < endRow; ++oldRow, ++newRow) {
+            // Rename the columns and restore the order of the entries.
+            rowEntries.clear();
+            for (auto const& entry : this->getRow(oldRow)) {
+                rowEntries.emplace_back(columnPermutation[entry.getColumn()], entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(),
+                      [](MatrixEntry<index_type, value_type> const& a, MatrixEntry<index_type, value_type> const& b) { return a.getColumn() < b.getColumn(); });
+            for (auto const& entry : rowEntries) {
+                matrixBuilder.addNextValue(newRow, entry.getColumn(), entry.getValue());
+            }
+        }
+    }
+    return matrixBuilder.build();
+}
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool keepZeros) const {
     index_type rowCount = this->getColumnCount();
@@ -2619,6 +2653,13 @@ template bool SparseMatrix<double>::isSubmatrixOf(SparseMatrix<double> const& ma
 template class MatrixEntry<uint32_t, double>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<uint32_t, double> const& entry);
 
+// float
+template class MatrixEntry<typename SparseMatrix<float>::index_type, float>;
+template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<float>::index_type, float> const& entry);
+template class SparseMatrixBuilder<float>;
+template class SparseMatrix<float>;
+template std::ostream& operator<<(std::ostream& out, SparseMatrix<float> const& matrix);
+
 // int
 template class MatrixEntry<typename SparseMatrix<int>::index_type, int>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<int>::index_type, int> const& entry);
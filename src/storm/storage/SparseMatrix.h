@@ -762,6 +762,19 @@ class SparseMatrix {
      */
     SparseMatrix permuteRows(std::vector<index_type> const& inversePermutation) const;
 
+    /*!
+     * Permutes the row groups and the columns of the matrix.
+     * That is, row group i of the result consists of the rows of row group inverseRowGroupPermutation[i] (in their original order) and an entry in
+     * column j is moved to column columnPermutation[j]. The entries of each row are sorted with respect to their new columns.
+     * For square matrices, using the inverse of inverseRowGroupPermutation as columnPermutation renames the states of the underlying model.
+     *
+     * @param inverseRowGroupPermutation For each new row group, the index of the original row group. Must be a permutation.
+     * @param columnPermutation For each original column, the index of the new column. Must be a permutation.
+     *
+     * @note The resulting matrix has a trivial row grouping iff this matrix has a trivial row grouping.
+     */
+    SparseMatrix permuteRowGroupsAndColumns(std::vector<index_type> const& inverseRowGroupPermutation, std::vector<index_type> const& columnPermutation) const;
+
     /*!
      * Returns a copy of this matrix that only considers entries in the selected rows.
      * Non-selected rows will not have any entries
@@ -1,5 +1,6 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
@@ -7,6 +8,9 @@
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -1231,9 +1235,97 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+
+    // Only floating point values are processed concurrently as the arithmetic of exact number types is not necessarily thread-safe.
+    if (std::is_same<ValueType, double>::value && rowOdd.getTotalOffset() >= 1024 &&
+        storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+#ifdef STORM_HAVE_INTELTBB
+        // Subtrees that are reached via different row encodings write to disjoint rows and can therefore be translated concurrently. Descending a few
+        // levels yields enough subtrees to keep all threads busy.
+        uint_fast64_t splitLevel = std::min<uint_fast64_t>(ddRowVariableIndices.size(), 8);
+        std::vector<std::vector<MatrixComponentsTask>> tasks(1ull << splitLevel);
+        collectMatrixComponentsTasks(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowOdd, columnOdd, 0,
+                                     splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, tasks.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t rowPrefix = range.begin(); rowPrefix < range.end(); ++rowPrefix) {
+                for (auto const& task : tasks[rowPrefix]) {
+                    toMatrixComponentsRec(task.dd, task.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel,
+                                          splitLevel, maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                }
+            }
+        });
+        return;
+#endif
+    }
+
+    toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications,
+                          columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+}
+
+template<typename ValueType>
+std::array<MTBDD, 4> InternalAdd<DdType::Sylvan, ValueType>::getMatrixSuccessors(MTBDD dd, uint_fast64_t currentLevel,
+                                                                                 std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices) {
+    MTBDD elseElse;
+    MTBDD elseThen;
+    MTBDD thenElse;
+    MTBDD thenThen;
+
+    if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (ddRowVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+        elseElse = thenElse = mtbdd_getlow(dd);
+        elseThen = thenThen = mtbdd_gethigh(dd);
+    } else {
+        MTBDD elseNode = mtbdd_getlow(dd);
+        if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = mtbdd_getlow(elseNode);
+            elseThen = mtbdd_gethigh(elseNode);
+        }
+
+        MTBDD thenNode = mtbdd_gethigh(dd);
+        if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = mtbdd_getlow(thenNode);
+            thenThen = mtbdd_gethigh(thenNode);
+        }
+    }
+
+    return {elseElse, elseThen, thenElse, thenThen};
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::collectMatrixComponentsTasks(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd,
+                                                                          uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t rowPrefix,
+                                                                          uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                          std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                          std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                                                                          std::vector<std::vector<MatrixComponentsTask>>& tasks) const {
+    // Neither the empty DD nor rows that are not encoded by the ODD contribute any entries.
+    if ((mtbdd_isleaf(dd) && mtbdd_iszero(dd)) || rowOdd.getTotalOffset() == 0) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        tasks[rowPrefix].push_back({dd, negated, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+    } else {
+        // The successors are visited in the same order as in toMatrixComponentsRec, so the entries of each row are still sorted by column.
+        std::array<MTBDD, 4> successors = getMatrixSuccessors(dd, currentLevel, ddRowVariableIndices, ddColumnVariableIndices);
+        for (uint_fast64_t index = 0; index < 4; ++index) {
+            bool thenRow = index >= 2;
+            bool thenColumn = index % 2 == 1;
+            collectMatrixComponentsTasks(mtbdd_regular(successors[index]), mtbdd_hascomp(successors[index]) ^ negated,
+                                         thenRow ? rowOdd.getThenSuccessor() : rowOdd.getElseSuccessor(),
+                                         thenColumn ? columnOdd.getThenSuccessor() : columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel,
+                                         (rowPrefix << 1) | (thenRow ? 1 : 0), currentRowOffset + (thenRow ? rowOdd.getElseOffset() : 0),
+                                         currentColumnOffset + (thenColumn ? columnOdd.getElseOffset() : 0), ddRowVariableIndices, ddColumnVariableIndices,
+                                         tasks);
+        }
+    }
 }
 
 template<typename ValueType>
@@ -1257,33 +1349,7 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         }
         ++rowIndications[rowGroupOffsets[currentRowOffset]];
     } else {
-        MTBDD elseElse;
-        MTBDD elseThen;
-        MTBDD thenElse;
-        MTBDD thenThen;
-
-        if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = thenElse = mtbdd_getlow(dd);
-            elseThen = thenThen = mtbdd_gethigh(dd);
-        } else {
-            MTBDD elseNode = mtbdd_getlow(dd);
-            if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = mtbdd_getlow(elseNode);
-                elseThen = mtbdd_gethigh(elseNode);
-            }
-
-            MTBDD thenNode = mtbdd_gethigh(dd);
-            if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = mtbdd_getlow(thenNode);
-                thenThen = mtbdd_gethigh(thenNode);
-            }
-        }
+        auto [elseElse, elseThen, thenElse, thenThen] = getMatrixSuccessors(dd, currentColumnLevel, ddRowVariableIndices, ddColumnVariableIndices);
 
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
@@ -1,6 +1,7 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANADD_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANADD_H_
 
+#include <array>
 #include <set>
 #include <unordered_map>
 
@@ -625,7 +626,8 @@ class InternalAdd<DdType::Sylvan, ValueType> {
                                                                                      std::vector<uint_fast64_t> const& ddGroupVariableIndices) const;
 
     /*!
-     * Translates the ADD into the components needed for constructing a matrix.
+     * Translates the ADD into the components needed for constructing a matrix. If Intel TBB is enabled, subtrees that belong to different rows are
+     * translated concurrently.
      *
      * @param rowGroupIndices The row group indices.
      * @param rowIndications The vector that is to be filled with the row indications.
@@ -781,6 +783,39 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     static MTBDD fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<ValueType> const& values,
                                Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
 
+    /*!
+     * A subtree of the DD together with its position in the matrix. Used to translate the DD into a matrix concurrently.
+     */
+    struct MatrixComponentsTask {
+        MTBDD dd;
+        bool negated;
+        Odd const* rowOdd;
+        Odd const* columnOdd;
+        uint_fast64_t rowOffset;
+        uint_fast64_t columnOffset;
+    };
+
+    /*!
+     * Retrieves the else-else, else-then, then-else and then-then successors of the given node with respect to the row and column variable of the
+     * given level. The first part refers to the row variable and the second part to the column variable.
+     */
+    static std::array<MTBDD, 4> getMatrixSuccessors(MTBDD dd, uint_fast64_t currentLevel, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                    std::vector<uint_fast64_t> const& ddColumnVariableIndices);
+
+    /*!
+     * Collects the non-empty subtrees of the DD that are reached after the given number of levels. The subtrees are stored in the bucket that
+     * corresponds to the row encoding of the path that leads to them. Within a bucket, the subtrees are in the order in which toMatrixComponentsRec
+     * visits them, so translating the buckets independently yields the same matrix as the sequential translation.
+     *
+     * @param splitLevel The level at which the subtrees are collected.
+     * @param rowPrefix The row encoding of the path to the current node.
+     * @param tasks The buckets that receive the subtrees. There have to be 2^splitLevel buckets.
+     */
+    void collectMatrixComponentsTasks(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel,
+                                      uint_fast64_t rowPrefix, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                      std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                                      std::vector<std::vector<MatrixComponentsTask>>& tasks) const;
+
     /*!
      * Helper function to convert the DD into a (sparse) matrix.
      *
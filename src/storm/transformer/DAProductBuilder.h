@@ -38,6 +38,10 @@ class DAProductBuilder {
         return da.getSuccessor(automatonFrom, getLabelForState(modelTo));
     }
 
+    std::size_t getNumberOfAutomatonStates() const {
+        return da.getNumberOfStates();
+    }
+
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
 
 namespace storm {
 namespace transformer {
@@ -11,15 +16,18 @@ class Product {
 
     typedef storm::storage::sparse::state_type state_type;
     typedef std::pair<state_type, state_type> product_state_type;
-    typedef std::map<product_state_type, state_type> product_state_to_product_index_map;
+    // Maps the product states, encoded via encodeProductState, to their index.
+    typedef storm::storage::BitVectorHashMap<state_type> product_state_to_product_index_map;
     typedef std::vector<product_state_type> product_index_to_product_state_vector;
 
     Product(Model&& productModel, std::string&& productStateOfInterestLabel, product_state_to_product_index_map&& productStateToProductIndex,
-            product_index_to_product_state_vector&& productIndexToProductState)
-        : productModel(productModel),
-          productStateOfInterestLabel(productStateOfInterestLabel),
-          productStateToProductIndex(productStateToProductIndex),
-          productIndexToProductState(productIndexToProductState) {}
+            uint64_t bitsForModelStates, uint64_t bitsForProductStates, product_index_to_product_state_vector&& productIndexToProductState)
+        : productModel(std::move(productModel)),
+          productStateOfInterestLabel(std::move(productStateOfInterestLabel)),
+          productStateToProductIndex(std::move(productStateToProductIndex)),
+          bitsForModelStates(bitsForModelStates),
+          bitsForProductStates(bitsForProductStates),
+          productIndexToProductState(std::move(productIndexToProductState)) {}
 
     Product(Product<Model>&& product) = default;
     Product& operator=(Product<Model>&& product) = default;
@@ -37,11 +45,24 @@ class Product {
     }
 
     state_type getProductStateIndex(state_type modelState, state_type automatonState) const {
-        return productStateToProductIndex.at(product_state_type(modelState, automatonState));
+        storm::storage::BitVector key(bitsForProductStates);
+        encodeProductState(key, bitsForModelStates, modelState, automatonState);
+        return productStateToProductIndex.getValue(key);
     }
 
     bool isValidProductState(state_type modelState, state_type automatonState) const {
-        return (productStateToProductIndex.count(product_state_type(modelState, automatonState)) > 0);
+        storm::storage::BitVector key(bitsForProductStates);
+        encodeProductState(key, bitsForModelStates, modelState, automatonState);
+        return productStateToProductIndex.contains(key);
+    }
+
+    /*!
+     * Encodes the given product state as key of the product state to index map: The first bits hold the model state, the remaining bits of the key hold
+     * the automaton state.
+     */
+    static void encodeProductState(storm::storage::BitVector& key, uint64_t bitsForModelStates, state_type modelState, state_type automatonState) {
+        key.setFromInt(0, bitsForModelStates, modelState);
+        key.setFromInt(bitsForModelStates, key.size() - bitsForModelStates, automatonState);
     }
 
     storm::storage::BitVector liftFromAutomaton(const storm::storage::BitVector& vector) const {
@@ -96,6 +117,8 @@ class Product {
     Model productModel;
     std::string productStateOfInterestLabel;
     product_state_to_product_index_map productStateToProductIndex;
+    uint64_t bitsForModelStates;
+    uint64_t bitsForProductStates;
     product_index_to_product_state_vector productIndexToProductState;
 };
 }  // namespace transformer
@@ -3,9 +3,10 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/transformer/Product.h"
 
+#include <algorithm>
 #include <deque>
-#include <map>
 #include <vector>
 
 namespace storm {
@@ -24,8 +25,13 @@ class ProductBuilder {
         typedef storm::storage::sparse::state_type state_type;
         typedef std::pair<state_type, state_type> product_state_type;
 
+        // The product states are stored with as few bits as possible, as the index of the reachable product states can get large.
+        uint64_t bitsForModelStates = getNumberOfBits(originalMatrix.getRowGroupCount());
+        uint64_t bitsForProductStates = bitsForModelStates + getNumberOfBits(prodOp.getNumberOfAutomatonStates());
+
         state_type nextState = 0;
-        std::map<product_state_type, state_type> productStateToProductIndex;
+        typename Product<Model>::product_state_to_product_index_map productStateToProductIndex(
+            bitsForProductStates, std::max<uint64_t>(1000, statesOfInterest.getNumberOfSetBits()));
         std::vector<product_state_type> productIndexToProductState;
         std::vector<state_type> prodInitial;
 
@@ -34,17 +40,23 @@ class ProductBuilder {
         // use of the SparseMatrixBuilder that can only handle linear addNextValue
         // calls
         std::deque<state_type> todo;
-        for (state_type s_0 : statesOfInterest) {
-            state_type q_0 = prodOp.getInitialState(s_0);
 
-            // std::cout << "Initial: " << s_0 << ", " << q_0 << " = " << nextState << "\n";
+        // Retrieves the index of the given product state and schedules the state for exploration if it is new.
+        storm::storage::BitVector productStateKey(bitsForProductStates);
+        auto findOrAddProductState = [&](state_type modelState, state_type automatonState) {
+            Product<Model>::encodeProductState(productStateKey, bitsForModelStates, modelState, automatonState);
+            state_type index = productStateToProductIndex.findOrAdd(productStateKey, nextState);
+            if (index == nextState) {
+                ++nextState;
+                productIndexToProductState.emplace_back(modelState, automatonState);
+                todo.push_back(index);
+            }
+            return index;
+        };
 
-            product_state_type s_q(s_0, q_0);
-            state_type index = nextState++;
-            productStateToProductIndex[s_q] = index;
-            productIndexToProductState.push_back(s_q);
-            prodInitial.push_back(index);
-            todo.push_back(index);
+        for (state_type s_0 : statesOfInterest) {
+            state_type q_0 = prodOp.getInitialState(s_0);
+            prodInitial.push_back(findOrAddProductState(s_0, q_0));
         }
 
         storm::storage::SparseMatrixBuilder<typename Model::ValueType> builder(0, 0, 0, false, deterministic ? false : true, 0);
@@ -53,30 +65,13 @@ class ProductBuilder {
             state_type prodIndexFrom = todo.front();
             todo.pop_front();
 
-            product_state_type from = productIndexToProductState.at(prodIndexFrom);
-            // std::cout << "Handle " << from.first << "," << from.second << " (prodIndexFrom = " << prodIndexFrom << "):\n";
+            product_state_type from = productIndexToProductState[prodIndexFrom];
             if (deterministic) {
                 typename matrix_type::const_rows row = originalMatrix.getRow(from.first);
                 for (auto const& entry : row) {
                     state_type t = entry.getColumn();
                     state_type p = prodOp.getSuccessor(from.second, t);
-                    // std::cout << " p = " << p << "\n";
-                    product_state_type t_p(t, p);
-                    state_type prodIndexTo;
-                    auto it = productStateToProductIndex.find(t_p);
-                    if (it == productStateToProductIndex.end()) {
-                        prodIndexTo = nextState++;
-                        todo.push_back(prodIndexTo);
-                        productIndexToProductState.push_back(t_p);
-                        productStateToProductIndex[t_p] = prodIndexTo;
-                        // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                    } else {
-                        prodIndexTo = it->second;
-                    }
-                    // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                    // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                    builder.addNextValue(prodIndexFrom, prodIndexTo, entry.getValue());
+                    builder.addNextValue(prodIndexFrom, findOrAddProductState(t, p), entry.getValue());
                 }
             } else {
                 std::size_t numRows = originalMatrix.getRowGroupSize(from.first);
@@ -86,23 +81,7 @@ class ProductBuilder {
                     for (auto const& entry : row) {
                         state_type t = entry.getColumn();
                         state_type p = prodOp.getSuccessor(from.second, t);
-                        // std::cout << " p = " << p << "\n";
-                        product_state_type t_p(t, p);
-                        state_type prodIndexTo;
-                        auto it = productStateToProductIndex.find(t_p);
-                        if (it == productStateToProductIndex.end()) {
-                            prodIndexTo = nextState++;
-                            todo.push_back(prodIndexTo);
-                            productIndexToProductState.push_back(t_p);
-                            productStateToProductIndex[t_p] = prodIndexTo;
-                            // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                        } else {
-                            prodIndexTo = it->second;
-                        }
-                        // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                        // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                        builder.addNextValue(curRow, prodIndexTo, entry.getValue());
+                        builder.addNextValue(curRow, findOrAddProductState(t, p), entry.getValue());
                     }
                     curRow++;
                 }
@@ -118,11 +97,18 @@ class ProductBuilder {
         }
         std::string prodSoiLabel = product.getStateLabeling().addUniqueLabel("soi", productStatesOfInterest);
 
-        // const storm::models::sparse::StateLabeling& orignalLabels = dtmc->getStateLabeling();
-        // for (originalLabels.)
+        return typename Product<Model>::ptr(new Product<Model>(std::move(product), std::move(prodSoiLabel), std::move(productStateToProductIndex),
+                                                               bitsForModelStates, bitsForProductStates, std::move(productIndexToProductState)));
+    }
 
-        return typename Product<Model>::ptr(
-            new Product<Model>(std::move(product), std::move(prodSoiLabel), std::move(productStateToProductIndex), std::move(productIndexToProductState)));
+   private:
+    static uint64_t getNumberOfBits(uint64_t numberOfValues) {
+        uint64_t maximalValue = std::max<uint64_t>(numberOfValues, 1) - 1;
+        uint64_t bits = 1;
+        while ((maximalValue >> bits) > 0) {
+            ++bits;
+        }
+        return bits;
     }
 };
 }  // namespace transformer
@@ -0,0 +1,382 @@
+#include "storm/transformer/StatePermuter.h"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace transformer {
+
+std::string toString(StateOrder const& order) {
+    switch (order) {
+        case StateOrder::Bfs:
+            return "bfs";
+        case StateOrder::ReverseCuthillMcKee:
+            return "rcm";
+        case StateOrder::SccTopological:
+            return "scc";
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state order.");
+}
+
+StateOrder stateOrderFromString(std::string const& order) {
+    if (order == "bfs") {
+        return StateOrder::Bfs;
+    } else if (order == "rcm") {
+        return StateOrder::ReverseCuthillMcKee;
+    } else if (order == "scc") {
+        return StateOrder::SccTopological;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state order '" << order << "'.");
+}
+
+namespace detail {
+
+template<typename ValueType>
+std::vector<uint64_t> computeBfsOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<uint64_t> result;
+    result.reserve(numberOfStates);
+    storm::storage::BitVector visited(numberOfStates, false);
+
+    auto explore = [&](uint64_t firstUnexplored) {
+        // The states in result[firstUnexplored, result.size()) serve as the queue.
+        for (; firstUnexplored < result.size(); ++firstUnexplored) {
+            uint64_t const state = result[firstUnexplored];
+            for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                if (!visited.get(entry.getColumn())) {
+                    visited.set(entry.getColumn(), true);
+                    result.push_back(entry.getColumn());
+                }
+            }
+        }
+    };
+
+    for (auto state : initialStates) {
+        visited.set(state, true);
+        result.push_back(state);
+    }
+    explore(0);
+    // Unreachable states are appended in the order in which they are discovered from the remaining states.
+    for (uint64_t state = visited.getNextUnsetIndex(0); state < numberOfStates; state = visited.getNextUnsetIndex(state + 1)) {
+        uint64_t const firstUnexplored = result.size();
+        visited.set(state, true);
+        result.push_back(state);
+        explore(firstUnexplored);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> computeReverseCuthillMcKeeOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+
+    // Build the adjacency structure of the undirected graph underlying the transition relation (without self-loops).
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+    std::vector<uint64_t> neighborIndications;
+    neighborIndications.reserve(numberOfStates + 1);
+    neighborIndications.push_back(0);
+    std::vector<uint64_t> neighbors;
+    neighbors.reserve(transitionMatrix.getEntryCount() + backwardTransitions.getEntryCount());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        auto const first = neighbors.size();
+        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+            if (entry.getColumn() != state) {
+                neighbors.push_back(entry.getColumn());
+            }
+        }
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            if (entry.getColumn() != state) {
+                neighbors.push_back(entry.getColumn());
+            }
+        }
+        std::sort(neighbors.begin() + first, neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin() + first, neighbors.end()), neighbors.end());
+        neighborIndications.push_back(neighbors.size());
+    }
+    auto degree = [&neighborIndications](uint64_t state) { return neighborIndications[state + 1] - neighborIndications[state]; };
+    auto lessDegree = [&degree](uint64_t lhs, uint64_t rhs) { return degree(lhs) < degree(rhs); };
+
+    // Candidates for the start of a new connected component, sorted by increasing degree.
+    std::vector<uint64_t> startCandidates(numberOfStates);
+    std::iota(startCandidates.begin(), startCandidates.end(), 0);
+    std::stable_sort(startCandidates.begin(), startCandidates.end(), lessDegree);
+
+    std::vector<uint64_t> result;
+    result.reserve(numberOfStates);
+    storm::storage::BitVector visited(numberOfStates, false);
+    for (auto startState : startCandidates) {
+        if (visited.get(startState)) {
+            continue;
+        }
+        visited.set(startState, true);
+        result.push_back(startState);
+        for (uint64_t firstUnexplored = result.size() - 1; firstUnexplored < result.size(); ++firstUnexplored) {
+            uint64_t const state = result[firstUnexplored];
+            auto const firstNewNeighbor = result.size();
+            for (uint64_t i = neighborIndications[state]; i < neighborIndications[state + 1]; ++i) {
+                if (!visited.get(neighbors[i])) {
+                    visited.set(neighbors[i], true);
+                    result.push_back(neighbors[i]);
+                }
+            }
+            std::stable_sort(result.begin() + firstNewNeighbor, result.end(), lessDegree);
+        }
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> computeSccTopologicalOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<uint64_t> result;
+    result.reserve(transitionMatrix.getRowGroupCount());
+    for (auto const& scc : sccDecomposition) {
+        result.insert(result.end(), scc.begin(), scc.end());
+    }
+    return result;
+}
+
+}  // namespace detail
+
+template<typename ValueType>
+std::vector<uint64_t> computeStateOrder(StateOrder order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::BitVector const& initialStates) {
+    std::vector<uint64_t> result;
+    switch (order) {
+        case StateOrder::Bfs:
+            result = detail::computeBfsOrder(transitionMatrix, initialStates);
+            break;
+        case StateOrder::ReverseCuthillMcKee:
+            result = detail::computeReverseCuthillMcKeeOrder(transitionMatrix);
+            break;
+        case StateOrder::SccTopological:
+            result = detail::computeSccTopologicalOrder(transitionMatrix);
+            break;
+    }
+    STORM_LOG_ASSERT(result.size() == transitionMatrix.getRowGroupCount(), "The computed order does not cover all states.");
+    return result;
+}
+
+template<typename RewardModelType>
+RewardModelType transformRewardModel(RewardModelType const& originalRewardModel, std::vector<uint64_t> const& newToOldStates,
+                                     std::vector<uint64_t> const& newToOldChoices, std::vector<uint64_t> const& oldToNewStates) {
+    std::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
+    std::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
+    std::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
+    if (originalRewardModel.hasStateRewards()) {
+        stateRewardVector = storm::utility::vector::applyInversePermutation(newToOldStates, originalRewardModel.getStateRewardVector());
+    }
+    if (originalRewardModel.hasStateActionRewards()) {
+        stateActionRewardVector = storm::utility::vector::applyInversePermutation(newToOldChoices, originalRewardModel.getStateActionRewardVector());
+    }
+    if (originalRewardModel.hasTransitionRewards()) {
+        transitionRewardMatrix = originalRewardModel.getTransitionRewardMatrix().permuteRowGroupsAndColumns(newToOldStates, oldToNewStates);
+    }
+    return RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix));
+}
+
+template<typename ValueType, typename RewardModelType>
+void transformModelSpecificComponents(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                      std::vector<uint64_t> const& newToOldStates,
+                                      storm::storage::sparse::ModelComponents<ValueType, RewardModelType>& components) {
+    if (originalModel.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto const& ma = *originalModel.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+        components.markovianStates = ma.getMarkovianStates().permute(newToOldStates);
+        components.exitRates = storm::utility::vector::applyInversePermutation(newToOldStates, ma.getExitRates());
+        components.rateTransitions = false;  // Note that originalModel.getTransitionMatrix() contains probabilities
+    } else if (originalModel.isOfType(storm::models::ModelType::Ctmc)) {
+        auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+        components.exitRates = storm::utility::vector::applyInversePermutation(newToOldStates, ctmc.getExitRateVector());
+        components.rateTransitions = true;
+    } else if (originalModel.isOfType(storm::models::ModelType::Pomdp)) {
+        auto const& pomdp = *originalModel.template as<storm::models::sparse::Pomdp<ValueType, RewardModelType>>();
+        components.observabilityClasses = storm::utility::vector::applyInversePermutation(newToOldStates, pomdp.getObservations());
+        components.observationValuations = pomdp.getOptionalObservationValuations();
+    } else {
+        STORM_LOG_THROW(originalModel.isOfType(storm::models::ModelType::Dtmc) || originalModel.isOfType(storm::models::ModelType::Mdp),
+                        storm::exceptions::NotSupportedException, "Renumbering the states of a " << originalModel.getType() << " is not supported.");
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+StatePermuterReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                  std::vector<uint64_t> const& newToOldStateIndexMapping) {
+    auto const& originalMatrix = originalModel.getTransitionMatrix();
+    uint64_t const numberOfStates = originalModel.getNumberOfStates();
+    STORM_LOG_THROW(newToOldStateIndexMapping.size() == numberOfStates, storm::exceptions::InvalidArgumentException,
+                    "The given state permutation has size " << newToOldStateIndexMapping.size() << " but the model has " << numberOfStates << " states.");
+
+    StatePermuterReturnType<ValueType, RewardModelType> result;
+    result.newToOldStateIndexMapping = newToOldStateIndexMapping;
+    std::vector<uint64_t> oldToNewStates(numberOfStates, numberOfStates);
+    for (uint64_t newState = 0; newState < numberOfStates; ++newState) {
+        uint64_t const oldState = newToOldStateIndexMapping[newState];
+        STORM_LOG_THROW(oldState < numberOfStates && oldToNewStates[oldState] == numberOfStates, storm::exceptions::InvalidArgumentException,
+                        "The given state mapping is not a permutation.");
+        oldToNewStates[oldState] = newState;
+    }
+    if (originalMatrix.hasTrivialRowGrouping()) {
+        result.newToOldChoiceIndexMapping = newToOldStateIndexMapping;
+    } else {
+        result.newToOldChoiceIndexMapping.reserve(originalMatrix.getRowCount());
+        auto const& groupIndices = originalMatrix.getRowGroupIndices();
+        for (auto oldState : newToOldStateIndexMapping) {
+            for (uint64_t oldChoice = groupIndices[oldState]; oldChoice < groupIndices[oldState + 1]; ++oldChoice) {
+                result.newToOldChoiceIndexMapping.push_back(oldChoice);
+            }
+        }
+    }
+    auto const& newToOldChoices = result.newToOldChoiceIndexMapping;
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(
+        originalMatrix.permuteRowGroupsAndColumns(newToOldStateIndexMapping, oldToNewStates));
+    components.stateLabeling = originalModel.getStateLabeling();
+    components.stateLabeling.permuteItems(newToOldStateIndexMapping);
+    for (auto const& rewardModel : originalModel.getRewardModels()) {
+        components.rewardModels.emplace(rewardModel.first,
+                                        transformRewardModel(rewardModel.second, newToOldStateIndexMapping, newToOldChoices, oldToNewStates));
+    }
+    if (originalModel.hasChoiceLabeling()) {
+        components.choiceLabeling = originalModel.getChoiceLabeling();
+        components.choiceLabeling->permuteItems(newToOldChoices);
+    }
+    if (originalModel.hasStateValuations()) {
+        components.stateValuations = originalModel.getStateValuations().selectStates(newToOldStateIndexMapping);
+    }
+    if (originalModel.hasChoiceOrigins()) {
+        components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(newToOldChoices);
+    }
+    transformModelSpecificComponents<ValueType, RewardModelType>(originalModel, newToOldStateIndexMapping, components);
+
+    result.model = storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+    STORM_LOG_DEBUG("Renumbered the states of a model with " << numberOfStates << " states.");
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+StatePermuterReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                  StateOrder order) {
+    return permuteStates(originalModel, computeStateOrder(order, originalModel.getTransitionMatrix(), originalModel.getInitialStates()));
+}
+
+namespace {
+template<typename MapType>
+MapType translateKeysToOriginalIndices(std::vector<uint64_t> const& newToOldIndexMapping, MapType const& permutedMap) {
+    MapType result;
+    for (auto const& [newIndex, value] : permutedMap) {
+        result.emplace(newToOldIndexMapping[newIndex], value);
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> translateToOriginalStates(std::vector<uint64_t> const& newToOldStateIndexMapping,
+                                                                            storm::modelchecker::CheckResult const& permutedResult) {
+    if (permutedResult.isExplicitQualitativeCheckResult()) {
+        auto const& qualitativeResult = permutedResult.asExplicitQualitativeCheckResult();
+        if (!qualitativeResult.isResultForAllStates()) {
+            return std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(
+                translateKeysToOriginalIndices(newToOldStateIndexMapping, qualitativeResult.getTruthValuesMap()));
+        }
+        auto const& permutedTruthValues = qualitativeResult.getTruthValuesVector();
+        storm::storage::BitVector truthValues(permutedTruthValues.size());
+        for (auto newState : permutedTruthValues) {
+            truthValues.set(newToOldStateIndexMapping[newState]);
+        }
+        return std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(std::move(truthValues));
+    } else if (permutedResult.isExplicitQuantitativeCheckResult()) {
+        auto const& quantitativeResult = permutedResult.asExplicitQuantitativeCheckResult<ValueType>();
+        std::unique_ptr<storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>> result;
+        if (quantitativeResult.isResultForAllStates()) {
+            result = std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>>(
+                translateToOriginalIndices(newToOldStateIndexMapping, quantitativeResult.getValueVector()));
+        } else {
+            result = std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>>(
+                translateKeysToOriginalIndices(newToOldStateIndexMapping, quantitativeResult.getValueMap()));
+        }
+        if (quantitativeResult.hasScheduler()) {
+            // The choices of each state retain their relative order, so the local choice indices remain valid.
+            auto const& permutedScheduler = quantitativeResult.getScheduler();
+            STORM_LOG_THROW(permutedScheduler.isMemorylessScheduler(), storm::exceptions::NotSupportedException,
+                            "Translating schedulers with memory to the original state indices is not supported.");
+            auto scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(newToOldStateIndexMapping.size());
+            for (uint64_t newState = 0; newState < newToOldStateIndexMapping.size(); ++newState) {
+                uint64_t oldState = newToOldStateIndexMapping[newState];
+                scheduler->setChoice(permutedScheduler.getChoice(newState), oldState);
+                if (permutedScheduler.isDontCare(newState)) {
+                    scheduler->setDontCare(oldState, 0, false);
+                }
+            }
+            result->setScheduler(std::move(scheduler));
+        }
+        return result;
+    } else if (permutedResult.isExplicitParetoCurveCheckResult()) {
+        // Pareto curves are not computed for parametric models.
+        if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+            auto const& paretoResult = permutedResult.asExplicitParetoCurveCheckResult<ValueType>();
+            return std::make_unique<storm::modelchecker::ExplicitParetoCurveCheckResult<ValueType>>(
+                newToOldStateIndexMapping[paretoResult.getState()], paretoResult.getPoints(), paretoResult.getUnderApproximation(),
+                paretoResult.getOverApproximation());
+        }
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Translating the check result to the original state indices is not supported.");
+}
+
+template std::vector<uint64_t> computeStateOrder(StateOrder order, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> computeStateOrder(StateOrder order, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> computeStateOrder(StateOrder order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> computeStateOrder(StateOrder order, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+
+template StatePermuterReturnType<double> permuteStates(storm::models::sparse::Model<double> const& originalModel,
+                                                       std::vector<uint64_t> const& newToOldStateIndexMapping);
+template StatePermuterReturnType<storm::RationalNumber> permuteStates(storm::models::sparse::Model<storm::RationalNumber> const& originalModel,
+                                                                      std::vector<uint64_t> const& newToOldStateIndexMapping);
+template StatePermuterReturnType<storm::RationalFunction> permuteStates(storm::models::sparse::Model<storm::RationalFunction> const& originalModel,
+                                                                        std::vector<uint64_t> const& newToOldStateIndexMapping);
+template StatePermuterReturnType<storm::Interval> permuteStates(storm::models::sparse::Model<storm::Interval> const& originalModel,
+                                                                std::vector<uint64_t> const& newToOldStateIndexMapping);
+template StatePermuterReturnType<double> permuteStates(storm::models::sparse::Model<double> const& originalModel, StateOrder order);
+template StatePermuterReturnType<storm::RationalNumber> permuteStates(storm::models::sparse::Model<storm::RationalNumber> const& originalModel,
+                                                                      StateOrder order);
+template StatePermuterReturnType<storm::RationalFunction> permuteStates(storm::models::sparse::Model<storm::RationalFunction> const& originalModel,
+                                                                        StateOrder order);
+template StatePermuterReturnType<storm::Interval> permuteStates(storm::models::sparse::Model<storm::Interval> const& originalModel, StateOrder order);
+
+template std::unique_ptr<storm::modelchecker::CheckResult> translateToOriginalStates<double>(std::vector<uint64_t> const& newToOldStateIndexMapping,
+                                                                                            storm::modelchecker::CheckResult const& permutedResult);
+template std::unique_ptr<storm::modelchecker::CheckResult> translateToOriginalStates<storm::RationalNumber>(
+    std::vector<uint64_t> const& newToOldStateIndexMapping, storm::modelchecker::CheckResult const& permutedResult);
+template std::unique_ptr<storm::modelchecker::CheckResult> translateToOriginalStates<storm::RationalFunction>(
+    std::vector<uint64_t> const& newToOldStateIndexMapping, storm::modelchecker::CheckResult const& permutedResult);
+
+}  // namespace transformer
+}  // namespace storm
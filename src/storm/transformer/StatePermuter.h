@@ -0,0 +1,104 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * The orders in which the states of a sparse model can be renumbered.
+ */
+enum class StateOrder {
+    // Breadth-first search from the initial states along the transitions.
+    Bfs,
+    // Reverse Cuthill-McKee order on the (symmetrized) transition graph. Tends to minimize the bandwidth of the transition matrix.
+    ReverseCuthillMcKee,
+    // SCCs in topological order, where the SCCs that are reachable from an SCC are numbered before it.
+    SccTopological
+};
+
+std::string toString(StateOrder const& order);
+
+StateOrder stateOrderFromString(std::string const& order);
+
+/*!
+ * Computes the given order of the states of the model with the given transition matrix.
+ *
+ * @param order The kind of order to compute.
+ * @param transitionMatrix The transition matrix (possibly with a non-trivial row grouping).
+ * @param initialStates The initial states of the model.
+ * @return For each state index of the reordered model, the corresponding state index of the original model.
+ */
+template<typename ValueType>
+std::vector<uint64_t> computeStateOrder(StateOrder order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::BitVector const& initialStates);
+
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+struct StatePermuterReturnType {
+    // The resulting model
+    std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> model;
+    // Gives for each state in the resulting model the corresponding state in the original model.
+    std::vector<uint64_t> newToOldStateIndexMapping;
+    // Gives for each choice in the resulting model the corresponding choice in the original model.
+    std::vector<uint64_t> newToOldChoiceIndexMapping;
+};
+
+/*!
+ * Renumbers the states of the given model. The transition matrix, the labelings, the reward models, the state valuations, the choice origins, as well as
+ * the model type specific components (exit rates, Markovian states, observations) are permuted consistently.
+ * The choices of each state retain their relative order.
+ *
+ * @param originalModel The original model.
+ * @param newToOldStateIndexMapping For each state of the resulting model, the corresponding state of the original model. Must be a permutation.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+StatePermuterReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                  std::vector<uint64_t> const& newToOldStateIndexMapping);
+
+/*!
+ * Renumbers the states of the given model according to the given order.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+StatePermuterReturnType<ValueType, RewardModelType> permuteStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                  StateOrder order);
+
+/*!
+ * Translates a vector that is indexed by the states (or choices) of a permuted model back to the indices of the original model.
+ *
+ * @param newToOldIndexMapping The state (or choice) index mapping as returned by permuteStates.
+ * @param permutedValues The values, indexed w.r.t. the permuted model.
+ * @return The values, indexed w.r.t. the original model.
+ */
+template<typename T>
+std::vector<T> translateToOriginalIndices(std::vector<uint64_t> const& newToOldIndexMapping, std::vector<T> const& permutedValues) {
+    STORM_LOG_ASSERT(newToOldIndexMapping.size() == permutedValues.size(), "Size mismatch of permutation and values.");
+    std::vector<T> result(permutedValues.size());
+    for (uint64_t newIndex = 0; newIndex < newToOldIndexMapping.size(); ++newIndex) {
+        result[newToOldIndexMapping[newIndex]] = permutedValues[newIndex];
+    }
+    return result;
+}
+
+/*!
+ * Translates a check result that was obtained on a permuted model back to the state indices of the original model.
+ * Schedulers of the result are translated as well, which is only supported for memoryless schedulers.
+ *
+ * @param newToOldStateIndexMapping The state index mapping as returned by permuteStates.
+ * @param permutedResult The explicit result, referring to the states of the permuted model.
+ * @return The result, referring to the states of the original model.
+ */
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> translateToOriginalStates(std::vector<uint64_t> const& newToOldStateIndexMapping,
+                                                                            storm::modelchecker::CheckResult const& permutedResult);
+
+}  // namespace transformer
+}  // namespace storm
@@ -959,6 +959,16 @@ template typename NumberTraits<double>::IntegerType trunc(double const& number);
 template double mod(double const& first, double const& second);
 template std::string to_string(double const& value);
 
+// float
+template float one();
+template float zero();
+template float infinity();
+template bool isOne(float const& value);
+template bool isZero(float const& value);
+template bool isConstant(float const& value);
+template bool isInfinity(float const& value);
+template float abs(float const& number);
+
 // int
 template int one();
 template int zero();
@@ -989,6 +999,8 @@ template bool isInfinity(storm::storage::sparse::state_type const& value);
 // other instantiations
 template unsigned long convertNumber(long const&);
 template double convertNumber(long const&);
+template float convertNumber(double const&);
+template double convertNumber(float const&);
 
 #if defined(STORM_HAVE_CLN)
 // Instantiations for (CLN) rational number.
@@ -21,13 +21,15 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
 
     auto start = std::chrono::high_resolution_clock::now();
     storm::dd::Bdd<Type> reachableStates = initialStates;
+    // Only the states discovered in the previous iteration can have successors that were not yet discovered.
+    storm::dd::Bdd<Type> frontier = initialStates;
 
     // Perform the BFS to discover all reachable states.
     bool changed = true;
     uint_fast64_t iteration = 0;
     do {
         changed = false;
-        storm::dd::Bdd<Type> tmp = reachableStates.relationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+        storm::dd::Bdd<Type> tmp = frontier.relationalProduct(transitions, rowMetaVariables, columnMetaVariables);
         storm::dd::Bdd<Type> newReachableStates = tmp && (!reachableStates);
 
         // Check whether new states were indeed discovered.
@@ -36,6 +38,7 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
         }
 
         reachableStates |= newReachableStates;
+        frontier = newReachableStates;
 
         ++iteration;
         STORM_LOG_TRACE("Iteration " << iteration << " of reachability computation completed: " << reachableStates.getNonZeroCount()
@@ -59,13 +62,15 @@ storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const&
 
     auto start = std::chrono::high_resolution_clock::now();
     storm::dd::Bdd<Type> reachableStates = initialStates;
+    // Only the states discovered in the previous iteration can have predecessors that were not yet discovered.
+    storm::dd::Bdd<Type> frontier = initialStates;
 
     // Perform the BFS to discover all reachable states.
     bool changed = true;
     uint_fast64_t iteration = 0;
     do {
         changed = false;
-        storm::dd::Bdd<Type> tmp = reachableStates.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+        storm::dd::Bdd<Type> tmp = frontier.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables);
         storm::dd::Bdd<Type> newReachableStates = tmp && (!reachableStates) && constraintStates;
 
         // Check whether new states were indeed discovered.
@@ -74,6 +79,7 @@ storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const&
         }
 
         reachableStates |= newReachableStates;
+        frontier = newReachableStates;
 
         ++iteration;
         STORM_LOG_TRACE("Iteration " << iteration << " of (backward) reachability computation completed: " << reachableStates.getNonZeroCount()
@@ -43,6 +43,34 @@ template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager,
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+/*!
+ * Combines the given decision diagrams with the given associative operation along a balanced binary tree.
+ * Compared to combining them one after the other, the intermediate results stay small and the operands of each
+ * operation have similar sizes, which is what the work-stealing operations of Sylvan parallelize best.
+ *
+ * @param operands The decision diagrams to combine.
+ * @param neutral The result if there are no operands.
+ * @param operation The (associative) operation.
+ */
+template<typename DdType, typename Operation>
+DdType combineBalanced(std::vector<DdType> operands, DdType const& neutral, Operation const& operation) {
+    if (operands.empty()) {
+        return neutral;
+    }
+    while (operands.size() > 1) {
+        std::vector<DdType> combined;
+        combined.reserve((operands.size() + 1) / 2);
+        for (uint64_t i = 0; i + 1 < operands.size(); i += 2) {
+            combined.push_back(operation(operands[i], operands[i + 1]));
+        }
+        if (operands.size() % 2 == 1) {
+            combined.push_back(std::move(operands.back()));
+        }
+        operands = std::move(combined);
+    }
+    return std::move(operands.front());
+}
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
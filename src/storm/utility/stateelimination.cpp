@@ -1,5 +1,6 @@
 #include "storm/utility/stateelimination.h"
 
+#include <algorithm>
 #include <random>
 
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
@@ -41,7 +42,8 @@ bool eliminationOrderNeedsReversedDistances(storm::settings::modules::Eliminatio
 bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
     return order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
            order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty ||
-           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression;
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::FillIn;
 }
 
 bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
@@ -67,6 +69,25 @@ uint_fast64_t estimateComplexity(storm::RationalFunction const& value) {
 }
 #endif
 
+template<typename ValueType>
+uint_fast64_t estimateDegree(ValueType const&) {
+    return 0;
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+uint_fast64_t estimateDegree(storm::RationalFunction const& value) {
+    if (storm::utility::isConstant(value)) {
+        return 0;
+    }
+    uint_fast64_t degree = value.nominator().polynomialWithCoefficient().totalDegree();
+    if (!value.denominator().isConstant()) {
+        degree += value.denominator().polynomialWithCoefficient().totalDegree();
+    }
+    return degree;
+}
+#endif
+
 template<typename ValueType>
 uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
                                   storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
@@ -100,6 +121,44 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
     return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
 }
 
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyFillIn(storm::storage::sparse::state_type const& state,
+                                        storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                        std::vector<ValueType> const& oneStepProbabilities) {
+    // The probability of the self-loop (if any) enters all new values.
+    uint_fast64_t loopDegree = 0;
+    for (auto const& successor : transitionMatrix.getRow(state)) {
+        if (successor.getColumn() == state) {
+            loopDegree = estimateDegree(successor.getValue());
+            break;
+        }
+    }
+
+    uint_fast64_t penalty = 0;
+    for (auto const& predecessor : backwardTransitions.getRow(state)) {
+        if (predecessor.getColumn() == state) {
+            continue;
+        }
+        uint_fast64_t predecessorDegree = estimateDegree(predecessor.getValue()) + loopDegree;
+        auto const& predecessorRow = transitionMatrix.getRow(predecessor.getColumn());
+        for (auto const& successor : transitionMatrix.getRow(state)) {
+            if (successor.getColumn() == state) {
+                continue;
+            }
+            // The rows are sorted by column, so we can check efficiently whether the predecessor already has a transition to the successor.
+            auto existingEntry = std::lower_bound(predecessorRow.begin(), predecessorRow.end(), successor.getColumn(),
+                                                  [](auto const& entry, uint_fast64_t column) { return entry.getColumn() < column; });
+            bool isFillIn = existingEntry == predecessorRow.end() || existingEntry->getColumn() != successor.getColumn();
+            penalty += (isFillIn ? 2 : 1) * (1 + predecessorDegree + estimateDegree(successor.getValue()));
+        }
+        if (!storm::utility::isZero(oneStepProbabilities[state])) {
+            penalty += 1 + predecessorDegree + estimateDegree(oneStepProbabilities[state]);
+        }
+    }
+    return penalty;
+}
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -129,9 +188,12 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
             return std::make_unique<StaticStatePriorityQueue>(sortedStates);
         } else if (eliminationOrderIsPenaltyBased(order)) {
             std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(sortedStates.size());
-            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction =
-                order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ? computeStatePenaltyRegularExpression<ValueType>
-                                                                                                            : computeStatePenalty<ValueType>;
+            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = computeStatePenalty<ValueType>;
+            if (order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression) {
+                penaltyFunction = computeStatePenaltyRegularExpression<ValueType>;
+            } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::FillIn) {
+                penaltyFunction = computeStatePenaltyFillIn<ValueType>;
+            }
             for (uint_fast64_t index = 0; index < sortedStates.size(); ++index) {
                 statePenalties[index] =
                     std::make_pair(sortedStates[index], penaltyFunction(sortedStates[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
@@ -229,6 +291,7 @@ std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<ValueT
 }
 
 template uint_fast64_t estimateComplexity(double const& value);
+template uint_fast64_t estimateDegree(double const& value);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
@@ -241,6 +304,10 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
                                                             std::vector<double> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyFillIn(storm::storage::sparse::state_type const& state,
+                                                 storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
+                                                 storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+                                                 std::vector<double> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<double> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates, std::vector<double> const& oneStepProbabilities,
@@ -252,6 +319,7 @@ template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatr
 
 #ifdef STORM_HAVE_CARL
 template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
+template uint_fast64_t estimateDegree(storm::RationalNumber const& value);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -265,6 +333,10 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                             std::vector<storm::RationalNumber> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyFillIn(storm::storage::sparse::state_type const& state,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 std::vector<storm::RationalNumber> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates,
@@ -287,6 +359,10 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                             std::vector<storm::RationalFunction> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyFillIn(storm::storage::sparse::state_type const& state,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 std::vector<storm::RationalFunction> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates,
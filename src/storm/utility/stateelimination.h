@@ -47,6 +47,14 @@ template<>
 uint_fast64_t estimateComplexity(storm::RationalFunction const& value);
 #endif
 
+template<typename ValueType>
+uint_fast64_t estimateDegree(ValueType const& value);
+
+#ifdef STORM_HAVE_CARL
+template<>
+uint_fast64_t estimateDegree(storm::RationalFunction const& value);
+#endif
+
 template<typename ValueType>
 uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
                                   storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
@@ -58,6 +66,16 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
                                                    std::vector<ValueType> const& oneStepProbabilities);
 
+/*!
+ * Estimates the cost of eliminating the given state by the transitions that are created or updated. New transitions (fill-in) are penalized more than
+ * updated ones. Each transition is weighted by the degree of the value it is assigned.
+ */
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyFillIn(storm::storage::sparse::state_type const& state,
+                                        storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                        std::vector<ValueType> const& oneStepProbabilities);
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -0,0 +1,109 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <stdexcept>
+
+#include "storm-cli-utilities/concurrency.h"
+#include "storm-cli-utilities/model-handling.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+namespace {
+
+class VerifyPropertiesConcurrentlyTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        std::string formulasString =
+            "Pmin=? [F \"two\"]; Pmax=? [F \"three\"]; Pmin=? [F \"seven\"]; Rmin=? [F \"done\"]; Rmax=? [F \"done\"]; Pmax=? [F \"twelve\"]";
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+        // LTL properties are checked one after another, but concurrently to the other properties.
+        formulasString += "; Pmax=? [ (F (X (s1=6 & (XX s1=5)))) & (F G (d1!=5))]";
+        formulasString += "; Pmin=? [ ( (G F !(\"two\")) | F G (\"three\") ) & ( (G F !(\"five\") ) | F G (\"seven\") )]";
+#endif
+        input.model = storm::storage::SymbolicModelDescription(program);
+        input.properties = storm::api::parsePropertiesForPrismProgram(formulasString, program);
+        model = storm::api::buildSparseModel<double>(program, storm::api::extractFormulasFromProperties(input.properties));
+    }
+
+    storm::cli::VerificationCallbackType createVerificationCallback(storm::Environment const& env) const {
+        return [this, &env](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const&) {
+            auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formula, true));
+            if (result) {
+                result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+            }
+            return result;
+        };
+    }
+
+    storm::cli::PostprocessingCallbackType createPostprocessingCallback(std::vector<double>& values) const {
+        return [this, &values](std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
+            values.push_back(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()]);
+        };
+    }
+
+    storm::cli::SymbolicInput input;
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+};
+
+TEST_F(VerifyPropertiesConcurrentlyTest, SameResultsAsSequential) {
+    storm::Environment env;
+    std::vector<double> sequentialValues;
+    storm::cli::verifyProperties<double>(input, createVerificationCallback(env), createPostprocessingCallback(sequentialValues));
+    ASSERT_EQ(input.properties.size(), sequentialValues.size());
+
+    // The results are postprocessed in the order of the properties.
+    std::vector<storm::Environment> environments(3, env);
+    std::vector<storm::cli::VerificationCallbackType> verificationCallbacks;
+    for (auto const& threadEnv : environments) {
+        verificationCallbacks.push_back(createVerificationCallback(threadEnv));
+    }
+    std::vector<double> concurrentValues;
+    storm::cli::verifyPropertiesConcurrently<double>(input, verificationCallbacks, createPostprocessingCallback(concurrentValues));
+    ASSERT_EQ(sequentialValues.size(), concurrentValues.size());
+    for (uint64_t index = 0; index < sequentialValues.size(); ++index) {
+        EXPECT_EQ(sequentialValues[index], concurrentValues[index]) << input.properties[index];
+    }
+}
+
+TEST_F(VerifyPropertiesConcurrentlyTest, Exception) {
+    storm::Environment env;
+    std::vector<storm::Environment> environments(2, env);
+    std::vector<storm::cli::VerificationCallbackType> verificationCallbacks;
+    for (auto const& threadEnv : environments) {
+        auto verificationCallback = createVerificationCallback(threadEnv);
+        verificationCallbacks.push_back([verificationCallback](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                               std::shared_ptr<storm::logic::Formula const> const& states) {
+            if (formula->isRewardOperatorFormula()) {
+                throw std::runtime_error("Unexpected reward property.");
+            }
+            return verificationCallback(formula, states);
+        });
+    }
+
+    // The exception is passed on to the calling thread after the results of the preceding properties have been postprocessed.
+    std::vector<double> values;
+    EXPECT_THROW(storm::cli::verifyPropertiesConcurrently<double>(input, verificationCallbacks, createPostprocessingCallback(values)), std::runtime_error);
+    EXPECT_EQ(3ull, values.size());
+}
+
+TEST_F(VerifyPropertiesConcurrentlyTest, LtlTranslationLock) {
+    auto properties = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"two\"]; Pmax=? [F G \"two\"]", input.model->asPrismProgram());
+    ASSERT_EQ(2ull, properties.size());
+    {
+        auto lock = storm::cli::lockIfLtlTranslationRequired(*properties[0].getRawFormula());
+        EXPECT_FALSE(lock.owns_lock());
+    }
+    {
+        auto lock = storm::cli::lockIfLtlTranslationRequired(*properties[1].getRawFormula());
+        EXPECT_TRUE(lock.owns_lock());
+    }
+    // The lock was released, so it can be acquired again.
+    EXPECT_TRUE(storm::cli::lockIfLtlTranslationRequired(*properties[1].getRawFormula()).owns_lock());
+}
+
+}  // namespace
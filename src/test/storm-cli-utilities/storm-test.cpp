@@ -0,0 +1,9 @@
+#include "storm/settings/SettingsManager.h"
+#include "test/storm_gtest.h"
+
+int main(int argc, char **argv) {
+    storm::settings::initializeAll("Storm-cli-utilities (Functional) Testing Suite", "test-cli-utilities");
+    storm::test::initialize();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,79 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+namespace {
+
+typedef storm::counterexamples::SMTMinimalLabelSetGenerator<double> Generator;
+
+class SMTMinimalLabelSetGeneratorTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifndef STORM_HAVE_Z3
+        GTEST_SKIP() << "Z3 not available.";
+#endif
+    }
+
+    /*!
+     * Computes a minimal command set for the given property once with the sequential candidate check and once with batches of candidates that are
+     * checked concurrently. Both command sets have to be of the same size and have to violate the property.
+     */
+    void compareSequentialAndParallel(std::string const& prismFile, std::string const& propertyString, std::string const& checkedPropertyString) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(prismFile);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(propertyString, program));
+        storm::builder::BuilderOptions builderOptions(formulas, program);
+        builderOptions.setBuildChoiceOrigins(true);
+        auto model = storm::api::buildSparseModel<double>(program, builderOptions);
+
+        storm::Environment env;
+        auto cexInput = Generator::precompute(env, program, *model, formulas.front());
+
+        Generator::Options sequentialOptions(true);
+        sequentialOptions.silent = true;
+        sequentialOptions.candidateBatchSize = 1;
+        sequentialOptions.checkCandidatesInParallel = false;
+        Generator::GeneratorStats sequentialStats;
+        auto sequentialLabelSets = Generator::computeCounterexampleLabelSet(env, sequentialStats, program, *model, cexInput, {}, sequentialOptions);
+
+        Generator::Options parallelOptions(true);
+        parallelOptions.silent = true;
+        parallelOptions.candidateBatchSize = 4;
+        parallelOptions.checkCandidatesInParallel = true;
+        Generator::GeneratorStats parallelStats;
+        auto parallelLabelSets = Generator::computeCounterexampleLabelSet(env, parallelStats, program, *model, cexInput, {}, parallelOptions);
+
+        ASSERT_EQ(1ull, sequentialLabelSets.size());
+        ASSERT_EQ(1ull, parallelLabelSets.size());
+        EXPECT_EQ(sequentialLabelSets.front().size(), parallelLabelSets.front().size());
+        EXPECT_LT(parallelLabelSets.front().size(), program.getNumberOfCommands());
+
+        // The restricted programs have to reach the target with a probability that exceeds the threshold.
+        double threshold = formulas.front()->asProbabilityOperatorFormula().getThresholdAs<double>();
+        for (auto const& labelSet : {sequentialLabelSets.front(), parallelLabelSets.front()}) {
+            storm::prism::Program restrictedProgram = program.restrictCommands(labelSet);
+            auto checkedFormulas =
+                storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(checkedPropertyString, restrictedProgram));
+            auto restrictedModel = storm::api::buildSparseModel<double>(restrictedProgram, checkedFormulas);
+            auto result = storm::api::verifyWithSparseEngine<double>(restrictedModel, storm::api::createTask<double>(checkedFormulas.front(), true));
+            ASSERT_TRUE(result != nullptr);
+            EXPECT_GT(result->asExplicitQuantitativeCheckResult<double>()[*restrictedModel->getInitialStates().begin()], threshold);
+        }
+    }
+};
+
+TEST_F(SMTMinimalLabelSetGeneratorTest, DieDtmc) {
+    compareSequentialAndParallel(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", "P<=0.1 [F \"two\"]", "P=? [F \"two\"]");
+}
+
+TEST_F(SMTMinimalLabelSetGeneratorTest, TwoDiceMdp) {
+    compareSequentialAndParallel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", "P<=0.1 [F \"seven\"]", "Pmax=? [F \"seven\"]");
+}
+
+}  // namespace
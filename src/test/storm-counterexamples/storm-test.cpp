@@ -0,0 +1,11 @@
+#include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
+#include "storm/settings/SettingsManager.h"
+#include "test/storm_gtest.h"
+
+int main(int argc, char **argv) {
+    storm::settings::initializeAll("Storm-counterexamples (Functional) Testing Suite", "test-counterexamples");
+    storm::settings::addModule<storm::settings::modules::CounterexampleGeneratorSettings>();
+    storm::test::initialize();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
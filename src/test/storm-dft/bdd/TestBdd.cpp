@@ -122,6 +122,33 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, AllImportanceMeasuresAtTimepoints) {
+    auto const &param{TestWithParam::GetParam()};
+    std::vector<double> const timepoints{0.5, 1, 2};
+    auto const bes{checker->getDFT()->getBasicElements()};
+    for (size_t chunksize : {0, 1, 2}) {
+        auto const measures{checker->getAllImportanceMeasuresAtTimepoints(timepoints, chunksize)};
+        ASSERT_EQ(measures.birnbaumFactors.size(), bes.size());
+        std::vector<double> birnbaum, CIF, DIF, RAW, RRW;
+        for (size_t i{0}; i < bes.size(); ++i) {
+            ASSERT_EQ(measures.birnbaumFactors[i].size(), timepoints.size());
+            birnbaum.push_back(measures.birnbaumFactors[i][1]);
+            CIF.push_back(measures.CIFs[i][1]);
+            DIF.push_back(measures.DIFs[i][1]);
+            RAW.push_back(measures.RAWs[i][1]);
+            RRW.push_back(measures.RRWs[i][1]);
+            for (size_t j{0}; j < timepoints.size(); ++j) {
+                EXPECT_NEAR(measures.birnbaumFactors[i][j], checker->getBirnbaumFactorAtTimebound(bes[i]->name(), timepoints[j]), 1e-6);
+            }
+        }
+        expectVectorNear(birnbaum, param.birnbaum);
+        expectVectorNear(CIF, param.CIF);
+        expectVectorNear(DIF, param.DIF);
+        expectVectorNear(RAW, param.RAW);
+        expectVectorNear(RRW, param.RRW);
+    }
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
@@ -0,0 +1,141 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-gspn/api/storm-gspn.h"
+#include "storm-gspn/storage/gspn/GspnBuilder.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/settings/modules/GeneralSettings.h"
+
+namespace {
+
+/*!
+ * A GSPN with a timed transition with infinite-server semantics, a timed transition with 2-server semantics, conflicting immediate transitions with
+ * different weights and priorities, and an inhibition arc. Its state space is a Markov automaton.
+ */
+std::unique_ptr<storm::gspn::GSPN> buildMarkovAutomatonGspn() {
+    storm::gspn::GspnBuilder builder;
+    builder.setGspnName("ma");
+    builder.addPlace(3, 3, "idle");
+    builder.addPlace(1, 0, "choice");
+    builder.addPlace(3, 0, "busy");
+    builder.addPlace(3, 0, "done");
+    builder.addPlace(1, 0, "failed");
+
+    builder.addTimedTransition(0, 1.5, boost::none, "start");
+    builder.addInputArc("idle", "start");
+    builder.addOutputArc("start", "choice");
+    builder.addInhibitionArc("choice", "start");
+    builder.addInhibitionArc("failed", "start");
+
+    builder.addImmediateTransition(1, 2.0, "work");
+    builder.addInputArc("choice", "work");
+    builder.addOutputArc("work", "busy");
+    builder.addImmediateTransition(1, 1.0, "skip");
+    builder.addInputArc("choice", "skip");
+    builder.addOutputArc("skip", "done");
+    // Has a lower priority than the transitions above and is thus never enabled together with them.
+    builder.addImmediateTransition(0, 1.0, "abort");
+    builder.addInputArc("choice", "abort");
+    builder.addOutputArc("abort", "failed");
+
+    builder.addTimedTransition(0, 2.0, 2, "finish");
+    builder.addInputArc("busy", "finish");
+    builder.addOutputArc("finish", "done");
+
+    builder.addTimedTransition(0, 0.5, "reset");
+    builder.addInputArc("done", "reset");
+    builder.addOutputArc("reset", "idle");
+    return std::unique_ptr<storm::gspn::GSPN>(builder.buildGspn());
+}
+
+/*!
+ * A GSPN without immediate transitions whose state space is a CTMC.
+ */
+std::unique_ptr<storm::gspn::GSPN> buildCtmcGspn() {
+    storm::gspn::GspnBuilder builder;
+    builder.setGspnName("ctmc");
+    builder.addPlace(4, 4, "up");
+    builder.addPlace(4, 0, "down");
+    builder.addPlace(2, 0, "repair");
+
+    builder.addTimedTransition(0, 0.3, boost::none, "fail");
+    builder.addInputArc("up", "fail");
+    builder.addOutputArc("fail", "down");
+
+    builder.addTimedTransition(0, 1.0, "dispatch");
+    builder.addInputArc("down", "dispatch");
+    builder.addOutputArc("dispatch", "repair");
+    builder.addInhibitionArc("repair", "dispatch", 2);
+
+    builder.addTimedTransition(0, 0.8, 2, "fix");
+    builder.addInputArc("repair", "fix");
+    builder.addOutputArc("fix", "up");
+    return std::unique_ptr<storm::gspn::GSPN>(builder.buildGspn());
+}
+
+/*!
+ * Builds the model of the given GSPN via the explicit builder and via the JANI translation, checks that both models coincide in their type and size
+ * and that the given properties have the same result on both of them.
+ */
+void compareWithJaniRoute(storm::gspn::GSPN const& gspn, std::string const& propertyString) {
+    storm::parser::FormulaParser formulaParser(gspn.getExpressionManager());
+    auto properties = storm::api::parseProperties(formulaParser, propertyString);
+    auto formulas = storm::api::extractFormulasFromProperties(properties);
+
+    auto explicitModel = storm::api::buildExplicitModel(gspn, formulas);
+    std::unique_ptr<storm::jani::Model> janiModel(storm::api::buildJani(gspn));
+    auto janiRouteModel = storm::api::buildSparseModel<double>(*janiModel, formulas);
+
+    EXPECT_EQ(janiRouteModel->getType(), explicitModel->getType());
+    EXPECT_EQ(janiRouteModel->getNumberOfStates(), explicitModel->getNumberOfStates());
+    EXPECT_EQ(janiRouteModel->getNumberOfTransitions(), explicitModel->getNumberOfTransitions());
+    EXPECT_EQ(janiRouteModel->getNumberOfChoices(), explicitModel->getNumberOfChoices());
+    ASSERT_EQ(1ull, explicitModel->getInitialStates().getNumberOfSetBits());
+    ASSERT_EQ(1ull, janiRouteModel->getInitialStates().getNumberOfSetBits());
+
+    for (auto const& formula : formulas) {
+        auto explicitResult = storm::api::verifyWithSparseEngine<double>(explicitModel, storm::api::createTask<double>(formula, true));
+        auto janiRouteResult = storm::api::verifyWithSparseEngine<double>(janiRouteModel, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(explicitResult != nullptr) << *formula;
+        ASSERT_TRUE(janiRouteResult != nullptr) << *formula;
+        double explicitValue = explicitResult->asExplicitQuantitativeCheckResult<double>()[*explicitModel->getInitialStates().begin()];
+        double janiRouteValue = janiRouteResult->asExplicitQuantitativeCheckResult<double>()[*janiRouteModel->getInitialStates().begin()];
+        EXPECT_NEAR(janiRouteValue, explicitValue, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()) << *formula;
+    }
+}
+
+TEST(ExplicitGspnModelBuilderTest, MarkovAutomaton) {
+    auto gspn = buildMarkovAutomatonGspn();
+    auto model = storm::api::buildExplicitModel(*gspn, {});
+    EXPECT_EQ(storm::models::ModelType::MarkovAutomaton, model->getType());
+    EXPECT_TRUE(model->hasLabel("init"));
+
+    compareWithJaniRoute(*gspn, "Pmax=? [F<=1 done=3]; Pmin=? [F<=2.5 busy>=2]; Tmin=? [F done=3]; Pmax=? [F failed=1]");
+}
+
+TEST(ExplicitGspnModelBuilderTest, Ctmc) {
+    auto gspn = buildCtmcGspn();
+    auto model = storm::api::buildExplicitModel(*gspn, {});
+    EXPECT_EQ(storm::models::ModelType::Ctmc, model->getType());
+
+    compareWithJaniRoute(*gspn, "P=? [F<=2 up=0]; P=? [F up<=1 & repair=2]; T=? [F down=4]");
+}
+
+TEST(ExplicitGspnModelBuilderTest, ExpressionLabels) {
+    auto gspn = buildCtmcGspn();
+    storm::parser::FormulaParser formulaParser(gspn->getExpressionManager());
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties(formulaParser, "P=? [F up=0]"));
+    auto model = storm::api::buildExplicitModel(*gspn, formulas);
+    std::string labelName = formulas.front()->getAtomicExpressionFormulas().front()->getExpression().toString();
+
+    // In the initial marking, all tokens are in place "up".
+    ASSERT_TRUE(model->hasLabel(labelName));
+    EXPECT_EQ(1ull, model->getStates("init").getNumberOfSetBits());
+    EXPECT_TRUE(model->getStates(labelName).isDisjointFrom(model->getStates("init")));
+    EXPECT_FALSE(model->getStates(labelName).empty());
+}
+
+}  // namespace
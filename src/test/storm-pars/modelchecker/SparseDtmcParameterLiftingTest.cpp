@@ -10,8 +10,12 @@
 
 #include "storm-parsers/api/storm-parsers.h"
 
+#include "storm-pars/settings/modules/ParametricSettings.h"
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/stateelimination/NondeterministicModelStateEliminator.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/storage/jani/Property.h"
@@ -109,6 +113,59 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob) {
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_Concurrent) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+    modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+    std::vector<storm::storage::ParameterRegion<storm::RationalFunction>> regions = {
+        storm::api::parseRegion<storm::RationalFunction>("0.7<=pL<=0.9,0.75<=pK<=0.95", modelParameters),
+        storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.65,0.75<=pK<=0.95", modelParameters),
+        storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.73,0.2<=pK<=0.715", modelParameters),
+        storm::api::parseRegion<storm::RationalFunction>("0.6<=pL<=0.8,0.6<=pK<=0.8", modelParameters),
+        storm::api::parseRegion<storm::RationalFunction>("0.85<=pL<=0.99,0.1<=pK<=0.99", modelParameters)};
+
+    // Analyzes the regions with the given settings. The settings are considered when the parameter lifter is created.
+    auto analyzeRegions = [&](bool intelTbb, bool compiledEvaluation) {
+        auto intelTbbMemento =
+            storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName).overrideOption("enable-tbb", intelTbb);
+        auto compiledEvaluationMemento = storm::settings::mutableManager()
+                                             .getModule(storm::settings::modules::ParametricSettings::moduleName)
+                                             .overrideOption("compiled-evaluation", compiledEvaluation);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+            this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        std::vector<storm::modelchecker::RegionResult> results;
+        for (auto const& region : regions) {
+            results.push_back(regionChecker->analyzeRegion(this->env(), region, storm::modelchecker::RegionResultHypothesis::Unknown,
+                                                           storm::modelchecker::RegionResult::Unknown, true));
+        }
+        return results;
+    };
+
+    std::vector<storm::modelchecker::RegionResult> sequentialResults = analyzeRegions(false, false);
+    EXPECT_EQ(storm::modelchecker::RegionResult::AllSat, sequentialResults[0]);
+    EXPECT_EQ(storm::modelchecker::RegionResult::ExistsBoth, sequentialResults[1]);
+    EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, sequentialResults[2]);
+    // The exact evaluation (and for double precision also the compiled evaluation) is concurrent if Intel TBB is enabled.
+    EXPECT_EQ(sequentialResults, analyzeRegions(true, false));
+    EXPECT_EQ(sequentialResults, analyzeRegions(false, true));
+    EXPECT_EQ(sequentialResults, analyzeRegions(true, true));
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
     typedef typename TestFixture::ValueType ValueType;
 
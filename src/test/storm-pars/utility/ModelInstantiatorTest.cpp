@@ -7,9 +7,13 @@
 #include <carl/numbers/numbers.h>
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
+#include "storm-pars/settings/modules/ParametricSettings.h"
+
 #include "storm-pars/utility/ModelInstantiator.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
@@ -268,4 +272,64 @@ TEST(ModelInstantiatorTest, Consensus) {
                 storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(ModelInstantiatorTest, CompiledEvaluation) {
+    carl::VariablePool::getInstance().clear();
+    auto compiledEvaluation =
+        storm::settings::mutableManager().getModule(storm::settings::modules::ParametricSettings::moduleName).overrideOption("compiled-evaluation", true);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/coin2_2.nm";
+    std::string formulaAsString = "Pmin=? [F \"finished\"&\"all_coins_equal_1\" ]";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size() == 1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalFunction>> mdp =
+        storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+
+    storm::utility::ModelInstantiator<storm::models::sparse::Mdp<storm::RationalFunction>, storm::models::sparse::Mdp<double>> modelInstantiator(*mdp);
+
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    storm::RationalFunctionVariable const& p1 = carl::VariablePool::getInstance().findVariableWithName("p1");
+    ASSERT_NE(p1, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& p2 = carl::VariablePool::getInstance().findVariableWithName("p2");
+    ASSERT_NE(p2, carl::Variable::NO_VARIABLE);
+    valuation.insert(std::make_pair(p1, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.51)));
+    valuation.insert(std::make_pair(p2, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.49)));
+    storm::models::sparse::Mdp<double> const& instantiated(modelInstantiator.instantiate(valuation));
+    EXPECT_EQ(1ull, modelInstantiator.getNumberOfInstantiations());
+    uint64_t const numberOfFunctionEvaluations = modelInstantiator.getNumberOfFunctionEvaluations();
+    EXPECT_LT(0ull, numberOfFunctionEvaluations);
+    EXPECT_GE(mdp->getTransitionMatrix().getEntryCount(), numberOfFunctionEvaluations);
+
+    // The compiled functions are evaluated on the expanded polynomials, so the values may differ slightly from the exact values.
+    ASSERT_EQ(mdp->getTransitionMatrix().getRowGroupIndices(), instantiated.getTransitionMatrix().getRowGroupIndices());
+    for (std::size_t row = 0; row < mdp->getTransitionMatrix().getRowCount(); ++row) {
+        auto instantiatedEntry = instantiated.getTransitionMatrix().getRow(row).begin();
+        for (auto const& paramEntry : mdp->getTransitionMatrix().getRow(row)) {
+            EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
+            double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
+            EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
+            ++instantiatedEntry;
+        }
+        EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(), instantiatedEntry);
+    }
+
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> modelchecker(instantiated);
+    std::unique_ptr<storm::modelchecker::CheckResult> chkResult = modelchecker.check(*formulas[0]);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeChkResult = chkResult->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(0.3526577219, quantitativeChkResult[*instantiated.getInitialStates().begin()],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    // Every variable needs a value.
+    valuation.erase(p2);
+    STORM_SILENT_EXPECT_THROW(modelInstantiator.instantiate(valuation), storm::exceptions::InvalidArgumentException);
+    EXPECT_EQ(1ull, modelInstantiator.getNumberOfInstantiations());
+    EXPECT_EQ(numberOfFunctionEvaluations, modelInstantiator.getNumberOfFunctionEvaluations());
+}
+
 #endif
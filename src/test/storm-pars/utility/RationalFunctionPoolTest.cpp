@@ -0,0 +1,72 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include <carl/core/VariablePool.h>
+#include <carl/numbers/numbers.h>
+#include "carl/util/stringparser.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+#include "storm-pars/utility/RationalFunctionPool.h"
+
+namespace {
+storm::RationalFunction parseFunction(carl::StringParser& parser, std::string const& nominator, std::string const& denominator,
+                                      std::shared_ptr<storm::RawPolynomialCache> cache) {
+    storm::Polynomial nominatorPolynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>(nominator), cache);
+    storm::Polynomial denominatorPolynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>(denominator), cache);
+    return storm::RationalFunction(nominatorPolynomial, denominatorPolynomial);
+}
+}  // namespace
+
+TEST(RationalFunctionPoolTest, HashConsing) {
+    carl::VariablePool::getInstance().clear();
+    carl::StringParser parser;
+    parser.setVariables({"p", "q"});
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunction f1 = parseFunction(parser, "p", "1", cache);
+    storm::RationalFunction f2 = parseFunction(parser, "1-p", "1", cache);
+
+    storm::utility::parametric::RationalFunctionPool pool;
+    EXPECT_EQ(0ull, pool.add(f1));
+    EXPECT_EQ(1ull, pool.add(f2));
+    EXPECT_EQ(0ull, pool.add(parseFunction(parser, "p", "1", cache)));
+    EXPECT_EQ(1ull, pool.add(f2));
+    EXPECT_EQ(2ull, pool.size());
+    EXPECT_EQ(4ull, pool.getNumberOfAddedFunctions());
+    EXPECT_EQ(f1, pool.getFunction(0));
+    EXPECT_EQ(f2, pool.getFunction(1));
+    EXPECT_EQ(1ull, pool.getVariables().size());
+}
+
+TEST(RationalFunctionPoolTest, Evaluate) {
+    carl::VariablePool::getInstance().clear();
+    carl::StringParser parser;
+    parser.setVariables({"p", "q"});
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    std::vector<storm::RationalFunction> functions = {parseFunction(parser, "3", "1", cache), parseFunction(parser, "p*q", "1", cache),
+                                                      parseFunction(parser, "2*p^2*q-q+3", "1", cache), parseFunction(parser, "p^3", "p+q", cache),
+                                                      parseFunction(parser, "1-p", "2+3*q^2", cache)};
+
+    storm::utility::parametric::RationalFunctionPool pool;
+    for (auto const& function : functions) {
+        pool.add(function);
+    }
+    ASSERT_EQ(functions.size(), pool.size());
+    EXPECT_EQ(2ull, pool.getVariables().size());
+
+    storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+    valuation.emplace(carl::VariablePool::getInstance().findVariableWithName("p"), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.3));
+    valuation.emplace(carl::VariablePool::getInstance().findVariableWithName("q"), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.7));
+    std::vector<double> variableValues = pool.getVariableValues(valuation);
+    for (uint64_t id = 0; id < functions.size(); ++id) {
+        EXPECT_NEAR(carl::toDouble(functions[id].evaluate(valuation)), pool.evaluate(id, variableValues), 1e-12) << functions[id];
+    }
+
+    // Every variable of the pool needs a value.
+    valuation.erase(carl::VariablePool::getInstance().findVariableWithName("q"));
+    STORM_SILENT_EXPECT_THROW(pool.getVariableValues(valuation), storm::exceptions::InvalidArgumentException);
+}
+
+#endif
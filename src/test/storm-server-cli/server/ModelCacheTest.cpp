@@ -0,0 +1,103 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <stdexcept>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-server-cli/server/ModelCache.h"
+#include "storm/api/storm.h"
+
+namespace {
+
+class ModelCacheTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        dtmc = buildModel(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        mdp = buildModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    }
+
+    static std::shared_ptr<storm::server::CachedModel> buildModel(std::string const& prismFile) {
+        auto result = std::make_shared<storm::server::CachedModel>();
+        result->modelDescription = storm::parser::PrismParser::parse(prismFile);
+        result->model = storm::api::buildSparseModel<double>(result->modelDescription, storm::builder::BuilderOptions(true, true));
+        return result;
+    }
+
+    /*!
+     * Requests the given model from the cache and returns whether it was taken from the cache.
+     */
+    static bool isCached(storm::server::ModelCache& cache, std::string const& key, std::shared_ptr<storm::server::CachedModel> const& model) {
+        bool fromCache;
+        auto result = cache.getModel(key, [&model]() { return model; }, fromCache);
+        EXPECT_EQ(model, result);
+        return fromCache;
+    }
+
+    std::shared_ptr<storm::server::CachedModel> dtmc;
+    std::shared_ptr<storm::server::CachedModel> mdp;
+};
+
+TEST_F(ModelCacheTest, EvictLeastRecentlyUsed) {
+    storm::server::ModelCache cache(2, 1024 * 1024 * 1024);
+    EXPECT_FALSE(isCached(cache, "a", dtmc));
+    EXPECT_FALSE(isCached(cache, "b", mdp));
+    EXPECT_TRUE(isCached(cache, "a", dtmc));
+
+    // "b" is the least recently used model.
+    EXPECT_FALSE(isCached(cache, "c", dtmc));
+    EXPECT_TRUE(isCached(cache, "a", dtmc));
+    EXPECT_TRUE(isCached(cache, "c", dtmc));
+    EXPECT_FALSE(isCached(cache, "b", mdp));
+
+    // Inserting "b" again evicted "a".
+    EXPECT_TRUE(isCached(cache, "c", dtmc));
+    EXPECT_TRUE(isCached(cache, "b", mdp));
+    EXPECT_FALSE(isCached(cache, "a", dtmc));
+}
+
+TEST_F(ModelCacheTest, MemoryLimit) {
+    uint64_t dtmcMemory = storm::server::ModelCache::estimateMemoryInBytes(*dtmc->model);
+    uint64_t mdpMemory = storm::server::ModelCache::estimateMemoryInBytes(*mdp->model);
+    ASSERT_GT(dtmcMemory, 0ull);
+    ASSERT_GT(mdpMemory, dtmcMemory);
+
+    // Both models fit exactly into the cache.
+    storm::server::ModelCache cache(10, dtmcMemory + mdpMemory);
+    EXPECT_FALSE(isCached(cache, "dtmc", dtmc));
+    EXPECT_FALSE(isCached(cache, "mdp", mdp));
+    EXPECT_TRUE(isCached(cache, "dtmc", dtmc));
+    EXPECT_TRUE(isCached(cache, "mdp", mdp));
+
+    // The second copy of the model does not fit. Evicting the least recently used model frees enough memory.
+    EXPECT_FALSE(isCached(cache, "dtmc-copy", dtmc));
+    EXPECT_TRUE(isCached(cache, "mdp", mdp));
+    EXPECT_TRUE(isCached(cache, "dtmc-copy", dtmc));
+    EXPECT_FALSE(isCached(cache, "dtmc", dtmc));
+
+    // Inserting "dtmc" again evicted "mdp". The memory of evicted models is no longer accounted for, so both remaining models are kept.
+    EXPECT_TRUE(isCached(cache, "dtmc-copy", dtmc));
+    EXPECT_TRUE(isCached(cache, "dtmc", dtmc));
+    EXPECT_FALSE(isCached(cache, "mdp", mdp));
+    EXPECT_TRUE(isCached(cache, "dtmc", dtmc));
+}
+
+TEST_F(ModelCacheTest, ModelExceedsMemoryLimit) {
+    storm::server::ModelCache cache(10, storm::server::ModelCache::estimateMemoryInBytes(*mdp->model) - 1);
+    // A model that exceeds the limit on its own is returned, but not kept.
+    EXPECT_FALSE(isCached(cache, "mdp", mdp));
+    EXPECT_FALSE(isCached(cache, "mdp", mdp));
+    EXPECT_FALSE(isCached(cache, "dtmc", dtmc));
+    EXPECT_TRUE(isCached(cache, "dtmc", dtmc));
+}
+
+TEST_F(ModelCacheTest, FailedBuild) {
+    storm::server::ModelCache cache(2, 1024 * 1024 * 1024);
+    bool fromCache;
+    EXPECT_THROW(cache.getModel("a", []() -> std::shared_ptr<storm::server::CachedModel> { throw std::runtime_error("Build failed."); }, fromCache),
+                 std::runtime_error);
+    // Failed builds are not cached.
+    EXPECT_FALSE(isCached(cache, "a", dtmc));
+    EXPECT_TRUE(isCached(cache, "a", dtmc));
+}
+
+}  // namespace
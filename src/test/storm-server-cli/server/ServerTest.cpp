@@ -0,0 +1,129 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storm-server-cli/server/ModelCache.h"
+#include "storm-server-cli/server/Server.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace {
+
+class ServerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        serverThread = std::thread([this]() { server.run(); });
+        connection = connectToServer();
+        ASSERT_GE(connection, 0);
+    }
+
+    void TearDown() override {
+        if (connection >= 0) {
+            close(connection);
+        }
+        // The server checks regularly whether the termination was requested.
+        storm::utility::resources::SignalInformation::infos().setTerminate(true);
+        serverThread.join();
+        storm::utility::resources::resetTimeoutAlarm();
+    }
+
+    /*!
+     * Connects to the server, which might not yet listen on its socket.
+     */
+    int connectToServer() const {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        for (uint64_t attempt = 0; attempt < 100; ++attempt) {
+            int result = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (result >= 0 && connect(result, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+                return result;
+            }
+            close(result);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return -1;
+    }
+
+    /*!
+     * Sends the given request and retrieves all responses until the request is done.
+     */
+    std::vector<storm::json<double>> request(storm::json<double> const& request) {
+        std::string line = storm::dumpJson(request, true) + "\n";
+        EXPECT_EQ(static_cast<ssize_t>(line.size()), write(connection, line.data(), line.size()));
+        std::vector<storm::json<double>> responses;
+        while (responses.empty() || responses.back().count("done") == 0) {
+            std::size_t lineEnd;
+            while ((lineEnd = buffer.find('\n')) == std::string::npos) {
+                char chunk[4096];
+                ssize_t readRes = read(connection, chunk, sizeof(chunk));
+                if (readRes <= 0) {
+                    ADD_FAILURE() << "The connection was closed before the request was done.";
+                    return responses;
+                }
+                buffer.append(chunk, readRes);
+            }
+            responses.push_back(storm::json<double>::parse(buffer.substr(0, lineEnd)));
+            buffer.erase(0, lineEnd + 1);
+        }
+        return responses;
+    }
+
+    std::string socketPath = (std::filesystem::temp_directory_path() / ("storm-server-test-" + std::to_string(getpid()) + ".sock")).string();
+    storm::server::ModelCache modelCache{2, 1024 * 1024 * 1024};
+    storm::server::Server server{socketPath, 2, modelCache, 60};
+    std::thread serverThread;
+    int connection = -1;
+    std::string buffer;
+};
+
+TEST_F(ServerTest, CheckProperties) {
+    storm::json<double> dieRequest{{"id", 1}, {"model", STORM_TEST_RESOURCES_DIR "/dtmc/die.pm"}, {"properties", "P=? [F s=7&d=2]; P>0.5 [F s=7&d=2]"}};
+    auto responses = request(dieRequest);
+    ASSERT_EQ(3ull, responses.size());
+    for (auto const& response : responses) {
+        EXPECT_EQ(1, response["id"].get<int>());
+    }
+    EXPECT_NEAR(1.0 / 6.0, responses[0]["result"].get<double>(), 1e-6);
+    EXPECT_FALSE(responses[1]["result"].get<bool>());
+    EXPECT_FALSE(responses[2]["model-from-cache"].get<bool>());
+    EXPECT_EQ(13ull, responses[2]["states"].get<uint64_t>());
+
+    // The second request uses the cached model.
+    dieRequest["id"] = 2;
+    responses = request(dieRequest);
+    ASSERT_EQ(3ull, responses.size());
+    EXPECT_NEAR(1.0 / 6.0, responses[0]["result"].get<double>(), 1e-6);
+    EXPECT_TRUE(responses[2]["model-from-cache"].get<bool>());
+}
+
+TEST_F(ServerTest, Errors) {
+    // Properties that can not be parsed are rejected.
+    auto responses = request(storm::json<double>{{"id", 1}, {"model", STORM_TEST_RESOURCES_DIR "/dtmc/die.pm"}, {"properties", "P=? [F \"nolabel\"]"}});
+    ASSERT_EQ(1ull, responses.size());
+    EXPECT_EQ(1, responses[0]["id"].get<int>());
+    EXPECT_EQ(1ull, responses[0].count("error"));
+
+    // Requests without a model are rejected.
+    responses = request(storm::json<double>{{"id", "missing"}, {"properties", "P=? [F s=7]"}});
+    ASSERT_EQ(1ull, responses.size());
+    EXPECT_EQ("missing", responses[0]["id"].get<std::string>());
+    EXPECT_EQ(1ull, responses[0].count("error"));
+
+    // The connection remains usable afterwards.
+    responses = request(storm::json<double>{{"model", STORM_TEST_RESOURCES_DIR "/dtmc/die.pm"}, {"properties", "P=? [F s=7]"}});
+    ASSERT_EQ(2ull, responses.size());
+    EXPECT_NEAR(1.0, responses[0]["result"].get<double>(), 1e-6);
+}
+
+}  // namespace
@@ -0,0 +1,122 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+#include <tuple>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/modelchecker/hints/SparseAnalysisCache.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/graph.h"
+
+TEST(AnalysisCacheMdpPrctlModelCheckerTest, Dice) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [F \"two\"]; Pmax=? [F \"three\"]; Pmax=? [F \"two\"]; Pmin=? [F \"three\"]; Pmin=? [F \"two\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    auto analysisCache = std::make_shared<storm::modelchecker::SparseAnalysisCache<double>>(mdp->getTransitionMatrix(), 4);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    std::vector<double> expectedResults = {1.0 / 36.0, 2.0 / 36.0, 1.0 / 36.0, 2.0 / 36.0, 1.0 / 36.0};
+    for (uint64_t index = 0; index < formulas.size(); ++index) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[index], true);
+        task.setAnalysisCache(analysisCache);
+        auto result = checker.check(env, task);
+        EXPECT_NEAR(expectedResults[index], result->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()], 1e-6);
+    }
+
+    // Only the last query coincides with a previous one and reuses its qualitative analysis. All queries for a target that was checked before (with
+    // another optimization direction) are warm started.
+    std::stringstream statistics;
+    analysisCache->printStatistics(statistics);
+    EXPECT_NE(std::string::npos, statistics.str().find("1 hits, 4 misses"));
+    EXPECT_NE(std::string::npos, statistics.str().find("warm starts from stored solutions: 3"));
+    EXPECT_NE(std::string::npos, statistics.str().find("did not converge: 0"));
+    EXPECT_NE(std::string::npos, statistics.str().find("evicted solutions: 0"));
+
+    // The cached qualitative analysis coincides with the one of the model checker.
+    storm::storage::BitVector phiStates(mdp->getNumberOfStates(), true);
+    auto const& psiStates = mdp->getStates("two");
+    auto const& cachedStates = analysisCache->getStatesWithProbability01(storm::OptimizationDirection::Minimize, phiStates, psiStates);
+    auto expectedStates = storm::utility::graph::performProb01Min(*mdp, phiStates, psiStates);
+    EXPECT_EQ(expectedStates.first, cachedStates.first);
+    EXPECT_EQ(expectedStates.second, cachedStates.second);
+
+    // A cache that was created for another transition matrix is ignored.
+    auto otherMatrix = mdp->getTransitionMatrix();
+    auto otherCache = std::make_shared<storm::modelchecker::SparseAnalysisCache<double>>(otherMatrix);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[0], true);
+    task.setAnalysisCache(otherCache);
+    auto result = checker.check(env, task);
+    EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()], 1e-6);
+    std::stringstream otherStatistics;
+    otherCache->printStatistics(otherStatistics);
+    EXPECT_NE(std::string::npos, otherStatistics.str().find("0 hits, 0 misses"));
+}
+
+TEST(AnalysisCacheMdpPrctlModelCheckerTest, DiscardUnconvergedSolutions) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"three\"]; Pmin=? [F \"three\"]", program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    auto analysisCache = std::make_shared<storm::modelchecker::SparseAnalysisCache<double>>(mdp->getTransitionMatrix(), 4);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+
+    // A single iteration of value iteration does not suffice to converge, so the solution must not be used for warm starts.
+    storm::Environment unconvergedEnv;
+    unconvergedEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    unconvergedEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    unconvergedEnv.solver().minMax().setMaximalNumberOfIterations(1);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> unconvergedTask(*formulas[0], true);
+    unconvergedTask.setAnalysisCache(analysisCache);
+    checker.check(unconvergedEnv, unconvergedTask);
+
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[1], true);
+    task.setAnalysisCache(analysisCache);
+    auto result = checker.check(env, task);
+    EXPECT_NEAR(2.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()], 1e-6);
+
+    std::stringstream statistics;
+    analysisCache->printStatistics(statistics);
+    EXPECT_NE(std::string::npos, statistics.str().find("warm starts from stored solutions: 0"));
+    EXPECT_NE(std::string::npos, statistics.str().find("did not converge: 1"));
+}
+
+TEST(AnalysisCacheMdpPrctlModelCheckerTest, BoundedSolutions) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [F \"two\"]; Pmax=? [F \"three\"]; Pmax=? [F \"two\"]; Pmin=? [F \"three\"]; Pmin=? [F \"two\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    std::vector<double> expectedResults = {1.0 / 36.0, 2.0 / 36.0, 1.0 / 36.0, 2.0 / 36.0, 1.0 / 36.0};
+
+    // Without room for solutions, checks are never warm started. With room for two solutions, the solution for "three" is evicted before it can be
+    // reused, whereas the solutions for "two" are still available when "two" is checked again.
+    std::vector<std::tuple<uint64_t, std::string, std::string>> expectedStatistics = {
+        {0, "warm starts from stored solutions: 0", "evicted solutions: 0"}, {2, "warm starts from stored solutions: 2", "evicted solutions: 3"}};
+    for (auto const& [maximalNumberOfStoredSolutions, expectedWarmStarts, expectedEvictions] : expectedStatistics) {
+        auto analysisCache = std::make_shared<storm::modelchecker::SparseAnalysisCache<double>>(mdp->getTransitionMatrix(), maximalNumberOfStoredSolutions);
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[index], true);
+            task.setAnalysisCache(analysisCache);
+            auto result = checker.check(env, task);
+            EXPECT_NEAR(expectedResults[index], result->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()], 1e-6);
+        }
+        std::stringstream statistics;
+        analysisCache->printStatistics(statistics);
+        EXPECT_NE(std::string::npos, statistics.str().find(expectedWarmStarts)) << statistics.str();
+        EXPECT_NE(std::string::npos, statistics.str().find(expectedEvictions)) << statistics.str();
+    }
+}
@@ -2,6 +2,7 @@
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -9,8 +10,14 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
 #include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/prism.h"
 
 TEST(SparseDtmcEliminationModelCheckerTest, Die) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
@@ -139,3 +146,144 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+namespace {
+storm::settings::modules::EliminationSettings& mutableEliminationSettings() {
+    return dynamic_cast<storm::settings::modules::EliminationSettings&>(
+        storm::settings::mutableManager().getModule(storm::settings::modules::EliminationSettings::moduleName));
+}
+
+// Selects the given elimination method and order and restores the previously selected ones upon destruction.
+class EliminationSettingsGuard {
+   public:
+    EliminationSettingsGuard(std::string const& method, std::string const& order)
+        : previousMethod(mutableEliminationSettings().getEliminationMethodName()), previousOrder(mutableEliminationSettings().getEliminationOrderName()) {
+        mutableEliminationSettings().setEliminationMethod(method);
+        mutableEliminationSettings().setEliminationOrder(order);
+    }
+
+    ~EliminationSettingsGuard() {
+        mutableEliminationSettings().setEliminationMethod(previousMethod);
+        mutableEliminationSettings().setEliminationOrder(previousOrder);
+    }
+
+   private:
+    std::string previousMethod;
+    std::string previousOrder;
+};
+
+std::unique_ptr<storm::settings::SettingMemento> overrideEliminationOption(std::string const& name, bool value) {
+    return storm::settings::mutableManager().getModule(storm::settings::modules::EliminationSettings::moduleName).overrideOption(name, value);
+}
+
+std::unique_ptr<storm::settings::SettingMemento> overrideIntelTbb(bool value) {
+    return storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName).overrideOption("enable-tbb", value);
+}
+}  // namespace
+
+TEST(SparseDtmcEliminationModelCheckerTest, FillInOrder) {
+    EliminationSettingsGuard settingsGuard(mutableEliminationSettings().getEliminationMethodName(), "fillin");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
+        STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", STORM_TEST_RESOURCES_DIR "/rew/die.coin_flips.trans.rew");
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]"));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    result = checker.check(*formulaParser.parseSingleFormulaFromString("R=? [F \"done\"]"));
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[0],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> crowdsChecker(*dtmc);
+    result = crowdsChecker.check(*formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]"));
+    EXPECT_NEAR(0.3328800375801578281, result->asExplicitQuantitativeCheckResult<double>()[0],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    result = crowdsChecker.check(*formulaParser.parseSingleFormulaFromString("P=? [F \"observeOnlyTrueSender\"]"));
+    EXPECT_NEAR(0.32153724292835045, result->asExplicitQuantitativeCheckResult<double>()[0],
+                storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
+namespace {
+// From the initial state, one of eight loops is entered. Each loop is a sub-SCC that is small enough to be eliminated directly, but all of them together
+// exceed the maximal SCC size, so the loops are independent SCCs for the hybrid elimination. The probability to leave loop b successfully is q*b.
+std::string const independentSccsProgram = R"(
+dtmc
+
+const double q;
+
+module loops
+    b : [0..8] init 0;
+    p : [0..2] init 0;
+    done : [0..2] init 0;
+
+    [] b=0 -> 0.125 : (b'=1) + 0.125 : (b'=2) + 0.125 : (b'=3) + 0.125 : (b'=4)
+            + 0.125 : (b'=5) + 0.125 : (b'=6) + 0.125 : (b'=7) + 0.125 : (b'=8);
+    [] b>0 & done=0 & p<2 -> 0.9 : (p'=p+1) + 0.1 : (done'=2);
+    [] b>0 & done=0 & p=2 -> q*b : (done'=1) + 1-q*b : (p'=0);
+    [] done>0 -> true;
+endmodule
+
+label "goal" = done=1;
+)";
+
+/*!
+ * Checks the probability to reach the goal of the program above with the hybrid elimination, where the SCCs are eliminated sequentially in the
+ * recursion, independently of each other, and independently with Intel TBB enabled (which is only effective for non-parametric models).
+ */
+template<typename ValueType>
+std::vector<ValueType> checkIndependentSccs(std::string const& constantDefinitions) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(independentSccsProgram, "loops.pm");
+    program = storm::utility::prism::preprocess(program, constantDefinitions);
+    storm::parser::FormulaParser formulaParser(program);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"goal\"]");
+    auto dtmc = storm::api::buildSparseModel<ValueType>(program, {formula})->template as<storm::models::sparse::Dtmc<ValueType>>();
+    EXPECT_GT(dtmc->getNumberOfStates(), storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize());
+
+    EliminationSettingsGuard settingsGuard("hybrid", mutableEliminationSettings().getEliminationOrderName());
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(*dtmc);
+    auto const& initialState = *dtmc->getInitialStates().begin();
+    std::vector<ValueType> results;
+    for (auto [independentSccs, intelTbb] : {std::make_pair(false, false), std::make_pair(true, false), std::make_pair(true, true)}) {
+        auto independentSccsMemento = overrideEliminationOption("independentsccs", independentSccs);
+        auto intelTbbMemento = overrideIntelTbb(intelTbb);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formula);
+        results.push_back(result->template asExplicitQuantitativeCheckResult<ValueType>()[initialState]);
+    }
+    return results;
+}
+}  // namespace
+
+TEST(SparseDtmcEliminationModelCheckerTest, HybridIndependentSccs) {
+    // Within loop b, the goal is reached with probability 0.81q / (1 - 0.81(1-q)) where q = 0.05b is the probability to leave the loop successfully.
+    double expectedResult = 0.0;
+    for (uint64_t loop = 1; loop <= 8; ++loop) {
+        double exitProbability = 0.05 * loop;
+        expectedResult += 0.125 * 0.81 * exitProbability / (1.0 - 0.81 * (1.0 - exitProbability));
+    }
+
+    auto results = checkIndependentSccs<double>("q=0.05");
+    for (auto const& result : results) {
+        EXPECT_NEAR(expectedResult, result, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+    EXPECT_NEAR(results[0], results[1], 1e-12);
+    EXPECT_NEAR(results[0], results[2], 1e-12);
+}
+
+TEST(SparseDtmcEliminationModelCheckerTest, HybridIndependentSccsExact) {
+    auto results = checkIndependentSccs<storm::RationalNumber>("q=0.05");
+    EXPECT_EQ(results[0], results[1]);
+    EXPECT_EQ(results[0], results[2]);
+}
+
+TEST(SparseDtmcEliminationModelCheckerTest, HybridIndependentSccsParametric) {
+    // Parametric models are never eliminated concurrently, but the independent SCCs are still eliminated separately if requested.
+    auto results = checkIndependentSccs<storm::RationalFunction>("");
+    EXPECT_TRUE(storm::utility::isZero(results[0] - results[1])) << results[0] << " vs. " << results[1];
+    EXPECT_TRUE(storm::utility::isZero(results[0] - results[2])) << results[0] << " vs. " << results[2];
+}
@@ -0,0 +1,112 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
+#include "storm/models/sparse/Smg.h"
+
+namespace {
+
+class SmgRpatlModelCheckerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/simple_game.nm");
+    }
+
+    std::vector<double> check(storm::Environment const& env, std::string const& formulasString) {
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas);
+        EXPECT_EQ(storm::models::ModelType::Smg, model->getType());
+        std::vector<double> result;
+        for (auto const& formula : formulas) {
+            auto checkResult = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formula, false));
+            EXPECT_TRUE(checkResult != nullptr) << *formula;
+            if (checkResult) {
+                result.push_back(checkResult->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()]);
+            }
+        }
+        return result;
+    }
+
+    storm::Environment createEnvironment(bool optimistic) const {
+        storm::Environment env;
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().game().setRelativeTerminationCriterion(false);
+        env.solver().game().setOptimisticBounds(optimistic);
+        return env;
+    }
+
+    storm::prism::Program program;
+};
+
+TEST_F(SmgRpatlModelCheckerTest, Probabilities) {
+    for (bool optimistic : {false, true}) {
+        auto result = check(createEnvironment(optimistic),
+                            "<<controller>> Pmax=? [F \"goal\"]; <<controller>> Pmin=? [F \"goal\"]; <<environment>> Pmax=? [G !\"goal\"]; "
+                            "<<controller>> Pmax=? [X s=1]; <<environment>> Pmax=? [X s=1]");
+        ASSERT_EQ(5ull, result.size());
+        EXPECT_NEAR(0.8, result[0], 1e-6);
+        EXPECT_NEAR(1.0, result[1], 1e-6);
+        EXPECT_NEAR(0.2, result[2], 1e-6);
+        EXPECT_NEAR(0.5, result[3], 1e-6);
+        EXPECT_NEAR(0.0, result[4], 1e-6);
+    }
+}
+
+TEST_F(SmgRpatlModelCheckerTest, Rewards) {
+    for (bool optimistic : {false, true}) {
+        auto result = check(createEnvironment(optimistic),
+                            "<<controller>> Rmin=? [F \"done\"]; <<controller>> Rmax=? [F \"done\"]; <<controller>> Rmin=? [F \"goal\"]");
+        ASSERT_EQ(3ull, result.size());
+        EXPECT_NEAR(40.0 / 13.0, result[0], 1e-6);
+        EXPECT_NEAR(2.0, result[1], 1e-6);
+        EXPECT_TRUE(storm::utility::isInfinity(result[2]));
+    }
+}
+
+TEST_F(SmgRpatlModelCheckerTest, ZeroRewardChoices) {
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/zero_reward_game.nm");
+    for (bool optimistic : {false, true}) {
+        // The minimizer has a choice without reward, but every cycle collects reward.
+        auto result = check(createEnvironment(optimistic), "<<minimizer>> R{\"cost\"}min=? [F \"goal\"]");
+        ASSERT_EQ(1ull, result.size());
+        EXPECT_NEAR(2.5, result[0], 1e-6);
+
+        // The self-loop without reward is an end component in which the play can stay forever.
+        STORM_SILENT_EXPECT_THROW(check(createEnvironment(optimistic), "<<minimizer>> R{\"free\"}min=? [F \"goal\"]"),
+                                  storm::exceptions::NotSupportedException);
+    }
+}
+
+TEST_F(SmgRpatlModelCheckerTest, QualitativeAnalysis) {
+    auto model = storm::api::buildSparseModel<double>(program, std::vector<std::shared_ptr<storm::logic::Formula const>>())
+                     ->as<storm::models::sparse::Smg<double>>();
+    storm::logic::PlayerCoalition controller({std::string("controller")});
+    auto controllerStates = model->computeStatesOfCoalition(controller);
+    auto goalStates = model->getStates("goal");
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    using Helper = storm::modelchecker::helper::SparseSmgRpatlHelper<double>;
+
+    // The controller can not enforce reaching the goal almost surely, but the environment can.
+    uint64_t initialState = *model->getInitialStates().begin();
+    auto controllerProb1 = Helper::computeStatesWithProbability1(model->getTransitionMatrix(), model->getBackwardTransitions(), allStates, goalStates,
+                                                                 controllerStates);
+    EXPECT_FALSE(controllerProb1.get(initialState));
+    EXPECT_EQ(2ull, controllerProb1.getNumberOfSetBits());
+    auto environmentProb1 = Helper::computeStatesWithProbability1(model->getTransitionMatrix(), model->getBackwardTransitions(), allStates, goalStates,
+                                                                  ~controllerStates);
+    EXPECT_TRUE(environmentProb1.get(initialState));
+    EXPECT_EQ(model->getNumberOfStates() - 1, environmentProb1.getNumberOfSetBits());
+
+    // Only the failure state can not reach the goal with positive probability.
+    auto controllerProbGreater0 = Helper::computeStatesWithProbabilityGreater0(model->getTransitionMatrix(), model->getBackwardTransitions(), allStates,
+                                                                               goalStates, controllerStates);
+    EXPECT_EQ(model->getNumberOfStates() - 1, controllerProbGreater0.getNumberOfSetBits());
+}
+
+}  // namespace
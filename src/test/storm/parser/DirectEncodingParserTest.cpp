@@ -1,7 +1,11 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <filesystem>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/CompressedFileStream.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
@@ -97,3 +101,41 @@ TEST(DirectEncodingParserTest, IntervalDtmcTest) {
     ASSERT_EQ(613ul, dtmc->getNumberOfStates());
     EXPECT_TRUE(modelPtr->hasUncertainty());
 }
+
+TEST(DirectEncodingParserTest, CompressedExportAndParsing) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+
+    std::vector<storm::io::CompressionMode> modes = {storm::io::CompressionMode::None};
+#ifdef STORM_HAVE_ZLIB
+    modes.push_back(storm::io::CompressionMode::Gzip);
+#endif
+#ifdef STORM_HAVE_ZSTD
+    modes.push_back(storm::io::CompressionMode::Zstd);
+#endif
+    for (auto const& mode : modes) {
+        std::string filename = (std::filesystem::temp_directory_path() / "storm-test-two_dice.drn").string();
+        if (mode == storm::io::CompressionMode::Gzip) {
+            filename += ".gz";
+        } else if (mode == storm::io::CompressionMode::Zstd) {
+            filename += ".zst";
+        }
+        {
+            storm::io::CompressedOutputFileStream stream(filename);
+            stream.precision(17);
+            storm::exporter::DirectEncodingOptions options;
+            // Use tiny blocks to test the block-wise output
+            options.transitionsPerBlock = 10;
+            storm::exporter::explicitExportSparseModel(stream, modelPtr, {}, options);
+        }
+        auto parsedModel = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+        std::filesystem::remove(filename);
+
+        EXPECT_EQ(storm::models::ModelType::Mdp, parsedModel->getType()) << storm::io::toString(mode);
+        EXPECT_EQ(modelPtr->getTransitionMatrix(), parsedModel->getTransitionMatrix()) << storm::io::toString(mode);
+        EXPECT_EQ(modelPtr->getStateLabeling(), parsedModel->getStateLabeling()) << storm::io::toString(mode);
+        ASSERT_TRUE(parsedModel->hasRewardModel("coinflips"));
+        EXPECT_EQ(modelPtr->getRewardModel("coinflips").getStateActionRewardVector(),
+                  parsedModel->getRewardModel("coinflips").getStateActionRewardVector());
+    }
+}
@@ -37,6 +37,19 @@ class DoubleViRegMultEnvironment {
     }
 };
 
+class DoublePrioritizedViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPrioritizedValueIteration(true);
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -63,6 +76,20 @@ class DoubleIntervalIterationEnvironment {
     }
 };
 
+class DoubleSinglePrecisionIntervalIterationEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().setSinglePrecisionMatrix(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+};
+
 class DoubleOptimisticViEnvironment {
    public:
     typedef double ValueType;
@@ -113,6 +140,15 @@ class RationalPIEnvironment {
         return env;
     }
 };
+class RationalDefaultEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        // The default method is replaced by an exact one.
+        return storm::Environment();
+    }
+};
 class RationalRationalSearchEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -143,8 +179,9 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
-                         DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
+typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoublePrioritizedViEnvironment, DoubleSoundViEnvironment,
+                         DoubleIntervalIterationEnvironment, DoubleSinglePrecisionIntervalIterationEnvironment, DoubleOptimisticViEnvironment,
+                         DoubleTopologicalViEnvironment, DoublePIEnvironment, RationalPIEnvironment, RationalDefaultEnvironment,
                          RationalRationalSearchEnvironment>
     TestingTypes;
 
@@ -0,0 +1,84 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+// Maximizes over the choices of each row group.
+class MaximizingBackend {
+   public:
+    void startNewIteration() {}
+    void firstRow(double&& value, uint64_t, uint64_t) {
+        best = value;
+    }
+    void nextRow(double&& value, uint64_t, uint64_t) {
+        best = std::max(best, value);
+    }
+    void applyUpdate(double& result, uint64_t) {
+        result = best;
+    }
+    void endOfIteration() const {}
+    bool converged() const {
+        return false;
+    }
+    bool abort() const {
+        return false;
+    }
+
+   private:
+    double best;
+};
+
+storm::storage::SparseMatrix<double> createMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < 10; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice <= group % 3; ++choice, ++row) {
+            uint64_t const firstColumn = (group + choice) % 10;
+            uint64_t const secondColumn = (group + choice + 3) % 10;
+            builder.addNextValue(row, std::min(firstColumn, secondColumn), 0.5);
+            builder.addNextValue(row, std::max(firstColumn, secondColumn), 0.25 + 0.1 * choice);
+        }
+    }
+    return builder.build(row, 10, 10);
+}
+}  // namespace
+
+TEST(ValueIterationOperatorTest, ApplyOnPartitions) {
+    auto matrix = createMatrix();
+    std::vector<double> offsets(matrix.getRowCount());
+    for (uint64_t row = 0; row < offsets.size(); ++row) {
+        offsets[row] = 0.01 * row;
+    }
+    std::vector<double> operandIn = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
+
+    for (bool backwards : {true, false}) {
+        for (bool ignoreRows : {false, true}) {
+            storm::solver::helper::ValueIterationOperator<double, false> viOperator;
+            if (backwards) {
+                viOperator.setMatrixBackwards(matrix);
+            } else {
+                viOperator.setMatrixForwards(matrix);
+            }
+            if (ignoreRows) {
+                viOperator.setIgnoredRows(true, [](uint64_t group, uint64_t row) { return group % 2 == 0 && row > 0; });
+            }
+            MaximizingBackend backend;
+            std::vector<double> expected(operandIn.size());
+            viOperator.apply(operandIn, expected, offsets, backend);
+
+            for (uint64_t numberOfPartitions : {1ull, 3ull, 100ull}) {
+                uint64_t const actualNumberOfPartitions = viOperator.setPartitioning(numberOfPartitions);
+                EXPECT_EQ(actualNumberOfPartitions, viOperator.getNumberOfPartitions());
+                EXPECT_LE(actualNumberOfPartitions, std::min<uint64_t>(numberOfPartitions, operandIn.size()));
+                std::vector<double> result(operandIn.size(), -1.0);
+                for (uint64_t partition = 0; partition < actualNumberOfPartitions; ++partition) {
+                    viOperator.applyOnPartition(partition, operandIn, result, offsets, backend);
+                }
+                EXPECT_EQ(expected, result);
+            }
+        }
+    }
+}
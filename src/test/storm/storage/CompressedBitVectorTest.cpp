@@ -0,0 +1,130 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
+
+namespace {
+// Creates a bit vector whose chunks of 2^16 bits are represented by the different container types.
+storm::storage::BitVector createMixedBitVector(uint64_t length) {
+    storm::storage::BitVector result(length);
+    // A few sparse bits in the first chunk.
+    for (uint64_t index : {0ull, 17ull, 4711ull, 65535ull}) {
+        result.set(index);
+    }
+    // Many scattered bits in the second chunk.
+    for (uint64_t index = 65536; index < 2 * 65536; index += 3) {
+        result.set(index);
+    }
+    // Two long runs in the fourth chunk (the third chunk stays empty).
+    result.setMultiple(3 * 65536 + 10, 30000);
+    result.setMultiple(3 * 65536 + 40000, 20000);
+    // A single bit at the very end.
+    result.set(length - 1);
+    return result;
+}
+}  // namespace
+
+TEST(CompressedBitVectorTest, InitAndGetSet) {
+    storm::storage::CompressedBitVector vector(200000);
+    EXPECT_EQ(200000ul, vector.size());
+    EXPECT_TRUE(vector.empty());
+    EXPECT_FALSE(vector.full());
+
+    vector.set(5);
+    vector.set(70000);
+    vector.set(199999);
+    EXPECT_TRUE(vector.get(5));
+    EXPECT_TRUE(vector.get(70000));
+    EXPECT_TRUE(vector.get(199999));
+    EXPECT_FALSE(vector.get(6));
+    EXPECT_FALSE(vector.get(131072));
+    EXPECT_EQ(3ul, vector.getNumberOfSetBits());
+
+    std::vector<uint64_t> indices(vector.begin(), vector.end());
+    EXPECT_EQ(std::vector<uint64_t>({5, 70000, 199999}), indices);
+
+    vector.set(70000, false);
+    EXPECT_FALSE(vector.get(70000));
+    EXPECT_EQ(2ul, vector.getNumberOfSetBits());
+
+    storm::storage::CompressedBitVector fullVector(200000, true);
+    EXPECT_TRUE(fullVector.full());
+    EXPECT_EQ(200000ul, fullVector.getNumberOfSetBits());
+    fullVector.set(100000, false);
+    EXPECT_FALSE(fullVector.full());
+    EXPECT_FALSE(fullVector.get(100000));
+    EXPECT_TRUE(fullVector.get(99999));
+    EXPECT_TRUE(fullVector.get(100001));
+    EXPECT_EQ(199999ul, fullVector.getNumberOfSetBits());
+}
+
+TEST(CompressedBitVectorTest, ContainerConversions) {
+    storm::storage::CompressedBitVector vector(65536);
+    storm::storage::BitVector expected(65536);
+    // Exceed the capacity of an array container and go back.
+    for (uint64_t index = 0; index < 65536; index += 7) {
+        vector.set(index);
+        expected.set(index);
+    }
+    EXPECT_EQ(expected, vector.toBitVector());
+    for (uint64_t index = 0; index < 65536; index += 14) {
+        vector.set(index, false);
+        expected.set(index, false);
+    }
+    EXPECT_EQ(expected, vector.toBitVector());
+    EXPECT_EQ(expected.getNumberOfSetBits(), vector.getNumberOfSetBits());
+    for (uint64_t index : expected) {
+        vector.set(index, false);
+    }
+    EXPECT_TRUE(vector.empty());
+}
+
+TEST(CompressedBitVectorTest, ConversionFromAndToBitVector) {
+    storm::storage::BitVector bitVector = createMixedBitVector(300000);
+    storm::storage::CompressedBitVector compressed(bitVector);
+    EXPECT_EQ(bitVector.size(), compressed.size());
+    EXPECT_EQ(bitVector.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+    EXPECT_EQ(bitVector, compressed.toBitVector());
+
+    std::vector<uint64_t> expectedIndices(bitVector.begin(), bitVector.end());
+    std::vector<uint64_t> indices(compressed.begin(), compressed.end());
+    EXPECT_EQ(expectedIndices, indices);
+    for (uint64_t index = 0; index < bitVector.size(); index += 997) {
+        EXPECT_EQ(bitVector.get(index), compressed.get(index));
+    }
+}
+
+TEST(CompressedBitVectorTest, SetAlgebra) {
+    storm::storage::BitVector first = createMixedBitVector(300000);
+    storm::storage::BitVector second(300000);
+    for (uint64_t index = 0; index < 300000; index += 5) {
+        second.set(index);
+    }
+    second.setMultiple(200000, 1000);
+    storm::storage::CompressedBitVector compressedFirst(first);
+    storm::storage::CompressedBitVector compressedSecond(second);
+
+    EXPECT_EQ(first & second, (compressedFirst & compressedSecond).toBitVector());
+    EXPECT_EQ(first | second, (compressedFirst | compressedSecond).toBitVector());
+    EXPECT_EQ(~first, (~compressedFirst).toBitVector());
+    EXPECT_EQ(~second, (~compressedSecond).toBitVector());
+    EXPECT_EQ(compressedFirst, ~~compressedFirst);
+    EXPECT_EQ(storm::storage::CompressedBitVector(first & second), compressedFirst & compressedSecond);
+    EXPECT_NE(compressedFirst, compressedSecond);
+    EXPECT_TRUE((compressedFirst & ~compressedFirst).empty());
+    EXPECT_TRUE((compressedFirst | ~compressedFirst).full());
+}
+
+TEST(CompressedBitVectorTest, SparseMemory) {
+    uint64_t const length = 100000000;
+    storm::storage::BitVector bitVector(length);
+    for (uint64_t index = 0; index < length; index += length / 10) {
+        bitVector.set(index);
+    }
+    storm::storage::CompressedBitVector compressed(bitVector);
+    EXPECT_EQ(10ul, compressed.getNumberOfSetBits());
+    EXPECT_LT(compressed.getSizeInBytes(), bitVector.getSizeInBytes() / 1000);
+    // The complement of a sparse vector is a dense vector with few runs, which is small as well.
+    EXPECT_LT((~compressed).getSizeInBytes(), bitVector.getSizeInBytes() / 10);
+}
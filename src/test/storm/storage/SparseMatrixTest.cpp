@@ -830,6 +830,46 @@ TEST(SparseMatrix, Permute) {
     EXPECT_EQ(matrix.getRowSum(2), matrixperm.getRowSum(4));
 }
 
+TEST(SparseMatrix, PermuteRowGroupsAndColumns) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 3, 7, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 0.4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 0.6));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 0, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 0.7));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    // New state i corresponds to old state inversePermutation[i].
+    std::vector<uint64_t> inversePermutation = {2, 0, 1};
+    std::vector<uint64_t> permutation = {1, 2, 0};
+    storm::storage::SparseMatrix<double> permuted;
+    ASSERT_NO_THROW(permuted = matrix.permuteRowGroupsAndColumns(inversePermutation, permutation));
+
+    storm::storage::SparseMatrixBuilder<double> expectedBuilder(4, 3, 7, true, true, 3);
+    ASSERT_NO_THROW(expectedBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(expectedBuilder.addNextValue(0, 0, 0.7));
+    ASSERT_NO_THROW(expectedBuilder.addNextValue(0, 1, 0.3));
+    ASSERT_NO_THROW(expectedBuilder.newRowGroup(1));
+    ASSERT_NO_THROW(expectedBuilder.addNextValue(1, 0, 0.6));
+    ASSERT_NO_THROW(expectedBuilder.addNextValue(1, 2, 0.4));
+    ASSERT_NO_THROW(expectedBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(expectedBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(expectedBuilder.addNextValue(2, 1, 0.5));
+    ASSERT_NO_THROW(expectedBuilder.addNextValue(3, 2, 1.0));
+    storm::storage::SparseMatrix<double> expected;
+    ASSERT_NO_THROW(expected = expectedBuilder.build());
+    EXPECT_EQ(expected, permuted);
+
+    // Permuting back yields the original matrix.
+    EXPECT_EQ(matrix, permuted.permuteRowGroupsAndColumns(permutation, inversePermutation));
+}
+
 TEST(SparseMatrix, DropZeroEntries) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 3, 8, true, true);
     ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
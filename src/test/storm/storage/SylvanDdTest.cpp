@@ -3,16 +3,20 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/utility/dd.h"
 
 #include "storm/storage/SparseMatrix.h"
 
 #include "carl/util/stringparser.h"
 
+#include <functional>
 #include <iostream>
 #include <memory>
 
@@ -390,6 +394,31 @@ TEST(SylvanDd, EncodingTest) {
     EXPECT_EQ(2ul, add.getLeafCount());
 }
 
+TEST(SylvanDd, CombineBalancedTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, double>> adds;
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> bdds;
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> sequentialSum = manager->template getAddZero<double>();
+    for (int_fast64_t value = 1; value <= 7; ++value) {
+        bdds.push_back(manager->getEncoding(x.first, value));
+        adds.push_back(bdds.back().template toAdd<double>() * manager->template getConstant<double>(value));
+        sequentialSum += adds.back();
+    }
+
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> balancedSum;
+    ASSERT_NO_THROW(balancedSum = storm::utility::dd::combineBalanced(adds, manager->template getAddZero<double>(), std::plus<>()));
+    EXPECT_EQ(sequentialSum, balancedSum);
+    EXPECT_EQ(7ul, balancedSum.getNonZeroCount());
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> disjunction = storm::utility::dd::combineBalanced(bdds, manager->getBddZero(), std::logical_or<>());
+    EXPECT_EQ(7ul, disjunction.getNonZeroCount());
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> empty = storm::utility::dd::combineBalanced({}, manager->getBddZero(), std::logical_or<>());
+    EXPECT_TRUE(empty.isZero());
+}
+
 TEST(SylvanDd, RationalFunctionConstants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalFunction> zero;
@@ -830,6 +859,49 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, AddToMatrixConcurrentTest) {
+    // The translation into a sparse matrix is performed concurrently for floating point ADDs with at least 1024 rows if Intel TBB is enabled.
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 2999);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> range =
+        manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> rowValue = manager->template getIdentity<double>(x.first);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> columnValue = manager->template getIdentity<double>(x.second);
+
+    // Every row has an entry on the diagonal, in the mirrored column and in the first column.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        rowValue.equals(columnValue).template toAdd<double>() * (rowValue + manager->template getConstant<double>(1));
+    dd += (rowValue + columnValue).equals(manager->template getConstant<double>(2999)).template toAdd<double>() * manager->template getConstant<double>(0.5);
+    dd += manager->getEncoding(x.second, 0).template toAdd<double>() * manager->template getConstant<double>(0.25);
+    dd *= range;
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> nondeterministicDd = manager->getEncoding(a.first, 0).ite(dd, dd * columnValue) * range;
+
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    ASSERT_GE(rowOdd.getTotalOffset(), 1024ul);
+
+    storm::storage::SparseMatrix<double> sequentialMatrix, concurrentMatrix, sequentialNondeterministicMatrix, concurrentNondeterministicMatrix;
+    {
+        auto disableTbb = storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName).overrideOption("enable-tbb", false);
+        sequentialMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+        sequentialNondeterministicMatrix = nondeterministicDd.toMatrix({a.first}, rowOdd, columnOdd);
+    }
+    {
+        auto enableTbb = storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName).overrideOption("enable-tbb", true);
+        concurrentMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+        concurrentNondeterministicMatrix = nondeterministicDd.toMatrix({a.first}, rowOdd, columnOdd);
+    }
+
+    EXPECT_EQ(3000ul, sequentialMatrix.getRowCount());
+    // The first row has its diagonal entry and the last row has its mirrored entry in the first column.
+    EXPECT_EQ(3 * 3000ul - 2, sequentialMatrix.getNonzeroEntryCount());
+    EXPECT_EQ(sequentialMatrix, concurrentMatrix);
+    EXPECT_EQ(6000ul, sequentialNondeterministicMatrix.getRowCount());
+    EXPECT_EQ(3000ul, sequentialNondeterministicMatrix.getRowGroupCount());
+    EXPECT_EQ(sequentialNondeterministicMatrix, concurrentNondeterministicMatrix);
+}
+
 TEST(SylvanDd, AddSharpenTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
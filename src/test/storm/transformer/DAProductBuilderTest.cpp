@@ -74,6 +74,13 @@ TEST(DAProductBuilderTest_aUb, Dtmc) {
     //   std::cout << i << ": " << product->getAcceptance()->getAcceptanceSet(i) << "\n";
     // }
 
+    for (uint64_t productState = 0; productState < product->getProductModel().getNumberOfStates(); ++productState) {
+        auto modelState = product->getModelState(productState);
+        auto automatonState = product->getAutomatonState(productState);
+        ASSERT_TRUE(product->isValidProductState(modelState, automatonState));
+        EXPECT_EQ(productState, product->getProductStateIndex(modelState, automatonState));
+    }
+
     storm::storage::StateBlock scc;
     scc.insert(7);
     ASSERT_EQ(product->getAcceptance()->isAccepting(scc), 1);
@@ -0,0 +1,138 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/transformer/StatePermuter.h"
+
+namespace {
+
+template<typename ValueType>
+std::vector<ValueType> checkAllStates(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                      std::shared_ptr<storm::logic::Formula const> const& formula) {
+    auto result = storm::api::verifyWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, false));
+    return result->template asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+}
+
+}  // namespace
+
+TEST(StatePermuterTest, OrdersArePermutations) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto model = storm::api::buildSparseModel<double>(program, std::vector<std::shared_ptr<storm::logic::Formula const>>());
+    for (auto order : {storm::transformer::StateOrder::Bfs, storm::transformer::StateOrder::ReverseCuthillMcKee,
+                       storm::transformer::StateOrder::SccTopological}) {
+        auto newToOld = storm::transformer::computeStateOrder(order, model->getTransitionMatrix(), model->getInitialStates());
+        ASSERT_EQ(model->getNumberOfStates(), newToOld.size()) << storm::transformer::toString(order);
+        storm::storage::BitVector covered(newToOld.size(), false);
+        for (auto state : newToOld) {
+            covered.set(state, true);
+        }
+        EXPECT_TRUE(covered.full()) << storm::transformer::toString(order);
+        if (order == storm::transformer::StateOrder::Bfs) {
+            EXPECT_TRUE(model->getInitialStates().get(newToOld.front()));
+        }
+    }
+}
+
+TEST(StatePermuterTest, DieExact) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::string formulasString = "P=? [ F \"two\" ]; R{\"coin_flips\"}=? [ F \"done\" ]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas);
+
+    for (auto order : {storm::transformer::StateOrder::Bfs, storm::transformer::StateOrder::ReverseCuthillMcKee,
+                       storm::transformer::StateOrder::SccTopological}) {
+        auto permuted = storm::transformer::permuteStates(*model, order);
+        ASSERT_EQ(model->getType(), permuted.model->getType());
+        EXPECT_EQ(model->getNumberOfStates(), permuted.model->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfTransitions(), permuted.model->getNumberOfTransitions());
+        for (uint64_t newState = 0; newState < permuted.model->getNumberOfStates(); ++newState) {
+            uint64_t oldState = permuted.newToOldStateIndexMapping[newState];
+            EXPECT_EQ(model->getInitialStates().get(oldState), permuted.model->getInitialStates().get(newState));
+        }
+        for (auto const& formula : formulas) {
+            auto expected = checkAllStates(model, formula);
+            auto actual = storm::transformer::translateToOriginalIndices(permuted.newToOldStateIndexMapping, checkAllStates(permuted.model, formula));
+            EXPECT_EQ(expected, actual) << storm::transformer::toString(order) << ": " << *formula;
+        }
+    }
+}
+
+TEST(StatePermuterTest, TwoDice) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [ F \"two\" ]; Pmax=? [ F \"seven\" ]; Rmin=? [ F \"done\" ]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    storm::builder::BuilderOptions options(formulas, program);
+    options.setBuildStateValuations();
+    options.setBuildChoiceLabels();
+    auto model = storm::api::buildSparseModel<double>(program, options);
+
+    for (auto order : {storm::transformer::StateOrder::Bfs, storm::transformer::StateOrder::ReverseCuthillMcKee,
+                       storm::transformer::StateOrder::SccTopological}) {
+        auto permuted = storm::transformer::permuteStates(*model, order);
+        ASSERT_TRUE(permuted.model->isOfType(storm::models::ModelType::Mdp));
+        EXPECT_EQ(model->getNumberOfChoices(), permuted.model->getNumberOfChoices());
+        ASSERT_TRUE(permuted.model->hasStateValuations());
+        ASSERT_TRUE(permuted.model->hasChoiceLabeling());
+        for (uint64_t newState = 0; newState < permuted.model->getNumberOfStates(); ++newState) {
+            uint64_t oldState = permuted.newToOldStateIndexMapping[newState];
+            EXPECT_EQ(model->getStateValuations().getStateInfo(oldState), permuted.model->getStateValuations().getStateInfo(newState));
+            EXPECT_EQ(model->getStateLabeling().getLabelsOfState(oldState), permuted.model->getStateLabeling().getLabelsOfState(newState));
+        }
+        for (uint64_t newChoice = 0; newChoice < permuted.model->getNumberOfChoices(); ++newChoice) {
+            uint64_t oldChoice = permuted.newToOldChoiceIndexMapping[newChoice];
+            EXPECT_EQ(model->getChoiceLabeling().getLabelsOfChoice(oldChoice), permuted.model->getChoiceLabeling().getLabelsOfChoice(newChoice));
+        }
+        for (auto const& formula : formulas) {
+            auto expected = checkAllStates(model, formula);
+            auto actual = storm::transformer::translateToOriginalIndices(permuted.newToOldStateIndexMapping, checkAllStates(permuted.model, formula));
+            ASSERT_EQ(expected.size(), actual.size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], actual[state], 1e-6) << storm::transformer::toString(order) << ": " << *formula;
+            }
+        }
+    }
+}
+
+TEST(StatePermuterTest, TranslateCheckResults) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [ F \"two\" ]; Pmax>0.05 [ F \"seven\" ]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas);
+    auto permuted = storm::transformer::permuteStates(*model, storm::transformer::StateOrder::ReverseCuthillMcKee);
+    auto const& newToOld = permuted.newToOldStateIndexMapping;
+
+    // Quantitative results are translated along with their schedulers. As the choices of each state retain their relative order, the translated
+    // scheduler selects the same local choice indices.
+    auto task = storm::api::createTask<double>(formulas[0], false);
+    task.setProduceSchedulers(true);
+    auto permutedResult = storm::api::verifyWithSparseEngine<double>(permuted.model, task);
+    auto result = storm::transformer::translateToOriginalStates<double>(newToOld, *permutedResult);
+    auto expected = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas[0], false));
+    auto const& permutedQuantitativeResult = permutedResult->asExplicitQuantitativeCheckResult<double>();
+    auto const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+    auto const& expectedQuantitativeResult = expected->asExplicitQuantitativeCheckResult<double>();
+    ASSERT_TRUE(quantitativeResult.hasScheduler());
+    for (uint64_t newState = 0; newState < newToOld.size(); ++newState) {
+        uint64_t oldState = newToOld[newState];
+        EXPECT_NEAR(expectedQuantitativeResult[oldState], quantitativeResult[oldState], 1e-6);
+        EXPECT_EQ(permutedQuantitativeResult.getScheduler().getChoice(newState).getDeterministicChoice(),
+                  quantitativeResult.getScheduler().getChoice(oldState).getDeterministicChoice());
+    }
+
+    // Qualitative results and results that were filtered to some states.
+    auto qualitativeTask = storm::api::createTask<double>(formulas[1], false);
+    auto qualitativeResult =
+        storm::transformer::translateToOriginalStates<double>(newToOld, *storm::api::verifyWithSparseEngine<double>(permuted.model, qualitativeTask));
+    EXPECT_EQ(storm::api::verifyWithSparseEngine<double>(model, qualitativeTask)->asExplicitQualitativeCheckResult().getTruthValuesVector(),
+              qualitativeResult->asExplicitQualitativeCheckResult().getTruthValuesVector());
+    auto filteredResult = storm::api::verifyWithSparseEngine<double>(permuted.model, storm::api::createTask<double>(formulas[0], true));
+    filteredResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(permuted.model->getInitialStates()));
+    auto translatedFilteredResult = storm::transformer::translateToOriginalStates<double>(newToOld, *filteredResult);
+    uint64_t initialState = *model->getInitialStates().begin();
+    EXPECT_NEAR(expectedQuantitativeResult[initialState], translatedFilteredResult->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+}